@@ -0,0 +1,3290 @@
+/* Generated by 'aot' from 'embed-1.blk', 1605 of 2774 cells translated, do not edit.
+ * See 't/aot.c' for more information. */
+#include "embed.h"
+#include <stdint.h>
+
+#define L (EMBED_CORE_SIZE)
+#define GUARD(ADDR, INSTRUCTION)\
+	if (core[(ADDR)] != (INSTRUCTION) || !(sp < L && rp < L)) { pc = (ADDR); goto fallback; }
+#define S(N) core[(m_t)(sp - (N)) % L]
+
+typedef uint16_t m_t;
+typedef int16_t  s_t;
+typedef uint32_t d_t;
+typedef int32_t  sd_t;
+
+int embed_aot_vm(embed_t *h);
+
+static sd_t aot_floored(const sd_t d, const s_t n, s_t * const remainder) {
+	if (n == -1) {
+		*remainder = 0;
+		return (sd_t)(0u - (d_t)d);
+	}
+	sd_t q = d / n, r = d % n;
+	if (r && ((r < 0) != (n < 0))) {
+		q--;
+		r += n;
+	}
+	*remainder = r;
+	return q;
+}
+
+static int aot_step_cb(void *param) { return ++*(int*)param > 1; }
+
+static int aot_is_default(embed_t *h) {
+	const embed_opt_t * const o = embed_opt_get(h);
+	return !h->profile && o->read == embed_mmu_read_cb && o->write == embed_mmu_write_cb
+		&& (!o->read_byte || o->read_byte == embed_mmu_read_byte_cb)
+		&& (!o->write_byte || o->write_byte == embed_mmu_write_byte_cb)
+		&& o->yield == embed_yield_cb && !(o->options & EMBED_VM_TRACE_ON)
+		&& embed_cells(h) == EMBED_CORE_SIZE;
+}
+
+/* Run a single instruction in the interpreter, using a yield callback that
+ * stops it before the next one, returns non-zero if the virtual machine
+ * halted with '*r' as its return value. */
+static int aot_step(embed_t *h, int *r) {
+	embed_opt_t * const o = embed_opt_get(h);
+	const embed_yield_t yield = o->yield;
+	void *yields = o->yields;
+	int calls = 0;
+	o->yield = aot_step_cb, o->yields = &calls;
+	*r = embed_vm(h);
+	o->yield = yield, o->yields = yields;
+	return calls < 2;
+}
+
+int embed_aot_vm(embed_t *h) {
+	if (!aot_is_default(h))
+		return embed_vm(h);
+	m_t * const core = embed_core_get(h);
+	m_t pc = core[0], t = core[1], rp = core[2], sp = core[3], n = 0, T = 0;
+	d_t d = 0;
+	int r = 0, dirty = 0;
+	(void)d;
+dispatch:
+	switch (pc) {
+	case 0x0000: goto L0000;
+	case 0x0001: goto L0001;
+	case 0x0004: goto L0004;
+	case 0x0005: goto L0005;
+	case 0x0006: goto L0006;
+	case 0x0007: goto L0007;
+	case 0x000A: goto L000A;
+	case 0x000B: goto L000B;
+	case 0x000C: goto L000C;
+	case 0x000D: goto L000D;
+	case 0x0011: goto L0011;
+	case 0x0014: goto L0014;
+	case 0x0015: goto L0015;
+	case 0x0016: goto L0016;
+	case 0x0017: goto L0017;
+	case 0x0018: goto L0018;
+	case 0x001D: goto L001D;
+	case 0x001E: goto L001E;
+	case 0x001F: goto L001F;
+	case 0x0020: goto L0020;
+	case 0x0021: goto L0021;
+	case 0x0022: goto L0022;
+	case 0x0023: goto L0023;
+	case 0x0029: goto L0029;
+	case 0x002B: goto L002B;
+	case 0x002C: goto L002C;
+	case 0x002D: goto L002D;
+	case 0x002E: goto L002E;
+	case 0x0030: goto L0030;
+	case 0x0032: goto L0032;
+	case 0x0033: goto L0033;
+	case 0x0034: goto L0034;
+	case 0x0035: goto L0035;
+	case 0x0036: goto L0036;
+	case 0x0037: goto L0037;
+	case 0x0038: goto L0038;
+	case 0x0039: goto L0039;
+	case 0x003A: goto L003A;
+	case 0x003B: goto L003B;
+	case 0x003C: goto L003C;
+	case 0x003D: goto L003D;
+	case 0x003E: goto L003E;
+	case 0x003F: goto L003F;
+	case 0x0040: goto L0040;
+	case 0x0041: goto L0041;
+	case 0x0042: goto L0042;
+	case 0x0046: goto L0046;
+	case 0x0047: goto L0047;
+	case 0x0048: goto L0048;
+	case 0x004E: goto L004E;
+	case 0x0052: goto L0052;
+	case 0x0053: goto L0053;
+	case 0x0058: goto L0058;
+	case 0x005F: goto L005F;
+	case 0x0064: goto L0064;
+	case 0x0065: goto L0065;
+	case 0x0066: goto L0066;
+	case 0x0067: goto L0067;
+	case 0x006E: goto L006E;
+	case 0x0070: goto L0070;
+	case 0x0071: goto L0071;
+	case 0x0072: goto L0072;
+	case 0x0073: goto L0073;
+	case 0x0074: goto L0074;
+	case 0x0076: goto L0076;
+	case 0x0078: goto L0078;
+	case 0x007A: goto L007A;
+	case 0x007D: goto L007D;
+	case 0x0083: goto L0083;
+	case 0x0084: goto L0084;
+	case 0x0085: goto L0085;
+	case 0x0086: goto L0086;
+	case 0x0087: goto L0087;
+	case 0x008B: goto L008B;
+	case 0x008E: goto L008E;
+	case 0x0090: goto L0090;
+	case 0x0091: goto L0091;
+	case 0x0096: goto L0096;
+	case 0x0097: goto L0097;
+	case 0x0098: goto L0098;
+	case 0x0099: goto L0099;
+	case 0x009A: goto L009A;
+	case 0x009C: goto L009C;
+	case 0x009F: goto L009F;
+	case 0x00A2: goto L00A2;
+	case 0x00A5: goto L00A5;
+	case 0x00A6: goto L00A6;
+	case 0x00A7: goto L00A7;
+	case 0x00AB: goto L00AB;
+	case 0x00B0: goto L00B0;
+	case 0x00B1: goto L00B1;
+	case 0x00B4: goto L00B4;
+	case 0x00B8: goto L00B8;
+	case 0x00BB: goto L00BB;
+	case 0x00BD: goto L00BD;
+	case 0x00BE: goto L00BE;
+	case 0x00BF: goto L00BF;
+	case 0x00C2: goto L00C2;
+	case 0x00C3: goto L00C3;
+	case 0x00C7: goto L00C7;
+	case 0x00CB: goto L00CB;
+	case 0x00CC: goto L00CC;
+	case 0x00CD: goto L00CD;
+	case 0x00CE: goto L00CE;
+	case 0x00CF: goto L00CF;
+	case 0x00D0: goto L00D0;
+	case 0x00D1: goto L00D1;
+	case 0x00D2: goto L00D2;
+	case 0x00D3: goto L00D3;
+	case 0x00D5: goto L00D5;
+	case 0x00D6: goto L00D6;
+	case 0x00D7: goto L00D7;
+	case 0x00DC: goto L00DC;
+	case 0x00DD: goto L00DD;
+	case 0x00E1: goto L00E1;
+	case 0x00E2: goto L00E2;
+	case 0x00E3: goto L00E3;
+	case 0x00E4: goto L00E4;
+	case 0x00E5: goto L00E5;
+	case 0x00E7: goto L00E7;
+	case 0x00E8: goto L00E8;
+	case 0x00E9: goto L00E9;
+	case 0x00EA: goto L00EA;
+	case 0x00EC: goto L00EC;
+	case 0x00EF: goto L00EF;
+	case 0x00F0: goto L00F0;
+	case 0x00F1: goto L00F1;
+	case 0x00F2: goto L00F2;
+	case 0x00F3: goto L00F3;
+	case 0x00F7: goto L00F7;
+	case 0x00F8: goto L00F8;
+	case 0x00FA: goto L00FA;
+	case 0x00FC: goto L00FC;
+	case 0x0100: goto L0100;
+	case 0x0104: goto L0104;
+	case 0x0106: goto L0106;
+	case 0x0107: goto L0107;
+	case 0x0108: goto L0108;
+	case 0x0109: goto L0109;
+	case 0x010A: goto L010A;
+	case 0x010B: goto L010B;
+	case 0x010C: goto L010C;
+	case 0x010D: goto L010D;
+	case 0x010E: goto L010E;
+	case 0x010F: goto L010F;
+	case 0x0110: goto L0110;
+	case 0x0111: goto L0111;
+	case 0x0112: goto L0112;
+	case 0x0113: goto L0113;
+	case 0x0114: goto L0114;
+	case 0x0115: goto L0115;
+	case 0x0116: goto L0116;
+	case 0x0117: goto L0117;
+	case 0x0118: goto L0118;
+	case 0x0119: goto L0119;
+	case 0x011A: goto L011A;
+	case 0x011B: goto L011B;
+	case 0x011C: goto L011C;
+	case 0x011D: goto L011D;
+	case 0x011E: goto L011E;
+	case 0x011F: goto L011F;
+	case 0x0120: goto L0120;
+	case 0x0121: goto L0121;
+	case 0x0122: goto L0122;
+	case 0x0123: goto L0123;
+	case 0x0124: goto L0124;
+	case 0x0125: goto L0125;
+	case 0x0129: goto L0129;
+	case 0x012A: goto L012A;
+	case 0x012B: goto L012B;
+	case 0x012C: goto L012C;
+	case 0x012D: goto L012D;
+	case 0x012E: goto L012E;
+	case 0x012F: goto L012F;
+	case 0x0130: goto L0130;
+	case 0x0134: goto L0134;
+	case 0x0135: goto L0135;
+	case 0x0136: goto L0136;
+	case 0x0137: goto L0137;
+	case 0x0139: goto L0139;
+	case 0x013A: goto L013A;
+	case 0x013B: goto L013B;
+	case 0x013C: goto L013C;
+	case 0x013D: goto L013D;
+	case 0x013E: goto L013E;
+	case 0x013F: goto L013F;
+	case 0x0141: goto L0141;
+	case 0x0142: goto L0142;
+	case 0x0143: goto L0143;
+	case 0x0144: goto L0144;
+	case 0x0145: goto L0145;
+	case 0x0146: goto L0146;
+	case 0x0147: goto L0147;
+	case 0x014A: goto L014A;
+	case 0x014B: goto L014B;
+	case 0x014C: goto L014C;
+	case 0x014D: goto L014D;
+	case 0x014E: goto L014E;
+	case 0x014F: goto L014F;
+	case 0x0153: goto L0153;
+	case 0x0154: goto L0154;
+	case 0x0155: goto L0155;
+	case 0x0156: goto L0156;
+	case 0x0157: goto L0157;
+	case 0x0158: goto L0158;
+	case 0x0159: goto L0159;
+	case 0x015A: goto L015A;
+	case 0x015B: goto L015B;
+	case 0x015F: goto L015F;
+	case 0x0160: goto L0160;
+	case 0x0161: goto L0161;
+	case 0x0162: goto L0162;
+	case 0x0163: goto L0163;
+	case 0x0164: goto L0164;
+	case 0x0165: goto L0165;
+	case 0x0166: goto L0166;
+	case 0x0167: goto L0167;
+	case 0x0168: goto L0168;
+	case 0x0169: goto L0169;
+	case 0x016B: goto L016B;
+	case 0x016C: goto L016C;
+	case 0x016D: goto L016D;
+	case 0x016F: goto L016F;
+	case 0x0170: goto L0170;
+	case 0x0171: goto L0171;
+	case 0x0172: goto L0172;
+	case 0x0175: goto L0175;
+	case 0x0176: goto L0176;
+	case 0x0177: goto L0177;
+	case 0x0178: goto L0178;
+	case 0x0179: goto L0179;
+	case 0x017A: goto L017A;
+	case 0x017B: goto L017B;
+	case 0x017C: goto L017C;
+	case 0x017E: goto L017E;
+	case 0x0181: goto L0181;
+	case 0x0183: goto L0183;
+	case 0x0184: goto L0184;
+	case 0x0185: goto L0185;
+	case 0x0186: goto L0186;
+	case 0x018A: goto L018A;
+	case 0x018B: goto L018B;
+	case 0x018C: goto L018C;
+	case 0x018E: goto L018E;
+	case 0x0190: goto L0190;
+	case 0x0191: goto L0191;
+	case 0x0192: goto L0192;
+	case 0x0195: goto L0195;
+	case 0x0196: goto L0196;
+	case 0x0197: goto L0197;
+	case 0x0198: goto L0198;
+	case 0x0199: goto L0199;
+	case 0x019A: goto L019A;
+	case 0x019B: goto L019B;
+	case 0x019C: goto L019C;
+	case 0x019E: goto L019E;
+	case 0x019F: goto L019F;
+	case 0x01A0: goto L01A0;
+	case 0x01A1: goto L01A1;
+	case 0x01A2: goto L01A2;
+	case 0x01A6: goto L01A6;
+	case 0x01A7: goto L01A7;
+	case 0x01AE: goto L01AE;
+	case 0x01B1: goto L01B1;
+	case 0x01B2: goto L01B2;
+	case 0x01B3: goto L01B3;
+	case 0x01B4: goto L01B4;
+	case 0x01B5: goto L01B5;
+	case 0x01B8: goto L01B8;
+	case 0x01B9: goto L01B9;
+	case 0x01BA: goto L01BA;
+	case 0x01BF: goto L01BF;
+	case 0x01C2: goto L01C2;
+	case 0x01C3: goto L01C3;
+	case 0x01C4: goto L01C4;
+	case 0x01C5: goto L01C5;
+	case 0x01C6: goto L01C6;
+	case 0x01C7: goto L01C7;
+	case 0x01C8: goto L01C8;
+	case 0x01C9: goto L01C9;
+	case 0x01CA: goto L01CA;
+	case 0x01CB: goto L01CB;
+	case 0x01CE: goto L01CE;
+	case 0x01CF: goto L01CF;
+	case 0x01D0: goto L01D0;
+	case 0x01D1: goto L01D1;
+	case 0x01D2: goto L01D2;
+	case 0x01D7: goto L01D7;
+	case 0x01D8: goto L01D8;
+	case 0x01D9: goto L01D9;
+	case 0x01DA: goto L01DA;
+	case 0x01DB: goto L01DB;
+	case 0x01DE: goto L01DE;
+	case 0x01E3: goto L01E3;
+	case 0x01E5: goto L01E5;
+	case 0x01E6: goto L01E6;
+	case 0x01E7: goto L01E7;
+	case 0x01E8: goto L01E8;
+	case 0x01E9: goto L01E9;
+	case 0x01EA: goto L01EA;
+	case 0x01EE: goto L01EE;
+	case 0x01EF: goto L01EF;
+	case 0x01F0: goto L01F0;
+	case 0x01F1: goto L01F1;
+	case 0x01F4: goto L01F4;
+	case 0x01F8: goto L01F8;
+	case 0x01FA: goto L01FA;
+	case 0x01FB: goto L01FB;
+	case 0x0200: goto L0200;
+	case 0x0201: goto L0201;
+	case 0x0202: goto L0202;
+	case 0x0205: goto L0205;
+	case 0x0208: goto L0208;
+	case 0x0209: goto L0209;
+	case 0x020A: goto L020A;
+	case 0x020F: goto L020F;
+	case 0x0215: goto L0215;
+	case 0x0216: goto L0216;
+	case 0x0217: goto L0217;
+	case 0x0218: goto L0218;
+	case 0x0219: goto L0219;
+	case 0x021A: goto L021A;
+	case 0x021B: goto L021B;
+	case 0x021C: goto L021C;
+	case 0x021D: goto L021D;
+	case 0x0222: goto L0222;
+	case 0x0223: goto L0223;
+	case 0x0224: goto L0224;
+	case 0x0225: goto L0225;
+	case 0x0226: goto L0226;
+	case 0x0227: goto L0227;
+	case 0x0228: goto L0228;
+	case 0x0229: goto L0229;
+	case 0x022A: goto L022A;
+	case 0x022B: goto L022B;
+	case 0x022C: goto L022C;
+	case 0x022D: goto L022D;
+	case 0x022E: goto L022E;
+	case 0x022F: goto L022F;
+	case 0x0230: goto L0230;
+	case 0x0231: goto L0231;
+	case 0x0234: goto L0234;
+	case 0x0235: goto L0235;
+	case 0x0236: goto L0236;
+	case 0x0237: goto L0237;
+	case 0x0238: goto L0238;
+	case 0x0239: goto L0239;
+	case 0x023E: goto L023E;
+	case 0x0243: goto L0243;
+	case 0x0244: goto L0244;
+	case 0x0245: goto L0245;
+	case 0x0246: goto L0246;
+	case 0x0247: goto L0247;
+	case 0x0248: goto L0248;
+	case 0x0249: goto L0249;
+	case 0x024A: goto L024A;
+	case 0x024F: goto L024F;
+	case 0x0254: goto L0254;
+	case 0x0256: goto L0256;
+	case 0x0257: goto L0257;
+	case 0x0258: goto L0258;
+	case 0x0259: goto L0259;
+	case 0x025A: goto L025A;
+	case 0x025F: goto L025F;
+	case 0x0260: goto L0260;
+	case 0x0261: goto L0261;
+	case 0x0262: goto L0262;
+	case 0x0268: goto L0268;
+	case 0x0269: goto L0269;
+	case 0x026A: goto L026A;
+	case 0x026B: goto L026B;
+	case 0x026C: goto L026C;
+	case 0x026D: goto L026D;
+	case 0x026E: goto L026E;
+	case 0x026F: goto L026F;
+	case 0x0270: goto L0270;
+	case 0x0271: goto L0271;
+	case 0x0272: goto L0272;
+	case 0x0275: goto L0275;
+	case 0x0276: goto L0276;
+	case 0x0277: goto L0277;
+	case 0x0278: goto L0278;
+	case 0x0279: goto L0279;
+	case 0x027C: goto L027C;
+	case 0x027D: goto L027D;
+	case 0x027E: goto L027E;
+	case 0x027F: goto L027F;
+	case 0x0282: goto L0282;
+	case 0x0283: goto L0283;
+	case 0x0284: goto L0284;
+	case 0x0285: goto L0285;
+	case 0x0286: goto L0286;
+	case 0x0287: goto L0287;
+	case 0x0288: goto L0288;
+	case 0x0289: goto L0289;
+	case 0x028A: goto L028A;
+	case 0x028B: goto L028B;
+	case 0x028C: goto L028C;
+	case 0x028D: goto L028D;
+	case 0x028E: goto L028E;
+	case 0x028F: goto L028F;
+	case 0x0290: goto L0290;
+	case 0x0291: goto L0291;
+	case 0x0292: goto L0292;
+	case 0x0293: goto L0293;
+	case 0x0298: goto L0298;
+	case 0x0299: goto L0299;
+	case 0x029A: goto L029A;
+	case 0x029B: goto L029B;
+	case 0x029C: goto L029C;
+	case 0x029D: goto L029D;
+	case 0x029E: goto L029E;
+	case 0x029F: goto L029F;
+	case 0x02A0: goto L02A0;
+	case 0x02A4: goto L02A4;
+	case 0x02A5: goto L02A5;
+	case 0x02A6: goto L02A6;
+	case 0x02A7: goto L02A7;
+	case 0x02A8: goto L02A8;
+	case 0x02A9: goto L02A9;
+	case 0x02AA: goto L02AA;
+	case 0x02AB: goto L02AB;
+	case 0x02AC: goto L02AC;
+	case 0x02B3: goto L02B3;
+	case 0x02B4: goto L02B4;
+	case 0x02B5: goto L02B5;
+	case 0x02B6: goto L02B6;
+	case 0x02B7: goto L02B7;
+	case 0x02B8: goto L02B8;
+	case 0x02B9: goto L02B9;
+	case 0x02BA: goto L02BA;
+	case 0x02BB: goto L02BB;
+	case 0x02BE: goto L02BE;
+	case 0x02BF: goto L02BF;
+	case 0x02C0: goto L02C0;
+	case 0x02C1: goto L02C1;
+	case 0x02C2: goto L02C2;
+	case 0x02C6: goto L02C6;
+	case 0x02C7: goto L02C7;
+	case 0x02C8: goto L02C8;
+	case 0x02C9: goto L02C9;
+	case 0x02CA: goto L02CA;
+	case 0x02CB: goto L02CB;
+	case 0x02CC: goto L02CC;
+	case 0x02CD: goto L02CD;
+	case 0x02CE: goto L02CE;
+	case 0x02CF: goto L02CF;
+	case 0x02D0: goto L02D0;
+	case 0x02D1: goto L02D1;
+	case 0x02D2: goto L02D2;
+	case 0x02D3: goto L02D3;
+	case 0x02D4: goto L02D4;
+	case 0x02D5: goto L02D5;
+	case 0x02D6: goto L02D6;
+	case 0x02D7: goto L02D7;
+	case 0x02D8: goto L02D8;
+	case 0x02DA: goto L02DA;
+	case 0x02DB: goto L02DB;
+	case 0x02DC: goto L02DC;
+	case 0x02DD: goto L02DD;
+	case 0x02DE: goto L02DE;
+	case 0x02DF: goto L02DF;
+	case 0x02E0: goto L02E0;
+	case 0x02E4: goto L02E4;
+	case 0x02E5: goto L02E5;
+	case 0x02E6: goto L02E6;
+	case 0x02E7: goto L02E7;
+	case 0x02E8: goto L02E8;
+	case 0x02E9: goto L02E9;
+	case 0x02EA: goto L02EA;
+	case 0x02EB: goto L02EB;
+	case 0x02EC: goto L02EC;
+	case 0x02ED: goto L02ED;
+	case 0x02EE: goto L02EE;
+	case 0x02EF: goto L02EF;
+	case 0x02F0: goto L02F0;
+	case 0x02F1: goto L02F1;
+	case 0x02F2: goto L02F2;
+	case 0x02F3: goto L02F3;
+	case 0x02F5: goto L02F5;
+	case 0x02F7: goto L02F7;
+	case 0x02F8: goto L02F8;
+	case 0x02F9: goto L02F9;
+	case 0x02FA: goto L02FA;
+	case 0x02FB: goto L02FB;
+	case 0x02FC: goto L02FC;
+	case 0x02FD: goto L02FD;
+	case 0x02FE: goto L02FE;
+	case 0x02FF: goto L02FF;
+	case 0x0300: goto L0300;
+	case 0x0301: goto L0301;
+	case 0x0302: goto L0302;
+	case 0x0303: goto L0303;
+	case 0x0304: goto L0304;
+	case 0x0305: goto L0305;
+	case 0x0306: goto L0306;
+	case 0x0307: goto L0307;
+	case 0x0308: goto L0308;
+	case 0x0309: goto L0309;
+	case 0x030A: goto L030A;
+	case 0x030B: goto L030B;
+	case 0x030C: goto L030C;
+	case 0x030D: goto L030D;
+	case 0x0310: goto L0310;
+	case 0x0316: goto L0316;
+	case 0x0318: goto L0318;
+	case 0x031D: goto L031D;
+	case 0x0321: goto L0321;
+	case 0x0322: goto L0322;
+	case 0x0323: goto L0323;
+	case 0x0324: goto L0324;
+	case 0x0325: goto L0325;
+	case 0x0326: goto L0326;
+	case 0x0327: goto L0327;
+	case 0x0328: goto L0328;
+	case 0x0329: goto L0329;
+	case 0x032A: goto L032A;
+	case 0x032B: goto L032B;
+	case 0x032C: goto L032C;
+	case 0x032D: goto L032D;
+	case 0x032E: goto L032E;
+	case 0x032F: goto L032F;
+	case 0x0330: goto L0330;
+	case 0x0331: goto L0331;
+	case 0x0332: goto L0332;
+	case 0x0333: goto L0333;
+	case 0x0337: goto L0337;
+	case 0x0338: goto L0338;
+	case 0x0339: goto L0339;
+	case 0x033A: goto L033A;
+	case 0x033B: goto L033B;
+	case 0x033C: goto L033C;
+	case 0x033D: goto L033D;
+	case 0x033E: goto L033E;
+	case 0x033F: goto L033F;
+	case 0x0340: goto L0340;
+	case 0x0341: goto L0341;
+	case 0x0342: goto L0342;
+	case 0x0343: goto L0343;
+	case 0x0344: goto L0344;
+	case 0x0345: goto L0345;
+	case 0x0346: goto L0346;
+	case 0x0347: goto L0347;
+	case 0x0348: goto L0348;
+	case 0x0349: goto L0349;
+	case 0x034A: goto L034A;
+	case 0x034B: goto L034B;
+	case 0x034C: goto L034C;
+	case 0x034D: goto L034D;
+	case 0x034E: goto L034E;
+	case 0x034F: goto L034F;
+	case 0x0354: goto L0354;
+	case 0x0355: goto L0355;
+	case 0x0356: goto L0356;
+	case 0x0357: goto L0357;
+	case 0x035A: goto L035A;
+	case 0x035B: goto L035B;
+	case 0x035C: goto L035C;
+	case 0x035D: goto L035D;
+	case 0x035E: goto L035E;
+	case 0x035F: goto L035F;
+	case 0x0360: goto L0360;
+	case 0x0361: goto L0361;
+	case 0x0362: goto L0362;
+	case 0x0363: goto L0363;
+	case 0x0364: goto L0364;
+	case 0x0365: goto L0365;
+	case 0x0366: goto L0366;
+	case 0x036A: goto L036A;
+	case 0x036B: goto L036B;
+	case 0x036C: goto L036C;
+	case 0x036D: goto L036D;
+	case 0x036E: goto L036E;
+	case 0x036F: goto L036F;
+	case 0x0370: goto L0370;
+	case 0x0371: goto L0371;
+	case 0x0372: goto L0372;
+	case 0x0373: goto L0373;
+	case 0x0374: goto L0374;
+	case 0x0375: goto L0375;
+	case 0x0376: goto L0376;
+	case 0x0377: goto L0377;
+	case 0x0378: goto L0378;
+	case 0x0379: goto L0379;
+	case 0x037A: goto L037A;
+	case 0x037B: goto L037B;
+	case 0x037C: goto L037C;
+	case 0x037D: goto L037D;
+	case 0x037E: goto L037E;
+	case 0x037F: goto L037F;
+	case 0x0380: goto L0380;
+	case 0x0381: goto L0381;
+	case 0x0382: goto L0382;
+	case 0x0383: goto L0383;
+	case 0x0384: goto L0384;
+	case 0x0385: goto L0385;
+	case 0x0386: goto L0386;
+	case 0x0387: goto L0387;
+	case 0x0388: goto L0388;
+	case 0x0389: goto L0389;
+	case 0x038A: goto L038A;
+	case 0x038B: goto L038B;
+	case 0x038C: goto L038C;
+	case 0x038D: goto L038D;
+	case 0x038E: goto L038E;
+	case 0x038F: goto L038F;
+	case 0x0390: goto L0390;
+	case 0x0391: goto L0391;
+	case 0x0392: goto L0392;
+	case 0x0393: goto L0393;
+	case 0x0394: goto L0394;
+	case 0x0395: goto L0395;
+	case 0x0396: goto L0396;
+	case 0x0397: goto L0397;
+	case 0x0398: goto L0398;
+	case 0x0399: goto L0399;
+	case 0x039C: goto L039C;
+	case 0x039D: goto L039D;
+	case 0x039E: goto L039E;
+	case 0x039F: goto L039F;
+	case 0x03A0: goto L03A0;
+	case 0x03A1: goto L03A1;
+	case 0x03A2: goto L03A2;
+	case 0x03A3: goto L03A3;
+	case 0x03A4: goto L03A4;
+	case 0x03A5: goto L03A5;
+	case 0x03A8: goto L03A8;
+	case 0x03A9: goto L03A9;
+	case 0x03AA: goto L03AA;
+	case 0x03AB: goto L03AB;
+	case 0x03AF: goto L03AF;
+	case 0x03B0: goto L03B0;
+	case 0x03B1: goto L03B1;
+	case 0x03B2: goto L03B2;
+	case 0x03B3: goto L03B3;
+	case 0x03B4: goto L03B4;
+	case 0x03B5: goto L03B5;
+	case 0x03B6: goto L03B6;
+	case 0x03B7: goto L03B7;
+	case 0x03B8: goto L03B8;
+	case 0x03B9: goto L03B9;
+	case 0x03BA: goto L03BA;
+	case 0x03BB: goto L03BB;
+	case 0x03BC: goto L03BC;
+	case 0x03BD: goto L03BD;
+	case 0x03BE: goto L03BE;
+	case 0x03BF: goto L03BF;
+	case 0x03C0: goto L03C0;
+	case 0x03C3: goto L03C3;
+	case 0x03C4: goto L03C4;
+	case 0x03C5: goto L03C5;
+	case 0x03C6: goto L03C6;
+	case 0x03C7: goto L03C7;
+	case 0x03C8: goto L03C8;
+	case 0x03C9: goto L03C9;
+	case 0x03CA: goto L03CA;
+	case 0x03CB: goto L03CB;
+	case 0x03CC: goto L03CC;
+	case 0x03CD: goto L03CD;
+	case 0x03D1: goto L03D1;
+	case 0x03D2: goto L03D2;
+	case 0x03D3: goto L03D3;
+	case 0x03D4: goto L03D4;
+	case 0x03D5: goto L03D5;
+	case 0x03D6: goto L03D6;
+	case 0x03D7: goto L03D7;
+	case 0x03D8: goto L03D8;
+	case 0x03D9: goto L03D9;
+	case 0x03DA: goto L03DA;
+	case 0x03DE: goto L03DE;
+	case 0x03DF: goto L03DF;
+	case 0x03E0: goto L03E0;
+	case 0x03E1: goto L03E1;
+	case 0x03E2: goto L03E2;
+	case 0x03E3: goto L03E3;
+	case 0x03E4: goto L03E4;
+	case 0x03E5: goto L03E5;
+	case 0x03E6: goto L03E6;
+	case 0x03E7: goto L03E7;
+	case 0x03E8: goto L03E8;
+	case 0x03E9: goto L03E9;
+	case 0x03EA: goto L03EA;
+	case 0x03EB: goto L03EB;
+	case 0x03EC: goto L03EC;
+	case 0x03ED: goto L03ED;
+	case 0x03F4: goto L03F4;
+	case 0x03F5: goto L03F5;
+	case 0x03F6: goto L03F6;
+	case 0x03F7: goto L03F7;
+	case 0x03F8: goto L03F8;
+	case 0x03F9: goto L03F9;
+	case 0x03FA: goto L03FA;
+	case 0x03FB: goto L03FB;
+	case 0x03FC: goto L03FC;
+	case 0x03FD: goto L03FD;
+	case 0x03FE: goto L03FE;
+	case 0x03FF: goto L03FF;
+	case 0x0400: goto L0400;
+	case 0x0401: goto L0401;
+	case 0x0402: goto L0402;
+	case 0x0403: goto L0403;
+	case 0x0404: goto L0404;
+	case 0x0405: goto L0405;
+	case 0x0406: goto L0406;
+	case 0x040A: goto L040A;
+	case 0x040B: goto L040B;
+	case 0x040C: goto L040C;
+	case 0x040D: goto L040D;
+	case 0x040E: goto L040E;
+	case 0x0414: goto L0414;
+	case 0x0415: goto L0415;
+	case 0x0416: goto L0416;
+	case 0x0417: goto L0417;
+	case 0x0418: goto L0418;
+	case 0x0419: goto L0419;
+	case 0x041A: goto L041A;
+	case 0x041B: goto L041B;
+	case 0x041C: goto L041C;
+	case 0x041D: goto L041D;
+	case 0x041E: goto L041E;
+	case 0x041F: goto L041F;
+	case 0x0420: goto L0420;
+	case 0x0421: goto L0421;
+	case 0x0422: goto L0422;
+	case 0x0423: goto L0423;
+	case 0x0424: goto L0424;
+	case 0x0425: goto L0425;
+	case 0x0426: goto L0426;
+	case 0x0427: goto L0427;
+	case 0x0428: goto L0428;
+	case 0x042F: goto L042F;
+	case 0x0430: goto L0430;
+	case 0x0431: goto L0431;
+	case 0x0432: goto L0432;
+	case 0x0433: goto L0433;
+	case 0x0434: goto L0434;
+	case 0x0435: goto L0435;
+	case 0x0436: goto L0436;
+	case 0x0437: goto L0437;
+	case 0x0438: goto L0438;
+	case 0x0439: goto L0439;
+	case 0x043A: goto L043A;
+	case 0x043B: goto L043B;
+	case 0x043C: goto L043C;
+	case 0x043D: goto L043D;
+	case 0x043E: goto L043E;
+	case 0x043F: goto L043F;
+	case 0x0440: goto L0440;
+	case 0x0441: goto L0441;
+	case 0x0442: goto L0442;
+	case 0x0443: goto L0443;
+	case 0x0444: goto L0444;
+	case 0x0445: goto L0445;
+	case 0x0446: goto L0446;
+	case 0x0447: goto L0447;
+	case 0x0448: goto L0448;
+	case 0x0449: goto L0449;
+	case 0x044A: goto L044A;
+	case 0x044B: goto L044B;
+	case 0x0455: goto L0455;
+	case 0x0459: goto L0459;
+	case 0x045A: goto L045A;
+	case 0x045B: goto L045B;
+	case 0x045C: goto L045C;
+	case 0x045D: goto L045D;
+	case 0x045E: goto L045E;
+	case 0x045F: goto L045F;
+	case 0x0460: goto L0460;
+	case 0x0461: goto L0461;
+	case 0x0462: goto L0462;
+	case 0x0463: goto L0463;
+	case 0x0464: goto L0464;
+	case 0x0465: goto L0465;
+	case 0x0468: goto L0468;
+	case 0x0469: goto L0469;
+	case 0x046C: goto L046C;
+	case 0x046D: goto L046D;
+	case 0x046E: goto L046E;
+	case 0x046F: goto L046F;
+	case 0x0470: goto L0470;
+	case 0x0471: goto L0471;
+	case 0x0472: goto L0472;
+	case 0x0473: goto L0473;
+	case 0x0474: goto L0474;
+	case 0x0475: goto L0475;
+	case 0x0476: goto L0476;
+	case 0x0477: goto L0477;
+	case 0x0478: goto L0478;
+	case 0x0479: goto L0479;
+	case 0x047A: goto L047A;
+	case 0x047B: goto L047B;
+	case 0x047C: goto L047C;
+	case 0x047D: goto L047D;
+	case 0x047E: goto L047E;
+	case 0x047F: goto L047F;
+	case 0x0480: goto L0480;
+	case 0x0481: goto L0481;
+	case 0x0482: goto L0482;
+	case 0x0483: goto L0483;
+	case 0x0484: goto L0484;
+	case 0x0485: goto L0485;
+	case 0x0486: goto L0486;
+	case 0x0487: goto L0487;
+	case 0x0488: goto L0488;
+	case 0x0489: goto L0489;
+	case 0x048A: goto L048A;
+	case 0x048B: goto L048B;
+	case 0x048C: goto L048C;
+	case 0x048D: goto L048D;
+	case 0x048E: goto L048E;
+	case 0x048F: goto L048F;
+	case 0x0490: goto L0490;
+	case 0x0491: goto L0491;
+	case 0x0492: goto L0492;
+	case 0x0493: goto L0493;
+	case 0x0494: goto L0494;
+	case 0x0495: goto L0495;
+	case 0x0496: goto L0496;
+	case 0x0497: goto L0497;
+	case 0x0498: goto L0498;
+	case 0x0499: goto L0499;
+	case 0x049A: goto L049A;
+	case 0x049B: goto L049B;
+	case 0x049C: goto L049C;
+	case 0x049E: goto L049E;
+	case 0x049F: goto L049F;
+	case 0x04A0: goto L04A0;
+	case 0x04A1: goto L04A1;
+	case 0x04A2: goto L04A2;
+	case 0x04A3: goto L04A3;
+	case 0x04A4: goto L04A4;
+	case 0x04A5: goto L04A5;
+	case 0x04A6: goto L04A6;
+	case 0x04A7: goto L04A7;
+	case 0x04A8: goto L04A8;
+	case 0x04A9: goto L04A9;
+	case 0x04AA: goto L04AA;
+	case 0x04AB: goto L04AB;
+	case 0x04AC: goto L04AC;
+	case 0x04AD: goto L04AD;
+	case 0x04AE: goto L04AE;
+	case 0x04AF: goto L04AF;
+	case 0x04B0: goto L04B0;
+	case 0x04B1: goto L04B1;
+	case 0x04B2: goto L04B2;
+	case 0x04B3: goto L04B3;
+	case 0x04B4: goto L04B4;
+	case 0x04B5: goto L04B5;
+	case 0x04B6: goto L04B6;
+	case 0x04B7: goto L04B7;
+	case 0x04B8: goto L04B8;
+	case 0x04B9: goto L04B9;
+	case 0x04BA: goto L04BA;
+	case 0x04BB: goto L04BB;
+	case 0x04BC: goto L04BC;
+	case 0x04C4: goto L04C4;
+	case 0x04C5: goto L04C5;
+	case 0x04C6: goto L04C6;
+	case 0x04C7: goto L04C7;
+	case 0x04CD: goto L04CD;
+	case 0x04DE: goto L04DE;
+	case 0x04DF: goto L04DF;
+	case 0x04E0: goto L04E0;
+	case 0x04E1: goto L04E1;
+	case 0x04E2: goto L04E2;
+	case 0x04E3: goto L04E3;
+	case 0x04E4: goto L04E4;
+	case 0x04E5: goto L04E5;
+	case 0x04E6: goto L04E6;
+	case 0x04E7: goto L04E7;
+	case 0x04E8: goto L04E8;
+	case 0x04E9: goto L04E9;
+	case 0x04EA: goto L04EA;
+	case 0x04EB: goto L04EB;
+	case 0x04EC: goto L04EC;
+	case 0x04ED: goto L04ED;
+	case 0x04EE: goto L04EE;
+	case 0x04EF: goto L04EF;
+	case 0x04F0: goto L04F0;
+	case 0x04F1: goto L04F1;
+	case 0x04F2: goto L04F2;
+	case 0x04F3: goto L04F3;
+	case 0x04F4: goto L04F4;
+	case 0x04F5: goto L04F5;
+	case 0x04F6: goto L04F6;
+	case 0x04F7: goto L04F7;
+	case 0x04F8: goto L04F8;
+	case 0x04F9: goto L04F9;
+	case 0x04FA: goto L04FA;
+	case 0x04FB: goto L04FB;
+	case 0x04FC: goto L04FC;
+	case 0x04FD: goto L04FD;
+	case 0x04FE: goto L04FE;
+	case 0x04FF: goto L04FF;
+	case 0x0500: goto L0500;
+	case 0x0501: goto L0501;
+	case 0x0502: goto L0502;
+	case 0x0503: goto L0503;
+	case 0x0504: goto L0504;
+	case 0x0505: goto L0505;
+	case 0x0506: goto L0506;
+	case 0x0507: goto L0507;
+	case 0x0508: goto L0508;
+	case 0x0509: goto L0509;
+	case 0x050A: goto L050A;
+	case 0x050B: goto L050B;
+	case 0x050C: goto L050C;
+	case 0x050D: goto L050D;
+	case 0x050E: goto L050E;
+	case 0x050F: goto L050F;
+	case 0x0510: goto L0510;
+	case 0x0511: goto L0511;
+	case 0x0512: goto L0512;
+	case 0x0513: goto L0513;
+	case 0x0514: goto L0514;
+	case 0x0515: goto L0515;
+	case 0x0516: goto L0516;
+	case 0x0517: goto L0517;
+	case 0x0518: goto L0518;
+	case 0x051C: goto L051C;
+	case 0x051D: goto L051D;
+	case 0x051E: goto L051E;
+	case 0x051F: goto L051F;
+	case 0x0520: goto L0520;
+	case 0x0521: goto L0521;
+	case 0x0522: goto L0522;
+	case 0x0523: goto L0523;
+	case 0x0524: goto L0524;
+	case 0x0525: goto L0525;
+	case 0x0526: goto L0526;
+	case 0x0527: goto L0527;
+	case 0x0528: goto L0528;
+	case 0x0529: goto L0529;
+	case 0x052A: goto L052A;
+	case 0x052B: goto L052B;
+	case 0x052C: goto L052C;
+	case 0x052D: goto L052D;
+	case 0x052E: goto L052E;
+	case 0x052F: goto L052F;
+	case 0x0530: goto L0530;
+	case 0x0531: goto L0531;
+	case 0x0534: goto L0534;
+	case 0x0539: goto L0539;
+	case 0x053F: goto L053F;
+	case 0x0540: goto L0540;
+	case 0x0541: goto L0541;
+	case 0x0542: goto L0542;
+	case 0x0543: goto L0543;
+	case 0x0544: goto L0544;
+	case 0x0545: goto L0545;
+	case 0x0546: goto L0546;
+	case 0x0547: goto L0547;
+	case 0x0548: goto L0548;
+	case 0x0549: goto L0549;
+	case 0x054A: goto L054A;
+	case 0x054D: goto L054D;
+	case 0x054E: goto L054E;
+	case 0x054F: goto L054F;
+	case 0x0550: goto L0550;
+	case 0x0551: goto L0551;
+	case 0x0552: goto L0552;
+	case 0x0553: goto L0553;
+	case 0x0554: goto L0554;
+	case 0x0555: goto L0555;
+	case 0x0558: goto L0558;
+	case 0x055E: goto L055E;
+	case 0x055F: goto L055F;
+	case 0x0560: goto L0560;
+	case 0x0561: goto L0561;
+	case 0x0562: goto L0562;
+	case 0x0563: goto L0563;
+	case 0x0564: goto L0564;
+	case 0x0566: goto L0566;
+	case 0x0567: goto L0567;
+	case 0x0568: goto L0568;
+	case 0x0569: goto L0569;
+	case 0x056A: goto L056A;
+	case 0x056B: goto L056B;
+	case 0x056C: goto L056C;
+	case 0x0574: goto L0574;
+	case 0x0575: goto L0575;
+	case 0x0576: goto L0576;
+	case 0x0577: goto L0577;
+	case 0x057C: goto L057C;
+	case 0x057D: goto L057D;
+	case 0x057E: goto L057E;
+	case 0x057F: goto L057F;
+	case 0x0580: goto L0580;
+	case 0x0581: goto L0581;
+	case 0x0582: goto L0582;
+	case 0x0583: goto L0583;
+	case 0x0584: goto L0584;
+	case 0x0585: goto L0585;
+	case 0x0586: goto L0586;
+	case 0x0587: goto L0587;
+	case 0x0588: goto L0588;
+	case 0x058E: goto L058E;
+	case 0x058F: goto L058F;
+	case 0x0598: goto L0598;
+	case 0x0599: goto L0599;
+	case 0x059A: goto L059A;
+	case 0x059B: goto L059B;
+	case 0x05A4: goto L05A4;
+	case 0x05AA: goto L05AA;
+	case 0x05AB: goto L05AB;
+	case 0x05AC: goto L05AC;
+	case 0x05AD: goto L05AD;
+	case 0x05AE: goto L05AE;
+	case 0x05B0: goto L05B0;
+	case 0x05B1: goto L05B1;
+	case 0x05B2: goto L05B2;
+	case 0x05C0: goto L05C0;
+	case 0x05C1: goto L05C1;
+	case 0x05D6: goto L05D6;
+	case 0x05E1: goto L05E1;
+	case 0x05E6: goto L05E6;
+	case 0x05EA: goto L05EA;
+	case 0x05EB: goto L05EB;
+	case 0x05EC: goto L05EC;
+	case 0x05ED: goto L05ED;
+	case 0x05F2: goto L05F2;
+	case 0x05F3: goto L05F3;
+	case 0x05F4: goto L05F4;
+	case 0x05F5: goto L05F5;
+	case 0x05F6: goto L05F6;
+	case 0x05F7: goto L05F7;
+	case 0x05F8: goto L05F8;
+	case 0x05F9: goto L05F9;
+	case 0x05FA: goto L05FA;
+	case 0x05FB: goto L05FB;
+	case 0x05FC: goto L05FC;
+	case 0x05FD: goto L05FD;
+	case 0x05FE: goto L05FE;
+	case 0x05FF: goto L05FF;
+	case 0x0600: goto L0600;
+	case 0x0609: goto L0609;
+	case 0x060F: goto L060F;
+	case 0x0614: goto L0614;
+	case 0x0615: goto L0615;
+	case 0x061E: goto L061E;
+	case 0x0620: goto L0620;
+	case 0x0621: goto L0621;
+	case 0x062C: goto L062C;
+	case 0x062D: goto L062D;
+	case 0x062E: goto L062E;
+	case 0x062F: goto L062F;
+	case 0x0630: goto L0630;
+	case 0x0631: goto L0631;
+	case 0x0632: goto L0632;
+	case 0x0633: goto L0633;
+	case 0x0634: goto L0634;
+	case 0x0635: goto L0635;
+	case 0x0636: goto L0636;
+	case 0x0637: goto L0637;
+	case 0x0638: goto L0638;
+	case 0x063A: goto L063A;
+	case 0x063B: goto L063B;
+	case 0x063C: goto L063C;
+	case 0x063D: goto L063D;
+	case 0x063E: goto L063E;
+	case 0x063F: goto L063F;
+	case 0x0640: goto L0640;
+	case 0x0641: goto L0641;
+	case 0x0642: goto L0642;
+	case 0x0643: goto L0643;
+	case 0x0644: goto L0644;
+	case 0x0645: goto L0645;
+	case 0x0646: goto L0646;
+	case 0x0647: goto L0647;
+	case 0x0648: goto L0648;
+	case 0x0649: goto L0649;
+	case 0x064A: goto L064A;
+	case 0x064B: goto L064B;
+	case 0x064C: goto L064C;
+	case 0x064D: goto L064D;
+	case 0x064E: goto L064E;
+	case 0x064F: goto L064F;
+	case 0x0650: goto L0650;
+	case 0x0651: goto L0651;
+	case 0x0652: goto L0652;
+	case 0x0653: goto L0653;
+	case 0x0654: goto L0654;
+	case 0x0655: goto L0655;
+	case 0x0658: goto L0658;
+	case 0x0660: goto L0660;
+	case 0x0665: goto L0665;
+	case 0x0666: goto L0666;
+	case 0x0667: goto L0667;
+	case 0x0668: goto L0668;
+	case 0x0669: goto L0669;
+	case 0x066A: goto L066A;
+	case 0x066B: goto L066B;
+	case 0x066C: goto L066C;
+	case 0x066D: goto L066D;
+	case 0x066E: goto L066E;
+	case 0x066F: goto L066F;
+	case 0x0670: goto L0670;
+	case 0x0671: goto L0671;
+	case 0x0672: goto L0672;
+	case 0x0673: goto L0673;
+	case 0x0674: goto L0674;
+	case 0x0675: goto L0675;
+	case 0x0676: goto L0676;
+	case 0x0682: goto L0682;
+	case 0x0686: goto L0686;
+	case 0x0687: goto L0687;
+	case 0x0688: goto L0688;
+	case 0x0689: goto L0689;
+	case 0x068A: goto L068A;
+	case 0x068B: goto L068B;
+	case 0x0699: goto L0699;
+	case 0x069E: goto L069E;
+	case 0x06AE: goto L06AE;
+	case 0x06AF: goto L06AF;
+	case 0x06B0: goto L06B0;
+	case 0x06B1: goto L06B1;
+	case 0x06B2: goto L06B2;
+	case 0x06C4: goto L06C4;
+	case 0x06C5: goto L06C5;
+	case 0x06C6: goto L06C6;
+	case 0x06C7: goto L06C7;
+	case 0x06C8: goto L06C8;
+	case 0x06CC: goto L06CC;
+	case 0x06CF: goto L06CF;
+	case 0x06D6: goto L06D6;
+	case 0x06DE: goto L06DE;
+	case 0x06ED: goto L06ED;
+	case 0x06F9: goto L06F9;
+	case 0x0709: goto L0709;
+	case 0x070E: goto L070E;
+	case 0x0710: goto L0710;
+	case 0x0711: goto L0711;
+	case 0x0712: goto L0712;
+	case 0x0713: goto L0713;
+	case 0x0714: goto L0714;
+	case 0x071B: goto L071B;
+	case 0x071C: goto L071C;
+	case 0x071D: goto L071D;
+	case 0x071E: goto L071E;
+	case 0x071F: goto L071F;
+	case 0x0720: goto L0720;
+	case 0x0721: goto L0721;
+	case 0x0724: goto L0724;
+	case 0x0728: goto L0728;
+	case 0x0729: goto L0729;
+	case 0x072A: goto L072A;
+	case 0x072B: goto L072B;
+	case 0x072C: goto L072C;
+	case 0x072D: goto L072D;
+	case 0x072E: goto L072E;
+	case 0x0732: goto L0732;
+	case 0x0733: goto L0733;
+	case 0x0734: goto L0734;
+	case 0x0735: goto L0735;
+	case 0x073A: goto L073A;
+	case 0x0742: goto L0742;
+	case 0x0743: goto L0743;
+	case 0x0744: goto L0744;
+	case 0x0745: goto L0745;
+	case 0x074A: goto L074A;
+	case 0x074B: goto L074B;
+	case 0x074C: goto L074C;
+	case 0x0756: goto L0756;
+	case 0x0757: goto L0757;
+	case 0x0758: goto L0758;
+	case 0x0763: goto L0763;
+	case 0x076B: goto L076B;
+	case 0x0774: goto L0774;
+	case 0x0780: goto L0780;
+	case 0x0788: goto L0788;
+	case 0x0798: goto L0798;
+	case 0x0799: goto L0799;
+	case 0x079A: goto L079A;
+	case 0x079B: goto L079B;
+	case 0x079C: goto L079C;
+	case 0x079D: goto L079D;
+	case 0x079E: goto L079E;
+	case 0x079F: goto L079F;
+	case 0x07A0: goto L07A0;
+	case 0x07A1: goto L07A1;
+	case 0x07A2: goto L07A2;
+	case 0x07A3: goto L07A3;
+	case 0x07A4: goto L07A4;
+	case 0x07A5: goto L07A5;
+	case 0x07A6: goto L07A6;
+	case 0x07A7: goto L07A7;
+	case 0x07A8: goto L07A8;
+	case 0x07A9: goto L07A9;
+	case 0x07AA: goto L07AA;
+	case 0x07AB: goto L07AB;
+	case 0x07AC: goto L07AC;
+	case 0x07AD: goto L07AD;
+	case 0x07B4: goto L07B4;
+	case 0x07B5: goto L07B5;
+	case 0x07B6: goto L07B6;
+	case 0x07B7: goto L07B7;
+	case 0x07B8: goto L07B8;
+	case 0x07B9: goto L07B9;
+	case 0x07BA: goto L07BA;
+	case 0x07D9: goto L07D9;
+	case 0x07DA: goto L07DA;
+	case 0x07DB: goto L07DB;
+	case 0x0803: goto L0803;
+	case 0x0819: goto L0819;
+	case 0x081F: goto L081F;
+	case 0x0826: goto L0826;
+	case 0x082D: goto L082D;
+	case 0x0836: goto L0836;
+	case 0x0842: goto L0842;
+	case 0x0843: goto L0843;
+	case 0x0844: goto L0844;
+	case 0x0845: goto L0845;
+	case 0x0846: goto L0846;
+	case 0x0847: goto L0847;
+	case 0x0848: goto L0848;
+	case 0x0849: goto L0849;
+	case 0x084A: goto L084A;
+	case 0x084B: goto L084B;
+	case 0x084C: goto L084C;
+	case 0x0850: goto L0850;
+	case 0x0852: goto L0852;
+	case 0x0853: goto L0853;
+	case 0x0854: goto L0854;
+	case 0x0855: goto L0855;
+	case 0x0856: goto L0856;
+	case 0x0857: goto L0857;
+	case 0x0858: goto L0858;
+	case 0x0859: goto L0859;
+	case 0x085A: goto L085A;
+	case 0x085B: goto L085B;
+	case 0x085C: goto L085C;
+	case 0x085D: goto L085D;
+	case 0x085E: goto L085E;
+	case 0x085F: goto L085F;
+	case 0x0860: goto L0860;
+	case 0x0861: goto L0861;
+	case 0x0862: goto L0862;
+	case 0x0863: goto L0863;
+	case 0x0864: goto L0864;
+	case 0x0865: goto L0865;
+	case 0x0866: goto L0866;
+	case 0x0867: goto L0867;
+	case 0x0868: goto L0868;
+	case 0x0869: goto L0869;
+	case 0x086A: goto L086A;
+	case 0x0873: goto L0873;
+	case 0x0874: goto L0874;
+	case 0x0875: goto L0875;
+	case 0x087C: goto L087C;
+	case 0x0882: goto L0882;
+	case 0x0883: goto L0883;
+	case 0x0884: goto L0884;
+	case 0x0885: goto L0885;
+	case 0x0886: goto L0886;
+	case 0x0887: goto L0887;
+	case 0x0888: goto L0888;
+	case 0x0889: goto L0889;
+	case 0x088A: goto L088A;
+	case 0x088B: goto L088B;
+	case 0x088C: goto L088C;
+	case 0x088D: goto L088D;
+	case 0x088E: goto L088E;
+	case 0x088F: goto L088F;
+	case 0x0890: goto L0890;
+	case 0x0891: goto L0891;
+	case 0x0892: goto L0892;
+	case 0x0893: goto L0893;
+	case 0x0894: goto L0894;
+	case 0x0895: goto L0895;
+	case 0x0896: goto L0896;
+	case 0x0897: goto L0897;
+	case 0x0898: goto L0898;
+	case 0x0899: goto L0899;
+	case 0x089A: goto L089A;
+	case 0x089E: goto L089E;
+	case 0x089F: goto L089F;
+	case 0x08A0: goto L08A0;
+	case 0x08A1: goto L08A1;
+	case 0x08A2: goto L08A2;
+	case 0x08A3: goto L08A3;
+	case 0x08A4: goto L08A4;
+	case 0x08A5: goto L08A5;
+	case 0x08A6: goto L08A6;
+	case 0x08A7: goto L08A7;
+	case 0x08A8: goto L08A8;
+	case 0x08A9: goto L08A9;
+	case 0x08AA: goto L08AA;
+	case 0x08AB: goto L08AB;
+	case 0x08AC: goto L08AC;
+	case 0x08AD: goto L08AD;
+	case 0x08AE: goto L08AE;
+	case 0x08AF: goto L08AF;
+	case 0x08B0: goto L08B0;
+	case 0x08B1: goto L08B1;
+	case 0x08C2: goto L08C2;
+	case 0x08C8: goto L08C8;
+	case 0x08CA: goto L08CA;
+	case 0x08CB: goto L08CB;
+	case 0x08CC: goto L08CC;
+	case 0x08CD: goto L08CD;
+	case 0x08CE: goto L08CE;
+	case 0x08CF: goto L08CF;
+	case 0x08D0: goto L08D0;
+	case 0x08D1: goto L08D1;
+	case 0x08D2: goto L08D2;
+	case 0x08D3: goto L08D3;
+	case 0x08D4: goto L08D4;
+	case 0x08D5: goto L08D5;
+	case 0x08D6: goto L08D6;
+	case 0x08D7: goto L08D7;
+	case 0x08D8: goto L08D8;
+	case 0x08D9: goto L08D9;
+	case 0x08DA: goto L08DA;
+	case 0x08DB: goto L08DB;
+	case 0x08DC: goto L08DC;
+	case 0x08DD: goto L08DD;
+	case 0x08DE: goto L08DE;
+	case 0x08DF: goto L08DF;
+	case 0x08E0: goto L08E0;
+	case 0x08E1: goto L08E1;
+	case 0x08EA: goto L08EA;
+	case 0x08F6: goto L08F6;
+	case 0x08FD: goto L08FD;
+	case 0x0909: goto L0909;
+	case 0x0911: goto L0911;
+	case 0x091C: goto L091C;
+	case 0x0920: goto L0920;
+	case 0x0921: goto L0921;
+	case 0x0922: goto L0922;
+	case 0x0923: goto L0923;
+	case 0x0924: goto L0924;
+	case 0x0925: goto L0925;
+	case 0x0926: goto L0926;
+	case 0x0927: goto L0927;
+	case 0x0928: goto L0928;
+	case 0x0929: goto L0929;
+	case 0x092A: goto L092A;
+	case 0x092B: goto L092B;
+	case 0x0938: goto L0938;
+	case 0x0952: goto L0952;
+	case 0x0953: goto L0953;
+	case 0x0954: goto L0954;
+	case 0x096C: goto L096C;
+	case 0x096D: goto L096D;
+	case 0x096E: goto L096E;
+	case 0x096F: goto L096F;
+	case 0x0970: goto L0970;
+	case 0x0971: goto L0971;
+	case 0x0972: goto L0972;
+	case 0x0973: goto L0973;
+	case 0x0974: goto L0974;
+	case 0x0975: goto L0975;
+	case 0x0976: goto L0976;
+	case 0x0977: goto L0977;
+	case 0x0978: goto L0978;
+	case 0x0979: goto L0979;
+	case 0x097A: goto L097A;
+	case 0x097B: goto L097B;
+	case 0x097C: goto L097C;
+	case 0x097D: goto L097D;
+	case 0x097E: goto L097E;
+	case 0x097F: goto L097F;
+	case 0x0980: goto L0980;
+	case 0x0981: goto L0981;
+	case 0x0982: goto L0982;
+	case 0x0983: goto L0983;
+	case 0x0984: goto L0984;
+	case 0x0985: goto L0985;
+	case 0x0986: goto L0986;
+	case 0x0987: goto L0987;
+	case 0x0988: goto L0988;
+	case 0x0989: goto L0989;
+	case 0x098A: goto L098A;
+	case 0x098B: goto L098B;
+	case 0x098C: goto L098C;
+	case 0x098D: goto L098D;
+	case 0x098E: goto L098E;
+	case 0x098F: goto L098F;
+	case 0x0990: goto L0990;
+	case 0x0991: goto L0991;
+	case 0x0992: goto L0992;
+	case 0x0993: goto L0993;
+	case 0x0994: goto L0994;
+	case 0x0995: goto L0995;
+	case 0x0996: goto L0996;
+	case 0x0997: goto L0997;
+	case 0x0998: goto L0998;
+	case 0x0999: goto L0999;
+	case 0x099A: goto L099A;
+	case 0x099B: goto L099B;
+	case 0x099C: goto L099C;
+	case 0x099D: goto L099D;
+	case 0x099E: goto L099E;
+	case 0x099F: goto L099F;
+	case 0x09A0: goto L09A0;
+	case 0x09A1: goto L09A1;
+	case 0x09A2: goto L09A2;
+	case 0x09AF: goto L09AF;
+	case 0x09B0: goto L09B0;
+	case 0x09B1: goto L09B1;
+	case 0x09B2: goto L09B2;
+	case 0x09B3: goto L09B3;
+	case 0x09B4: goto L09B4;
+	case 0x09B5: goto L09B5;
+	case 0x09B6: goto L09B6;
+	case 0x09B7: goto L09B7;
+	case 0x09B8: goto L09B8;
+	case 0x09B9: goto L09B9;
+	case 0x09BA: goto L09BA;
+	case 0x09BB: goto L09BB;
+	case 0x09BC: goto L09BC;
+	case 0x09BD: goto L09BD;
+	case 0x09BE: goto L09BE;
+	case 0x09BF: goto L09BF;
+	case 0x09C0: goto L09C0;
+	case 0x09C1: goto L09C1;
+	case 0x09C2: goto L09C2;
+	case 0x09C3: goto L09C3;
+	case 0x09C4: goto L09C4;
+	case 0x09C5: goto L09C5;
+	case 0x09C6: goto L09C6;
+	case 0x09C7: goto L09C7;
+	case 0x09C8: goto L09C8;
+	case 0x09C9: goto L09C9;
+	case 0x09CA: goto L09CA;
+	case 0x09CB: goto L09CB;
+	case 0x09CC: goto L09CC;
+	case 0x09CD: goto L09CD;
+	case 0x09CE: goto L09CE;
+	case 0x09CF: goto L09CF;
+	case 0x09D0: goto L09D0;
+	case 0x09D1: goto L09D1;
+	case 0x09D2: goto L09D2;
+	case 0x09D3: goto L09D3;
+	case 0x09D4: goto L09D4;
+	case 0x09D5: goto L09D5;
+	case 0x09D6: goto L09D6;
+	case 0x09D7: goto L09D7;
+	case 0x09D8: goto L09D8;
+	case 0x09D9: goto L09D9;
+	case 0x09DA: goto L09DA;
+	case 0x09DB: goto L09DB;
+	case 0x09DC: goto L09DC;
+	case 0x09DD: goto L09DD;
+	case 0x09DE: goto L09DE;
+	case 0x09DF: goto L09DF;
+	case 0x09E0: goto L09E0;
+	case 0x09E1: goto L09E1;
+	case 0x09E2: goto L09E2;
+	case 0x09E3: goto L09E3;
+	case 0x09E4: goto L09E4;
+	case 0x09E5: goto L09E5;
+	case 0x09E6: goto L09E6;
+	case 0x09E7: goto L09E7;
+	case 0x09E8: goto L09E8;
+	case 0x09E9: goto L09E9;
+	case 0x09EA: goto L09EA;
+	case 0x09EB: goto L09EB;
+	case 0x09EC: goto L09EC;
+	case 0x09ED: goto L09ED;
+	case 0x09EE: goto L09EE;
+	case 0x09EF: goto L09EF;
+	case 0x09F0: goto L09F0;
+	case 0x09F1: goto L09F1;
+	case 0x09F2: goto L09F2;
+	case 0x09F3: goto L09F3;
+	case 0x09F4: goto L09F4;
+	case 0x09F5: goto L09F5;
+	case 0x09F6: goto L09F6;
+	case 0x09F7: goto L09F7;
+	case 0x09F8: goto L09F8;
+	case 0x09F9: goto L09F9;
+	case 0x09FA: goto L09FA;
+	case 0x09FB: goto L09FB;
+	case 0x09FC: goto L09FC;
+	case 0x09FD: goto L09FD;
+	case 0x09FE: goto L09FE;
+	case 0x09FF: goto L09FF;
+	case 0x0A00: goto L0A00;
+	case 0x0A01: goto L0A01;
+	case 0x0A02: goto L0A02;
+	case 0x0A03: goto L0A03;
+	case 0x0A04: goto L0A04;
+	case 0x0A05: goto L0A05;
+	case 0x0A06: goto L0A06;
+	case 0x0A07: goto L0A07;
+	case 0x0A08: goto L0A08;
+	case 0x0A09: goto L0A09;
+	case 0x0A0A: goto L0A0A;
+	case 0x0A0B: goto L0A0B;
+	case 0x0A0C: goto L0A0C;
+	case 0x0A0D: goto L0A0D;
+	case 0x0A0E: goto L0A0E;
+	case 0x0A0F: goto L0A0F;
+	case 0x0A10: goto L0A10;
+	case 0x0A11: goto L0A11;
+	case 0x0A12: goto L0A12;
+	case 0x0A13: goto L0A13;
+	case 0x0A14: goto L0A14;
+	case 0x0A15: goto L0A15;
+	case 0x0A16: goto L0A16;
+	case 0x0A17: goto L0A17;
+	case 0x0A18: goto L0A18;
+	case 0x0A19: goto L0A19;
+	case 0x0A1A: goto L0A1A;
+	case 0x0A1B: goto L0A1B;
+	case 0x0A1C: goto L0A1C;
+	case 0x0A1D: goto L0A1D;
+	case 0x0A1E: goto L0A1E;
+	case 0x0A1F: goto L0A1F;
+	case 0x0A20: goto L0A20;
+	case 0x0A21: goto L0A21;
+	case 0x0A22: goto L0A22;
+	case 0x0A30: goto L0A30;
+	case 0x0A31: goto L0A31;
+	case 0x0A32: goto L0A32;
+	case 0x0A33: goto L0A33;
+	case 0x0A34: goto L0A34;
+	case 0x0A35: goto L0A35;
+	case 0x0A36: goto L0A36;
+	case 0x0A37: goto L0A37;
+	case 0x0A38: goto L0A38;
+	case 0x0A39: goto L0A39;
+	case 0x0A3A: goto L0A3A;
+	case 0x0A3B: goto L0A3B;
+	case 0x0A3C: goto L0A3C;
+	case 0x0A3D: goto L0A3D;
+	case 0x0A3E: goto L0A3E;
+	case 0x0A3F: goto L0A3F;
+	case 0x0A40: goto L0A40;
+	case 0x0A41: goto L0A41;
+	case 0x0A42: goto L0A42;
+	case 0x0A43: goto L0A43;
+	case 0x0A44: goto L0A44;
+	case 0x0A45: goto L0A45;
+	case 0x0A46: goto L0A46;
+	case 0x0A47: goto L0A47;
+	case 0x0A48: goto L0A48;
+	case 0x0A49: goto L0A49;
+	case 0x0A4A: goto L0A4A;
+	case 0x0A4B: goto L0A4B;
+	case 0x0A4C: goto L0A4C;
+	case 0x0A4D: goto L0A4D;
+	case 0x0A4E: goto L0A4E;
+	case 0x0A4F: goto L0A4F;
+	case 0x0A50: goto L0A50;
+	case 0x0A51: goto L0A51;
+	case 0x0A52: goto L0A52;
+	case 0x0A53: goto L0A53;
+	case 0x0A54: goto L0A54;
+	case 0x0A55: goto L0A55;
+	case 0x0A56: goto L0A56;
+	case 0x0A57: goto L0A57;
+	case 0x0A62: goto L0A62;
+	case 0x0A63: goto L0A63;
+	case 0x0A64: goto L0A64;
+	case 0x0A67: goto L0A67;
+	case 0x0A68: goto L0A68;
+	case 0x0A69: goto L0A69;
+	case 0x0A6A: goto L0A6A;
+	case 0x0A6B: goto L0A6B;
+	case 0x0A6C: goto L0A6C;
+	case 0x0A6D: goto L0A6D;
+	case 0x0A6E: goto L0A6E;
+	case 0x0A6F: goto L0A6F;
+	case 0x0A70: goto L0A70;
+	case 0x0A72: goto L0A72;
+	case 0x0A7A: goto L0A7A;
+	case 0x0A7B: goto L0A7B;
+	case 0x0A7C: goto L0A7C;
+	case 0x0A7D: goto L0A7D;
+	case 0x0A7E: goto L0A7E;
+	case 0x0A7F: goto L0A7F;
+	case 0x0A80: goto L0A80;
+	case 0x0A81: goto L0A81;
+	case 0x0A82: goto L0A82;
+	case 0x0A83: goto L0A83;
+	case 0x0A84: goto L0A84;
+	case 0x0A85: goto L0A85;
+	case 0x0A86: goto L0A86;
+	case 0x0A87: goto L0A87;
+	case 0x0A94: goto L0A94;
+	case 0x0A95: goto L0A95;
+	case 0x0A98: goto L0A98;
+	case 0x0A9C: goto L0A9C;
+	case 0x0AA2: goto L0AA2;
+	case 0x0AA6: goto L0AA6;
+	case 0x0AAA: goto L0AAA;
+	case 0x0AAB: goto L0AAB;
+	case 0x0AAC: goto L0AAC;
+	case 0x0AAD: goto L0AAD;
+	case 0x0AB2: goto L0AB2;
+	case 0x0AB6: goto L0AB6;
+	case 0x0ABA: goto L0ABA;
+	case 0x0AC0: goto L0AC0;
+	case 0x0AC8: goto L0AC8;
+	case 0x0AC9: goto L0AC9;
+	case 0x0ACA: goto L0ACA;
+	case 0x0ACB: goto L0ACB;
+	case 0x0ACC: goto L0ACC;
+	case 0x0ACD: goto L0ACD;
+	case 0x0ACE: goto L0ACE;
+	case 0x0ACF: goto L0ACF;
+	case 0x0AD0: goto L0AD0;
+	case 0x0AD1: goto L0AD1;
+	default: goto fallback;
+	}
+fallback:
+	core[0] = pc, core[1] = t, core[2] = rp, core[3] = sp;
+	if (dirty && (h->cache || h->jit))
+		embed_cache_flush(h);
+	dirty = 0;
+	if (aot_step(h, &r))
+		return r;
+	if (!aot_is_default(h))
+		return embed_vm(h);
+	pc = core[0], t = core[1], rp = core[2], sp = core[3];
+	goto dispatch;
+L0000: GUARD(0x0000, 0x0014); goto L0014;
+L0001: GUARD(0x0001, 0x0000); goto L0000;
+L0004: GUARD(0x0004, 0x0347); goto L0347;
+L0005: GUARD(0x0005, 0x8000); core[++sp] = t; t = 0x0000;
+L0006: GUARD(0x0006, 0x0000); goto L0000;
+L0007: GUARD(0x0007, 0x0014); goto L0014;
+L000A: GUARD(0x000A, 0x2400); n = t; t = core[sp--]; if (!n) goto L0400;
+L000B: GUARD(0x000B, 0x4689); core[--rp] = 0x0018; goto L0689;
+L000C: GUARD(0x000C, 0x4854); core[--rp] = 0x001A; goto L0854;
+L000D: GUARD(0x000D, 0x0A0D); goto L0A0D;
+L0011: GUARD(0x0011, 0x0001); goto L0001;
+L0014: GUARD(0x0014, 0x098A); goto L098A;
+L0015: GUARD(0x0015, 0x628D); n = core[sp]; T = core[rp]; sp++; rp++; core[sp] = t; t = T;
+L0016: GUARD(0x0016, 0x601C); n = core[sp]; pc = core[rp] >> 1; T = t; rp++; t = T; goto dispatch;
+L0017: GUARD(0x0017, 0x628D); n = core[sp]; T = core[rp]; sp++; rp++; core[sp] = t; t = T;
+L0018: GUARD(0x0018, 0x631C); n = core[sp]; pc = core[rp] >> 1; T = core[(t>>1)%L]; rp++; t = T; goto dispatch;
+L001D: GUARD(0x001D, 0x0000); goto L0000;
+L001E: GUARD(0x001E, 0x0000); goto L0000;
+L001F: GUARD(0x001F, 0x7003); n = core[sp]; T = n >> t; sp--; t = T;
+L0020: GUARD(0x0020, 0x6461); n = core[sp]; core[(t>>1)%L] = n; T = core[--sp]; dirty = 1; sp++; core[rp] = t; t = n;
+L0021: GUARD(0x0021, 0x4017); core[--rp] = 0x0044; goto L0017;
+L0022: GUARD(0x0022, 0x4100); core[--rp] = 0x0046; goto L0100;
+L0023: GUARD(0x0023, 0x003C); goto L003C;
+L0029: GUARD(0x0029, 0x0046); goto L0046;
+L002B: GUARD(0x002B, 0x622F); n = core[sp]; T = core[rp]; sp--; rp++; t = n;
+L002C: GUARD(0x002C, 0x6675); n = core[sp]; pc = core[rp] >> 1; d = (d_t)t * n; T = d >> 16; core[sp] = d; n = d; sp++; rp--; core[rp] = t; t = n; goto dispatch;
+L002D: GUARD(0x002D, 0x4017); core[--rp] = 0x005C; goto L0017;
+L002E: GUARD(0x002E, 0x0400); goto L0400;
+L0030: GUARD(0x0030, 0x14E0); pc = 0x14E0; goto dispatch;
+L0032: GUARD(0x0032, 0x0052); goto L0052;
+L0033: GUARD(0x0033, 0x3E03); n = t; t = core[sp--]; if (!n) pc = 0x1E03; goto dispatch;
+L0034: GUARD(0x0034, 0x6E69); n = core[sp]; T = -((sd_t)(((d_t)S(1) << 16) | S(2)) < (sd_t)(((d_t)t << 16) | n)); sp -= 2; sp++; core[rp] = t; t = n;
+L0035: GUARD(0x0035, 0x4015); core[--rp] = 0x006C; goto L0015;
+L0036: GUARD(0x0036, 0x0000); goto L0000;
+L0037: GUARD(0x0037, 0x0064); goto L0064;
+L0038: GUARD(0x0038, 0x7305); n = core[sp]; T = rp << 1; sp++; rp--; t = T;
+L0039: GUARD(0x0039, 0x6174); n = core[sp]; pc = core[rp] >> 1; T = n; rp--; core[rp] = t; t = n; goto dispatch;
+L003A: GUARD(0x003A, 0x6574); n = core[sp]; pc = core[rp] >> 1; d = (d_t)t + n; T = d >> 16; core[sp] = d; n = d; rp--; core[rp] = t; t = n; goto dispatch;
+L003B: GUARD(0x003B, 0x4015); core[--rp] = 0x0078; goto L0015;
+L003C: GUARD(0x003C, 0x0000); goto L0000;
+L003D: GUARD(0x003D, 0x006E); goto L006E;
+L003E: GUARD(0x003E, 0x6803); n = core[sp]; T = t|n; sp--; t = T;
+L003F: GUARD(0x003F, 0x646C); n = core[sp]; core[(t>>1)%L] = n; T = core[--sp]; dirty = 1; rp++; core[rp] = t; t = n;
+L0040: GUARD(0x0040, 0x4015); core[--rp] = 0x0082; goto L0015;
+L0041: GUARD(0x0041, 0x0000); goto L0000;
+L0042: GUARD(0x0042, 0x007A); goto L007A;
+L0046: GUARD(0x0046, 0x4015); core[--rp] = 0x008E; goto L0015;
+L0047: GUARD(0x0047, 0x000A); goto L000A;
+L0048: GUARD(0x0048, 0x0084); goto L0084;
+L004E: GUARD(0x004E, 0x0090); goto L0090;
+L0052: GUARD(0x0052, 0x0000); goto L0000;
+L0053: GUARD(0x0053, 0x009C); goto L009C;
+L0058: GUARD(0x0058, 0x00A6); goto L00A6;
+L005F: GUARD(0x005F, 0x0000); goto L0000;
+L0064: GUARD(0x0064, 0x3E6C); n = t; t = core[sp--]; if (!n) pc = 0x1E6C; goto dispatch;
+L0065: GUARD(0x0065, 0x4015); core[--rp] = 0x00CC; goto L0015;
+L0066: GUARD(0x0066, 0x0B54); pc = 0x0B54; goto dispatch;
+L0067: GUARD(0x0067, 0x00BE); goto L00BE;
+L006E: GUARD(0x006E, 0x00CE); goto L00CE;
+L0070: GUARD(0x0070, 0x6B6F); n = core[sp]; T = t-1; sp--; rp++; core[rp] = t; t = n;
+L0071: GUARD(0x0071, 0x003E); goto L003E;
+L0072: GUARD(0x0072, 0x4015); core[--rp] = 0x00E6; goto L0015;
+L0073: GUARD(0x0073, 0x0000); goto L0000;
+L0074: GUARD(0x0074, 0x00B0); goto L00B0;
+L0076: GUARD(0x0076, 0x7075); n = core[sp]; pc = core[rp] >> 1; T = n >> t; sp++; rp--; core[rp] = t; t = n; goto dispatch;
+L0078: GUARD(0x0078, 0x00E8); goto L00E8;
+L007A: GUARD(0x007A, 0x6576); n = core[sp]; pc = core[rp] >> 1; d = (d_t)t + n; T = d >> 16; core[sp] = d; n = d; sp -= 2; rp--; core[rp] = t; t = n; goto dispatch;
+L007D: GUARD(0x007D, 0x00F0); goto L00F0;
+L0083: GUARD(0x0083, 0x00DC); goto L00DC;
+L0084: GUARD(0x0084, 0x7503); n = core[sp]; rp = t >> 1; T = n; sp--; t = T;
+L0085: GUARD(0x0085, 0x2B6D); n = t; t = core[sp--]; if (!n) pc = 0x0B6D; goto dispatch;
+L0086: GUARD(0x0086, 0x651C); n = core[sp]; pc = core[rp] >> 1; d = (d_t)t + n; T = d >> 16; core[sp] = d; n = d; rp++; t = T; goto dispatch;
+L0087: GUARD(0x0087, 0x0106); goto L0106;
+L008B: GUARD(0x008B, 0x00FA); goto L00FA;
+L008E: GUARD(0x008E, 0x0116); goto L0116;
+L0090: GUARD(0x0090, 0x663F); n = core[sp]; pc = core[rp] >> 1; d = (d_t)t * n; T = d >> 16; core[sp] = d; n = d; sp--; rp++; t = n; goto dispatch;
+L0091: GUARD(0x0091, 0x011C); goto L011C;
+L0096: GUARD(0x0096, 0x0122); goto L0122;
+L0097: GUARD(0x0097, 0x6E03); n = core[sp]; T = -(n < t); sp--; t = T;
+L0098: GUARD(0x0098, 0x7069); if (!(t)) { pc = 0x0098; goto fallback; } n = core[sp]; { s_t r_ = 0; T = aot_floored(((d_t)n << 16) | S(1), t, &r_); S(1) = r_; } sp++; core[rp] = t; t = n;
+L0099: GUARD(0x0099, 0x601F); n = core[sp]; pc = core[rp] >> 1; T = t; sp--; rp++; t = T; goto dispatch;
+L009A: GUARD(0x009A, 0x012C); goto L012C;
+L009C: GUARD(0x009C, 0x6F72); n = core[sp]; pc = core[rp] >> 1; T = -((s_t)n < (s_t)t); sp -= 2; core[rp] = t; t = n; goto dispatch;
+L009F: GUARD(0x009F, 0x0134); goto L0134;
+L00A2: GUARD(0x00A2, 0x013E); goto L013E;
+L00A5: GUARD(0x00A5, 0x0144); goto L0144;
+L00A6: GUARD(0x00A6, 0x7206); n = core[sp]; T = sp << 1; sp -= 2; rp--; t = T;
+L00A7: GUARD(0x00A7, 0x6873); n = core[sp]; pc = core[rp] >> 1; T = t|n; sp--; core[rp] = t; t = n; goto dispatch;
+L00AB: GUARD(0x00AB, 0x014A); goto L014A;
+L00B0: GUARD(0x00B0, 0x711F); n = core[sp]; pc = core[rp] >> 1; T = n << t; sp--; rp++; t = T; goto dispatch;
+L00B1: GUARD(0x00B1, 0x0156); goto L0156;
+L00B4: GUARD(0x00B4, 0x0162); goto L0162;
+L00B8: GUARD(0x00B8, 0x0168); goto L0168;
+L00BB: GUARD(0x00BB, 0x0170); goto L0170;
+L00BD: GUARD(0x00BD, 0x646E); n = core[sp]; core[(t>>1)%L] = n; T = core[--sp]; dirty = 1; sp -= 2; rp++; core[rp] = t; t = n;
+L00BE: GUARD(0x00BE, 0x671F); n = core[sp]; pc = core[rp] >> 1; T = t&n; sp--; rp++; t = T; goto dispatch;
+L00BF: GUARD(0x00BF, 0x0176); goto L0176;
+L00C2: GUARD(0x00C2, 0x691F); n = core[sp]; pc = core[rp] >> 1; T = t^n; sp--; rp++; t = T; goto dispatch;
+L00C3: GUARD(0x00C3, 0x017E); goto L017E;
+L00C7: GUARD(0x00C7, 0x0186); goto L0186;
+L00CB: GUARD(0x00CB, 0x018E); goto L018E;
+L00CC: GUARD(0x00CC, 0x3002); n = t; t = core[sp--]; if (!n) pc = 0x1002; goto dispatch;
+L00CD: GUARD(0x00CD, 0x003D); goto L003D;
+L00CE: GUARD(0x00CE, 0x6C1C); n = core[sp]; pc = core[rp] >> 1; T = -(t == 0); rp++; t = T; goto dispatch;
+L00CF: GUARD(0x00CF, 0x010E); goto L010E;
+L00D0: GUARD(0x00D0, 0x7203); n = core[sp]; T = sp << 1; sp--; t = T;
+L00D1: GUARD(0x00D1, 0x3F78); n = t; t = core[sp--]; if (!n) pc = 0x1F78; goto dispatch;
+L00D2: pc = 0x00D2; goto fallback;
+L00D3: GUARD(0x00D3, 0x019E); goto L019E;
+L00D5: GUARD(0x00D5, 0x2178); n = t; t = core[sp--]; if (!n) goto L0178;
+L00D6: pc = 0x00D6; goto fallback;
+L00D7: GUARD(0x00D7, 0x01A6); goto L01A6;
+L00DC: pc = 0x00DC; goto fallback;
+L00DD: GUARD(0x00DD, 0x01AE); goto L01AE;
+L00E1: GUARD(0x00E1, 0x0196); goto L0196;
+L00E2: GUARD(0x00E2, 0x7506); n = core[sp]; rp = t >> 1; T = n; sp -= 2; rp--; t = T;
+L00E3: GUARD(0x00E3, 0x2F6D); n = t; t = core[sp--]; if (!n) pc = 0x0F6D; goto dispatch;
+L00E4: GUARD(0x00E4, 0x6F6D); n = core[sp]; T = -((s_t)n < (s_t)t); sp++; rp++; core[rp] = t; t = n;
+L00E5: GUARD(0x00E5, 0x0064); goto L0064;
+L00E7: GUARD(0x00E7, 0x01C2); goto L01C2;
+L00E8: GUARD(0x00E8, 0x2F04); n = t; t = core[sp--]; if (!n) pc = 0x0F04; goto dispatch;
+L00E9: GUARD(0x00E9, 0x6F6D); n = core[sp]; T = -((s_t)n < (s_t)t); sp++; rp++; core[rp] = t; t = n;
+L00EA: GUARD(0x00EA, 0x0064); goto L0064;
+L00EC: GUARD(0x00EC, 0x01CE); goto L01CE;
+L00EF: GUARD(0x00EF, 0x01D8); goto L01D8;
+L00F0: GUARD(0x00F0, 0x6D03); n = core[sp]; T = -(t == n); sp--; t = T;
+L00F1: GUARD(0x00F1, 0x646F); n = core[sp]; core[(t>>1)%L] = n; T = core[--sp]; dirty = 1; sp--; rp++; core[rp] = t; t = n;
+L00F2: pc = 0x00F2; goto fallback;
+L00F3: GUARD(0x00F3, 0x01DE); goto L01DE;
+L00F7: GUARD(0x00F7, 0x601C); n = core[sp]; pc = core[rp] >> 1; T = t; rp++; t = T; goto dispatch;
+L00F8: GUARD(0x00F8, 0x01E6); goto L01E6;
+L00FA: GUARD(0x00FA, 0x0072); goto L0072;
+L00FC: GUARD(0x00FC, 0x01F0); goto L01F0;
+L0100: GUARD(0x0100, 0x01F8); goto L01F8;
+L0104: GUARD(0x0104, 0x0200); goto L0200;
+L0106: GUARD(0x0106, 0x7264); n = core[sp]; T = sp << 1; rp--; core[rp] = t; t = n;
+L0107: GUARD(0x0107, 0x706F); n = core[sp]; T = n >> t; sp--; rp++; core[rp] = t; t = n;
+L0108: GUARD(0x0108, 0x600C); n = core[sp]; T = t; rp++; t = T;
+L0109: GUARD(0x0109, 0x8000); core[++sp] = t; t = 0x0000;
+L010A: GUARD(0x010A, 0x6A1C); n = core[sp]; pc = core[rp] >> 1; T = ~t; rp++; t = T; goto dispatch;
+L010B: GUARD(0x010B, 0xFFFF); core[++sp] = t; t = 0x7FFF;
+L010C: GUARD(0x010C, 0x6A1C); n = core[sp]; pc = core[rp] >> 1; T = ~t; rp++; t = T; goto dispatch;
+L010D: GUARD(0x010D, 0x6103); n = core[sp]; T = n; sp--; t = T;
+L010E: GUARD(0x010E, 0x6103); n = core[sp]; T = n; sp--; t = T;
+L010F: GUARD(0x010F, 0x8000); core[++sp] = t; t = 0x0000;
+L0110: GUARD(0x0110, 0x601C); n = core[sp]; pc = core[rp] >> 1; T = t; rp++; t = T; goto dispatch;
+L0111: GUARD(0x0111, 0x8078); core[++sp] = t; t = 0x0078;
+L0112: GUARD(0x0112, 0x631C); n = core[sp]; pc = core[rp] >> 1; T = core[(t>>1)%L]; rp++; t = T; goto dispatch;
+L0113: GUARD(0x0113, 0x8001); core[++sp] = t; t = 0x0001;
+L0114: GUARD(0x0114, 0x671F); n = core[sp]; pc = core[rp] >> 1; T = t&n; sp--; rp++; t = T; goto dispatch;
+L0115: GUARD(0x0115, 0x806C); core[++sp] = t; t = 0x006C;
+L0116: GUARD(0x0116, 0x631C); n = core[sp]; pc = core[rp] >> 1; T = core[(t>>1)%L]; rp++; t = T; goto dispatch;
+L0117: GUARD(0x0117, 0x808E); core[++sp] = t; t = 0x008E;
+L0118: GUARD(0x0118, 0x631C); n = core[sp]; pc = core[rp] >> 1; T = core[(t>>1)%L]; rp++; t = T; goto dispatch;
+L0119: GUARD(0x0119, 0x6147); n = core[sp]; T = n; sp--; rp--; core[rp] = t; t = T;
+L011A: pc = 0x011A; goto fallback;
+L011B: GUARD(0x011B, 0x600C); n = core[sp]; T = t; rp++; t = T;
+L011C: GUARD(0x011C, 0x601C); n = core[sp]; pc = core[rp] >> 1; T = t; rp++; t = T; goto dispatch;
+L011D: GUARD(0x011D, 0x8000); core[++sp] = t; t = 0x0000;
+L011E: pc = 0x011E; goto fallback;
+L011F: GUARD(0x011F, 0x6081); n = core[sp]; T = t; sp++; core[sp] = t; t = T;
+L0120: pc = 0x0120; goto fallback;
+L0121: GUARD(0x0121, 0x2124); n = t; t = core[sp--]; if (!n) goto L0124;
+L0122: GUARD(0x0122, 0x600C); n = core[sp]; T = t; rp++; t = T;
+L0123: GUARD(0x0123, 0x601C); n = core[sp]; pc = core[rp] >> 1; T = t; rp++; t = T; goto dispatch;
+L0124: GUARD(0x0124, 0x601C); n = core[sp]; pc = core[rp] >> 1; T = t; rp++; t = T; goto dispatch;
+L0125: GUARD(0x0125, 0x0208); goto L0208;
+L0129: GUARD(0x0129, 0x6103); n = core[sp]; T = n; sp--; t = T;
+L012A: GUARD(0x012A, 0x611F); n = core[sp]; pc = core[rp] >> 1; T = n; sp--; rp++; t = T; goto dispatch;
+L012B: GUARD(0x012B, 0x024A); goto L024A;
+L012C: GUARD(0x012C, 0x3102); n = t; t = core[sp--]; if (!n) pc = 0x1102; goto dispatch;
+L012D: GUARD(0x012D, 0x002B); goto L002B;
+L012E: GUARD(0x012E, 0x8001); core[++sp] = t; t = 0x0001;
+L012F: GUARD(0x012F, 0x653F); n = core[sp]; pc = core[rp] >> 1; d = (d_t)t + n; T = d >> 16; core[sp] = d; n = d; sp--; rp++; t = n; goto dispatch;
+L0130: GUARD(0x0130, 0x0256); goto L0256;
+L0134: GUARD(0x0134, 0x0065); goto L0065;
+L0135: GUARD(0x0135, 0x6B00); n = core[sp]; T = t-1; t = T;
+L0136: GUARD(0x0136, 0x6A1C); n = core[sp]; pc = core[rp] >> 1; T = ~t; rp++; t = T; goto dispatch;
+L0137: GUARD(0x0137, 0x0260); goto L0260;
+L0139: GUARD(0x0139, 0x4135); core[--rp] = 0x0274; goto L0135;
+L013A: GUARD(0x013A, 0x653F); n = core[sp]; pc = core[rp] >> 1; d = (d_t)t + n; T = d >> 16; core[sp] = d; n = d; sp--; rp++; t = n; goto dispatch;
+L013B: GUARD(0x013B, 0x6181); n = core[sp]; T = n; sp++; core[sp] = t; t = T;
+L013C: GUARD(0x013C, 0x0139); goto L0139;
+L013D: GUARD(0x013D, 0x6181); n = core[sp]; T = n; sp++; core[sp] = t; t = T;
+L013E: GUARD(0x013E, 0x653F); n = core[sp]; pc = core[rp] >> 1; d = (d_t)t + n; T = d >> 16; core[sp] = d; n = d; sp--; rp++; t = n; goto dispatch;
+L013F: GUARD(0x013F, 0x026E); goto L026E;
+L0141: GUARD(0x0141, 0x696C); n = core[sp]; T = t^n; rp++; core[rp] = t; t = n;
+L0142: GUARD(0x0142, 0x6E67); n = core[sp]; T = -(n < t); sp--; rp--; core[rp] = t; t = n;
+L0143: GUARD(0x0143, 0x6465); n = core[sp]; core[(t>>1)%L] = n; T = core[--sp]; dirty = 1; sp++; rp--; core[rp] = t; t = n;
+L0144: GUARD(0x0144, 0x6081); n = core[sp]; T = t; sp++; core[sp] = t; t = T;
+L0145: GUARD(0x0145, 0x4113); core[--rp] = 0x028C; goto L0113;
+L0146: GUARD(0x0146, 0x653F); n = core[sp]; pc = core[rp] >> 1; d = (d_t)t + n; T = d >> 16; core[sp] = d; n = d; sp--; rp++; t = n; goto dispatch;
+L0147: GUARD(0x0147, 0x027E); goto L027E;
+L014A: GUARD(0x014A, 0x8000); core[++sp] = t; t = 0x0000;
+L014B: GUARD(0x014B, 0x4109); core[--rp] = 0x0298; goto L0109;
+L014C: GUARD(0x014C, 0x0119); goto L0119;
+L014D: GUARD(0x014D, 0x8002); core[++sp] = t; t = 0x0002;
+L014E: GUARD(0x014E, 0x0139); goto L0139;
+L014F: GUARD(0x014F, 0x028E); goto L028E;
+L0153: GUARD(0x0153, 0x8002); core[++sp] = t; t = 0x0002;
+L0154: GUARD(0x0154, 0x653F); n = core[sp]; pc = core[rp] >> 1; d = (d_t)t + n; T = d >> 16; core[sp] = d; n = d; sp--; rp++; t = n; goto dispatch;
+L0155: GUARD(0x0155, 0x029E); goto L029E;
+L0156: GUARD(0x0156, 0x6305); n = core[sp]; T = core[(t>>1)%L]; sp++; rp--; t = T;
+L0157: GUARD(0x0157, 0x6C65); n = core[sp]; T = -(t == 0); sp++; rp--; core[rp] = t; t = n;
+L0158: GUARD(0x0158, 0x736C); n = core[sp]; T = rp << 1; rp++; core[rp] = t; t = n;
+L0159: GUARD(0x0159, 0x8001); core[++sp] = t; t = 0x0001;
+L015A: GUARD(0x015A, 0x711F); n = core[sp]; pc = core[rp] >> 1; T = n << t; sp--; rp++; t = T; goto dispatch;
+L015B: GUARD(0x015B, 0x02AA); goto L02AA;
+L015F: GUARD(0x015F, 0x8001); core[++sp] = t; t = 0x0001;
+L0160: GUARD(0x0160, 0x701F); n = core[sp]; pc = core[rp] >> 1; T = n >> t; sp--; rp++; t = T; goto dispatch;
+L0161: GUARD(0x0161, 0x02B6); goto L02B6;
+L0162: GUARD(0x0162, 0x3F04); n = t; t = core[sp--]; if (!n) pc = 0x1F04; goto dispatch;
+L0163: GUARD(0x0163, 0x7564); n = core[sp]; rp = t >> 1; T = n; rp--; core[rp] = t; t = n;
+L0164: GUARD(0x0164, 0x0070); goto L0070;
+L0165: GUARD(0x0165, 0x6081); n = core[sp]; T = t; sp++; core[sp] = t; t = T;
+L0166: GUARD(0x0166, 0x2168); n = t; t = core[sp--]; if (!n) goto L0168;
+L0167: GUARD(0x0167, 0x609D); n = core[sp]; pc = core[rp] >> 1; T = t; sp++; rp++; core[sp] = t; t = T; goto dispatch;
+L0168: GUARD(0x0168, 0x601C); n = core[sp]; pc = core[rp] >> 1; T = t; rp++; t = T; goto dispatch;
+L0169: GUARD(0x0169, 0x02C2); goto L02C2;
+L016B: GUARD(0x016B, 0x6180); n = core[sp]; T = n; core[sp] = t; t = T;
+L016C: GUARD(0x016C, 0x6F1F); n = core[sp]; pc = core[rp] >> 1; T = -((s_t)n < (s_t)t); sp--; rp++; t = T; goto dispatch;
+L016D: GUARD(0x016D, 0x02D2); goto L02D2;
+L016F: GUARD(0x016F, 0x003E); goto L003E;
+L0170: GUARD(0x0170, 0x6180); n = core[sp]; T = n; core[sp] = t; t = T;
+L0171: GUARD(0x0171, 0x6E1F); n = core[sp]; pc = core[rp] >> 1; T = -(n < t); sp--; rp++; t = T; goto dispatch;
+L0172: GUARD(0x0172, 0x02DA); goto L02DA;
+L0175: GUARD(0x0175, 0x6D03); n = core[sp]; T = -(t == n); sp--; t = T;
+L0176: GUARD(0x0176, 0x6A1C); n = core[sp]; pc = core[rp] >> 1; T = ~t; rp++; t = T; goto dispatch;
+L0177: GUARD(0x0177, 0x02E4); goto L02E4;
+L0178: GUARD(0x0178, 0x3003); n = t; t = core[sp--]; if (!n) pc = 0x1003; goto dispatch;
+L0179: GUARD(0x0179, 0x3E3C); n = t; t = core[sp--]; if (!n) pc = 0x1E3C; goto dispatch;
+L017A: GUARD(0x017A, 0x6C00); n = core[sp]; T = -(t == 0); t = T;
+L017B: GUARD(0x017B, 0x6A1C); n = core[sp]; pc = core[rp] >> 1; T = ~t; rp++; t = T; goto dispatch;
+L017C: GUARD(0x017C, 0x02EE); goto L02EE;
+L017E: GUARD(0x017E, 0x003E); goto L003E;
+L0181: GUARD(0x0181, 0x02F8); goto L02F8;
+L0183: GUARD(0x0183, 0x003C); goto L003C;
+L0184: GUARD(0x0184, 0x8000); core[++sp] = t; t = 0x0000;
+L0185: GUARD(0x0185, 0x6F1F); n = core[sp]; pc = core[rp] >> 1; T = -((s_t)n < (s_t)t); sp--; rp++; t = T; goto dispatch;
+L0186: GUARD(0x0186, 0x0302); goto L0302;
+L018A: GUARD(0x018A, 0x6181); n = core[sp]; T = n; sp++; core[sp] = t; t = T;
+L018B: GUARD(0x018B, 0x619D); n = core[sp]; pc = core[rp] >> 1; T = n; sp++; rp++; core[sp] = t; t = T; goto dispatch;
+L018C: GUARD(0x018C, 0x030C); goto L030C;
+L018E: GUARD(0x018E, 0x6375); n = core[sp]; pc = core[rp] >> 1; T = core[(t>>1)%L]; sp++; rp--; core[rp] = t; t = n; goto dispatch;
+L0190: GUARD(0x0190, 0x6180); n = core[sp]; T = n; core[sp] = t; t = T;
+L0191: GUARD(0x0191, 0x619D); n = core[sp]; pc = core[rp] >> 1; T = n; sp++; rp++; core[sp] = t; t = T; goto dispatch;
+L0192: GUARD(0x0192, 0x0318); goto L0318;
+L0195: GUARD(0x0195, 0x4190); core[--rp] = 0x032C; goto L0190;
+L0196: GUARD(0x0196, 0x6300); n = core[sp]; T = core[(t>>1)%L]; t = T;
+L0197: GUARD(0x0197, 0x6523); n = core[sp]; d = (d_t)t + n; T = d >> 16; core[sp] = d; n = d; sp--; t = n;
+L0198: GUARD(0x0198, 0x6180); n = core[sp]; T = n; core[sp] = t; t = T;
+L0199: GUARD(0x0199, 0x641F); n = core[sp]; pc = core[rp] >> 1; core[(t>>1)%L] = n; T = core[--sp]; dirty = 1; sp--; rp++; t = T; goto dispatch;
+L019A: GUARD(0x019A, 0x8000); core[++sp] = t; t = 0x0000;
+L019B: GUARD(0x019B, 0x0198); goto L0198;
+L019C: GUARD(0x019C, 0x0324); goto L0324;
+L019E: GUARD(0x019E, 0x212B); n = t; t = core[sp--]; if (!n) goto L012B;
+L019F: GUARD(0x019F, 0x8001); core[++sp] = t; t = 0x0001;
+L01A0: GUARD(0x01A0, 0x6180); n = core[sp]; T = n; core[sp] = t; t = T;
+L01A1: GUARD(0x01A1, 0x0195); goto L0195;
+L01A2: GUARD(0x01A2, 0x0338); goto L0338;
+L01A6: GUARD(0x01A6, 0x01A0); goto L01A0;
+L01A7: GUARD(0x01A7, 0x0344); goto L0344;
+L01AE: GUARD(0x01AE, 0x034E); goto L034E;
+L01B1: GUARD(0x01B1, 0x6081); n = core[sp]; T = t; sp++; core[sp] = t; t = T;
+L01B2: GUARD(0x01B2, 0x4153); core[--rp] = 0x0366; goto L0153;
+L01B3: GUARD(0x01B3, 0x6300); n = core[sp]; T = core[(t>>1)%L]; t = T;
+L01B4: GUARD(0x01B4, 0x6180); n = core[sp]; T = n; core[sp] = t; t = T;
+L01B5: GUARD(0x01B5, 0x631C); n = core[sp]; pc = core[rp] >> 1; T = core[(t>>1)%L]; rp++; t = T; goto dispatch;
+L01B8: GUARD(0x01B8, 0x80BC); core[++sp] = t; t = 0x00BC;
+L01B9: GUARD(0x01B9, 0x641F); n = core[sp]; pc = core[rp] >> 1; core[(t>>1)%L] = n; T = core[--sp]; dirty = 1; sp--; rp++; t = T; goto dispatch;
+L01BA: GUARD(0x01BA, 0x035C); goto L035C;
+L01BF: GUARD(0x01BF, 0x0374); goto L0374;
+L01C2: pc = 0x01C2; goto fallback;
+L01C3: GUARD(0x01C3, 0x006E); goto L006E;
+L01C4: GUARD(0x01C4, 0x413B); core[--rp] = 0x038A; goto L013B;
+L01C5: GUARD(0x01C5, 0x6147); n = core[sp]; T = n; sp--; rp--; core[rp] = t; t = T;
+L01C6: GUARD(0x01C6, 0x4139); core[--rp] = 0x038E; goto L0139;
+L01C7: GUARD(0x01C7, 0x628D); n = core[sp]; T = core[rp]; sp++; rp++; core[sp] = t; t = T;
+L01C8: GUARD(0x01C8, 0x6E1F); n = core[sp]; pc = core[rp] >> 1; T = -(n < t); sp--; rp++; t = T; goto dispatch;
+L01C9: GUARD(0x01C9, 0x6081); n = core[sp]; T = t; sp++; core[sp] = t; t = T;
+L01CA: GUARD(0x01CA, 0x0184); goto L0184;
+L01CB: GUARD(0x01CB, 0x037E); goto L037E;
+L01CE: GUARD(0x01CE, 0x41C9); core[--rp] = 0x039E; goto L01C9;
+L01CF: GUARD(0x01CF, 0x21D1); n = t; t = core[sp--]; if (!n) goto L01D1;
+L01D0: GUARD(0x01D0, 0x0135); goto L0135;
+L01D1: GUARD(0x01D1, 0x601C); n = core[sp]; pc = core[rp] >> 1; T = t; rp++; t = T; goto dispatch;
+L01D2: GUARD(0x01D2, 0x0396); goto L0396;
+L01D7: GUARD(0x01D7, 0xC02A); core[++sp] = t; t = 0x402A;
+L01D8: GUARD(0x01D8, 0x01B1); goto L01B1;
+L01D9: GUARD(0x01D9, 0x41D7); core[--rp] = 0x03B4; goto L01D7;
+L01DA: GUARD(0x01DA, 0x611F); n = core[sp]; pc = core[rp] >> 1; T = n; sp--; rp++; t = T; goto dispatch;
+L01DB: GUARD(0x01DB, 0x03A4); goto L03A4;
+L01DE: GUARD(0x01DE, 0x6372); n = core[sp]; pc = core[rp] >> 1; T = core[(t>>1)%L]; sp -= 2; core[rp] = t; t = n; goto dispatch;
+L01E3: GUARD(0x01E3, 0x03B6); goto L03B6;
+L01E5: GUARD(0x01E5, 0x746F); n = core[sp]; sp = t >> 1; sp--; rp++; core[rp] = t; t = n;
+L01E6: GUARD(0x01E6, 0x6147); n = core[sp]; T = n; sp--; rp--; core[rp] = t; t = T;
+L01E7: GUARD(0x01E7, 0x6180); n = core[sp]; T = n; core[sp] = t; t = T;
+L01E8: GUARD(0x01E8, 0x628D); n = core[sp]; T = core[rp]; sp++; rp++; core[sp] = t; t = T;
+L01E9: GUARD(0x01E9, 0x619C); n = core[sp]; pc = core[rp] >> 1; T = n; rp++; core[sp] = t; t = T; goto dispatch;
+L01EA: GUARD(0x01EA, 0x03C6); goto L03C6;
+L01EE: GUARD(0x01EE, 0x41E6); core[--rp] = 0x03DE; goto L01E6;
+L01EF: GUARD(0x01EF, 0x01E6); goto L01E6;
+L01F0: GUARD(0x01F0, 0x41E6); core[--rp] = 0x03E2; goto L01E6;
+L01F1: GUARD(0x01F1, 0x611F); n = core[sp]; pc = core[rp] >> 1; T = n; sp--; rp++; t = T; goto dispatch;
+L01F4: GUARD(0x01F4, 0x03D4); goto L03D4;
+L01F8: GUARD(0x01F8, 0x6574); n = core[sp]; pc = core[rp] >> 1; d = (d_t)t + n; T = d >> 16; core[sp] = d; n = d; rp--; core[rp] = t; t = n; goto dispatch;
+L01FA: GUARD(0x01FA, 0x601C); n = core[sp]; pc = core[rp] >> 1; T = t; rp++; t = T; goto dispatch;
+L01FB: GUARD(0x01FB, 0x03E8); goto L03E8;
+L0200: GUARD(0x0200, 0x03F6); goto L03F6;
+L0201: GUARD(0x0201, 0x6402); n = core[sp]; core[(t>>1)%L] = n; T = core[--sp]; dirty = 1; sp -= 2; t = T;
+L0202: GUARD(0x0202, 0x002D); goto L002D;
+L0205: GUARD(0x0205, 0x0400); goto L0400;
+L0208: GUARD(0x0208, 0x6E0B); n = core[sp]; T = -((sd_t)(((d_t)S(1) << 16) | S(2)) < (sd_t)(((d_t)t << 16) | n)); sp -= 2; sp--; t = T;
+L0209: GUARD(0x0209, 0x601C); n = core[sp]; pc = core[rp] >> 1; T = t; rp++; t = T; goto dispatch;
+L020A: GUARD(0x020A, 0x040A); goto L040A;
+L020F: GUARD(0x020F, 0x0414); goto L0414;
+L0215: GUARD(0x0215, 0x41C9); core[--rp] = 0x042C; goto L01C9;
+L0216: GUARD(0x0216, 0x2218); n = t; t = core[sp--]; if (!n) goto L0218;
+L0217: GUARD(0x0217, 0x6D08); n = core[sp]; d = 0u - (((d_t)t << 16) | n); core[sp] = d; T = d >> 16; t = T;
+L0218: GUARD(0x0218, 0x601C); n = core[sp]; pc = core[rp] >> 1; T = t; rp++; t = T; goto dispatch;
+L0219: GUARD(0x0219, 0x4184); core[--rp] = 0x0434; goto L0184;
+L021A: GUARD(0x021A, 0x221C); n = t; t = core[sp--]; if (!n) goto L021C;
+L021B: GUARD(0x021B, 0x4135); core[--rp] = 0x0438; goto L0135;
+L021C: GUARD(0x021C, 0x601C); n = core[sp]; pc = core[rp] >> 1; T = t; rp++; t = T; goto dispatch;
+L021D: GUARD(0x021D, 0x041E); goto L041E;
+L0222: GUARD(0x0222, 0x6181); n = core[sp]; T = n; sp++; core[sp] = t; t = T;
+L0223: GUARD(0x0223, 0x6147); n = core[sp]; T = n; sp--; rp--; core[rp] = t; t = T;
+L0224: GUARD(0x0224, 0x6147); n = core[sp]; T = n; sp--; rp--; core[rp] = t; t = T;
+L0225: GUARD(0x0225, 0x4215); core[--rp] = 0x044C; goto L0215;
+L0226: GUARD(0x0226, 0x6281); n = core[sp]; T = core[rp]; sp++; core[sp] = t; t = T;
+L0227: GUARD(0x0227, 0x41CE); core[--rp] = 0x0450; goto L01CE;
+L0228: pc = 0x0228; goto fallback;
+L0229: GUARD(0x0229, 0x628D); n = core[sp]; T = core[rp]; sp++; rp++; core[sp] = t; t = T;
+L022A: GUARD(0x022A, 0x6281); n = core[sp]; T = core[rp]; sp++; core[sp] = t; t = T;
+L022B: GUARD(0x022B, 0x6903); n = core[sp]; T = t^n; sp--; t = T;
+L022C: GUARD(0x022C, 0x4219); core[--rp] = 0x045A; goto L0219;
+L022D: GUARD(0x022D, 0x6180); n = core[sp]; T = n; core[sp] = t; t = T;
+L022E: GUARD(0x022E, 0x628D); n = core[sp]; T = core[rp]; sp++; rp++; core[sp] = t; t = T;
+L022F: GUARD(0x022F, 0x4219); core[--rp] = 0x0460; goto L0219;
+L0230: GUARD(0x0230, 0x619C); n = core[sp]; pc = core[rp] >> 1; T = n; rp++; core[sp] = t; t = T; goto dispatch;
+L0231: GUARD(0x0231, 0x043A); goto L043A;
+L0234: GUARD(0x0234, 0x646F); n = core[sp]; core[(t>>1)%L] = n; T = core[--sp]; dirty = 1; sp--; rp++; core[rp] = t; t = n;
+L0235: GUARD(0x0235, 0x6147); n = core[sp]; T = n; sp--; rp--; core[rp] = t; t = T;
+L0236: GUARD(0x0236, 0x6F08); n = core[sp]; d = (sd_t)(s_t)n * (s_t)t; core[sp] = d; T = d >> 16; t = T;
+L0237: GUARD(0x0237, 0x628D); n = core[sp]; T = core[rp]; sp++; rp++; core[sp] = t; t = T;
+L0238: GUARD(0x0238, 0x0222); goto L0222;
+L0239: GUARD(0x0239, 0x0462); goto L0462;
+L023E: GUARD(0x023E, 0x0472); goto L0472;
+L0243: GUARD(0x0243, 0x6147); n = core[sp]; T = n; sp--; rp--; core[rp] = t; t = T;
+L0244: GUARD(0x0244, 0x601C); n = core[sp]; pc = core[rp] >> 1; T = t; rp++; t = T; goto dispatch;
+L0245: GUARD(0x0245, 0x6300); n = core[sp]; T = core[(t>>1)%L]; t = T;
+L0246: GUARD(0x0246, 0x4165); core[--rp] = 0x048E; goto L0165;
+L0247: GUARD(0x0247, 0x2249); n = t; t = core[sp--]; if (!n) goto L0249;
+L0248: GUARD(0x0248, 0x0243); goto L0243;
+L0249: GUARD(0x0249, 0x601C); n = core[sp]; pc = core[rp] >> 1; T = t; rp++; t = T; goto dispatch;
+L024A: GUARD(0x024A, 0x047C); goto L047C;
+L024F: GUARD(0x024F, 0x0494); goto L0494;
+L0254: GUARD(0x0254, 0x049E); goto L049E;
+L0256: GUARD(0x0256, 0x7265); n = core[sp]; T = sp << 1; sp++; rp--; core[rp] = t; t = n;
+L0257: GUARD(0x0257, 0x0065); goto L0065;
+L0258: GUARD(0x0258, 0x805E); core[++sp] = t; t = 0x005E;
+L0259: GUARD(0x0259, 0x631C); n = core[sp]; pc = core[rp] >> 1; T = core[(t>>1)%L]; rp++; t = T; goto dispatch;
+L025A: GUARD(0x025A, 0x04A8); goto L04A8;
+L025F: GUARD(0x025F, 0x4144); core[--rp] = 0x04C0; goto L0144;
+L0260: GUARD(0x0260, 0x805E); core[++sp] = t; t = 0x005E;
+L0261: GUARD(0x0261, 0x641F); n = core[sp]; pc = core[rp] >> 1; core[(t>>1)%L] = n; T = core[--sp]; dirty = 1; sp--; rp++; t = T; goto dispatch;
+L0262: GUARD(0x0262, 0x04B4); goto L04B4;
+L0268: GUARD(0x0268, 0x6240); n = core[sp]; T = core[rp]; core[rp] = t; t = T;
+L0269: GUARD(0x0269, 0x6180); n = core[sp]; T = n; core[sp] = t; t = T;
+L026A: GUARD(0x026A, 0x6147); n = core[sp]; T = n; sp--; rp--; core[rp] = t; t = T;
+L026B: GUARD(0x026B, 0x6147); n = core[sp]; T = n; sp--; rp--; core[rp] = t; t = T;
+L026C: GUARD(0x026C, 0x601C); n = core[sp]; pc = core[rp] >> 1; T = t; rp++; t = T; goto dispatch;
+L026D: GUARD(0x026D, 0x628D); n = core[sp]; T = core[rp]; sp++; rp++; core[sp] = t; t = T;
+L026E: GUARD(0x026E, 0x628D); n = core[sp]; T = core[rp]; sp++; rp++; core[sp] = t; t = T;
+L026F: GUARD(0x026F, 0x6180); n = core[sp]; T = n; core[sp] = t; t = T;
+L0270: GUARD(0x0270, 0x6240); n = core[sp]; T = core[rp]; core[rp] = t; t = T;
+L0271: GUARD(0x0271, 0x601C); n = core[sp]; pc = core[rp] >> 1; T = t; rp++; t = T; goto dispatch;
+L0272: GUARD(0x0272, 0x04C4); goto L04C4;
+L0275: GUARD(0x0275, 0x6F81); n = core[sp]; T = -((s_t)n < (s_t)t); sp++; core[sp] = t; t = T;
+L0276: GUARD(0x0276, 0x2278); n = t; t = core[sp--]; if (!n) goto L0278;
+L0277: GUARD(0x0277, 0x611F); n = core[sp]; pc = core[rp] >> 1; T = n; sp--; rp++; t = T; goto dispatch;
+L0278: GUARD(0x0278, 0x601F); n = core[sp]; pc = core[rp] >> 1; T = t; sp--; rp++; t = T; goto dispatch;
+L0279: GUARD(0x0279, 0x04E4); goto L04E4;
+L027C: GUARD(0x027C, 0x418A); core[--rp] = 0x04FA; goto L018A;
+L027D: GUARD(0x027D, 0x416B); core[--rp] = 0x04FC; goto L016B;
+L027E: GUARD(0x027E, 0x0276); goto L0276;
+L027F: GUARD(0x027F, 0x04F2); goto L04F2;
+L0282: GUARD(0x0282, 0xC010); core[++sp] = t; t = 0x4010;
+L0283: GUARD(0x0283, 0x4245); core[--rp] = 0x0508; goto L0245;
+L0284: GUARD(0x0284, 0x6081); n = core[sp]; T = t; sp++; core[sp] = t; t = T;
+L0285: GUARD(0x0285, 0x228A); n = t; t = core[sp--]; if (!n) goto L028A;
+L0286: GUARD(0x0286, 0x6003); n = core[sp]; T = t; sp--; t = T;
+L0287: GUARD(0x0287, 0x8001); core[++sp] = t; t = 0x0001;
+L0288: GUARD(0x0288, 0x4109); core[--rp] = 0x0512; goto L0109;
+L0289: GUARD(0x0289, 0x4119); core[--rp] = 0x0514; goto L0119;
+L028A: GUARD(0x028A, 0x6C00); n = core[sp]; T = -(t == 0); t = T;
+L028B: GUARD(0x028B, 0x2282); n = t; t = core[sp--]; if (!n) goto L0282;
+L028C: GUARD(0x028C, 0x6081); n = core[sp]; T = t; sp++; core[sp] = t; t = T;
+L028D: GUARD(0x028D, 0x4109); core[--rp] = 0x051C; goto L0109;
+L028E: GUARD(0x028E, 0x4175); core[--rp] = 0x051E; goto L0175;
+L028F: GUARD(0x028F, 0x4121); core[--rp] = 0x0520; goto L0121;
+L0290: GUARD(0x0290, 0x6103); n = core[sp]; T = n; sp--; t = T;
+L0291: GUARD(0x0291, 0x414A); core[--rp] = 0x0524; goto L014A;
+L0292: GUARD(0x0292, 0x0282); goto L0282;
+L0293: GUARD(0x0293, 0x04FE); goto L04FE;
+L0298: GUARD(0x0298, 0x6181); n = core[sp]; T = n; sp++; core[sp] = t; t = T;
+L0299: GUARD(0x0299, 0x4275); core[--rp] = 0x0534; goto L0275;
+L029A: GUARD(0x029A, 0x41E6); core[--rp] = 0x0536; goto L01E6;
+L029B: GUARD(0x029B, 0x413D); core[--rp] = 0x0538; goto L013D;
+L029C: GUARD(0x029C, 0x41EE); core[--rp] = 0x053A; goto L01EE;
+L029D: GUARD(0x029D, 0x0139); goto L0139;
+L029E: GUARD(0x029E, 0x8001); core[++sp] = t; t = 0x0001;
+L029F: GUARD(0x029F, 0x0298); goto L0298;
+L02A0: GUARD(0x02A0, 0x0526); goto L0526;
+L02A4: GUARD(0x02A4, 0x6081); n = core[sp]; T = t; sp++; core[sp] = t; t = T;
+L02A5: GUARD(0x02A5, 0x412E); core[--rp] = 0x054C; goto L012E;
+L02A6: GUARD(0x02A6, 0x6180); n = core[sp]; T = n; core[sp] = t; t = T;
+L02A7: GUARD(0x02A7, 0x6008); n = core[sp]; T = (core[t >> 1] >> ((t & 1) << 3)) & 0xFF; t = T;
+L02A8: GUARD(0x02A8, 0x601C); n = core[sp]; pc = core[rp] >> 1; T = t; rp++; t = T; goto dispatch;
+L02A9: GUARD(0x02A9, 0x6181); n = core[sp]; T = n; sp++; core[sp] = t; t = T;
+L02AA: GUARD(0x02AA, 0x6008); n = core[sp]; T = (core[t >> 1] >> ((t & 1) << 3)) & 0xFF; t = T;
+L02AB: GUARD(0x02AB, 0x601C); n = core[sp]; pc = core[rp] >> 1; T = t; rp++; t = T; goto dispatch;
+L02AC: GUARD(0x02AC, 0x01BA); goto L01BA;
+L02B3: GUARD(0x02B3, 0xC018); core[++sp] = t; t = 0x4018;
+L02B4: GUARD(0x02B4, 0x0245); goto L0245;
+L02B5: GUARD(0x02B5, 0x0540); goto L0540;
+L02B6: GUARD(0x02B6, 0x6504); n = core[sp]; d = (d_t)t + n; T = d >> 16; core[sp] = d; n = d; rp--; t = T;
+L02B7: GUARD(0x02B7, 0x696D); n = core[sp]; T = t^n; sp++; rp++; core[rp] = t; t = n;
+L02B8: GUARD(0x02B8, 0x0074); goto L0074;
+L02B9: GUARD(0x02B9, 0xC012); core[++sp] = t; t = 0x4012;
+L02BA: GUARD(0x02BA, 0x0245); goto L0245;
+L02BB: GUARD(0x02BB, 0x056A); goto L056A;
+L02BE: GUARD(0x02BE, 0x800D); core[++sp] = t; t = 0x000D;
+L02BF: GUARD(0x02BF, 0x42B9); core[--rp] = 0x0580; goto L02B9;
+L02C0: GUARD(0x02C0, 0x800A); core[++sp] = t; t = 0x000A;
+L02C1: GUARD(0x02C1, 0x02B9); goto L02B9;
+L02C2: GUARD(0x02C2, 0x0576); goto L0576;
+L02C6: GUARD(0x02C6, 0x8001); core[++sp] = t; t = 0x0001;
+L02C7: GUARD(0x02C7, 0x8020); core[++sp] = t; t = 0x0020;
+L02C8: GUARD(0x02C8, 0x6180); n = core[sp]; T = n; core[sp] = t; t = T;
+L02C9: GUARD(0x02C9, 0x8000); core[++sp] = t; t = 0x0000;
+L02CA: GUARD(0x02CA, 0x427C); core[--rp] = 0x0596; goto L027C;
+L02CB: GUARD(0x02CB, 0x6147); n = core[sp]; T = n; sp--; rp--; core[rp] = t; t = T;
+L02CC: GUARD(0x02CC, 0x02CF); goto L02CF;
+L02CD: GUARD(0x02CD, 0x6081); n = core[sp]; T = t; sp++; core[sp] = t; t = T;
+L02CE: GUARD(0x02CE, 0x42B9); core[--rp] = 0x059E; goto L02B9;
+L02CF: GUARD(0x02CF, 0x7E81); n = core[sp]; if ((T = core[rp])) { core[rp] = T - 1; T = 0; } else { rp++; T = -1; } sp++; core[sp] = t; t = T;
+L02D0: GUARD(0x02D0, 0x22CD); n = t; t = core[sp--]; if (!n) goto L02CD;
+L02D1: GUARD(0x02D1, 0x611F); n = core[sp]; pc = core[rp] >> 1; T = n; sp--; rp++; t = T; goto dispatch;
+L02D2: GUARD(0x02D2, 0x803A); core[++sp] = t; t = 0x003A;
+L02D3: GUARD(0x02D3, 0x42B9); core[--rp] = 0x05A8; goto L02B9;
+L02D4: GUARD(0x02D4, 0x02C6); goto L02C6;
+L02D5: GUARD(0x02D5, 0x7281); n = core[sp]; T = sp << 1; sp++; core[sp] = t; t = T;
+L02D6: GUARD(0x02D6, 0x6180); n = core[sp]; T = n; core[sp] = t; t = T;
+L02D7: GUARD(0x02D7, 0x0139); goto L0139;
+L02D8: GUARD(0x02D8, 0x0584); goto L0584;
+L02DA: GUARD(0x02DA, 0x7065); n = core[sp]; T = n >> t; sp++; rp--; core[rp] = t; t = n;
+L02DB: GUARD(0x02DB, 0x6874); n = core[sp]; pc = core[rp] >> 1; T = t|n; rp--; core[rp] = t; t = n; goto dispatch;
+L02DC: GUARD(0x02DC, 0xC800); core[++sp] = t; t = 0x4800;
+L02DD: GUARD(0x02DD, 0x42D5); core[--rp] = 0x05BC; goto L02D5;
+L02DE: GUARD(0x02DE, 0x414D); core[--rp] = 0x05BE; goto L014D;
+L02DF: GUARD(0x02DF, 0x015F); goto L015F;
+L02E0: GUARD(0x02E0, 0x05B0); goto L05B0;
+L02E4: GUARD(0x02E4, 0x4159); core[--rp] = 0x05CA; goto L0159;
+L02E5: GUARD(0x02E5, 0x42D5); core[--rp] = 0x05CC; goto L02D5;
+L02E6: GUARD(0x02E6, 0x631C); n = core[sp]; pc = core[rp] >> 1; T = core[(t>>1)%L]; rp++; t = T; goto dispatch;
+L02E7: GUARD(0x02E7, 0x4159); core[--rp] = 0x05D0; goto L0159;
+L02E8: GUARD(0x02E8, 0x42D5); core[--rp] = 0x05D2; goto L02D5;
+L02E9: GUARD(0x02E9, 0x7400); n = core[sp]; sp = t >> 1; t = T;
+L02EA: GUARD(0x02EA, 0x611F); n = core[sp]; pc = core[rp] >> 1; T = n; sp--; rp++; t = T; goto dispatch;
+L02EB: GUARD(0x02EB, 0x6081); n = core[sp]; T = t; sp++; core[sp] = t; t = T;
+L02EC: GUARD(0x02EC, 0x807F); core[++sp] = t; t = 0x007F;
+L02ED: GUARD(0x02ED, 0x8020); core[++sp] = t; t = 0x0020;
+L02EE: GUARD(0x02EE, 0x41C4); core[--rp] = 0x05DE; goto L01C4;
+L02EF: GUARD(0x02EF, 0x22F2); n = t; t = core[sp--]; if (!n) goto L02F2;
+L02F0: GUARD(0x02F0, 0x6103); n = core[sp]; T = n; sp--; t = T;
+L02F1: GUARD(0x02F1, 0x805F); core[++sp] = t; t = 0x005F;
+L02F2: GUARD(0x02F2, 0x601C); n = core[sp]; pc = core[rp] >> 1; T = t; rp++; t = T; goto dispatch;
+L02F3: GUARD(0x02F3, 0x05C0); goto L05C0;
+L02F5: GUARD(0x02F5, 0x7079); if (!(t)) { pc = 0x02F5; goto fallback; } n = core[sp]; pc = core[rp] >> 1; { s_t r_ = 0; T = aot_floored(((d_t)n << 16) | S(1), t, &r_); S(1) = r_; } sp++; core[rp] = t; t = n; goto dispatch;
+L02F7: GUARD(0x02F7, 0x8000); core[++sp] = t; t = 0x0000;
+L02F8: GUARD(0x02F8, 0x6147); n = core[sp]; T = n; sp--; rp--; core[rp] = t; t = T;
+L02F9: GUARD(0x02F9, 0x6081); n = core[sp]; T = t; sp++; core[sp] = t; t = T;
+L02FA: GUARD(0x02FA, 0x2304); n = t; t = core[sp--]; if (!n) goto L0304;
+L02FB: GUARD(0x02FB, 0x6180); n = core[sp]; T = n; core[sp] = t; t = T;
+L02FC: GUARD(0x02FC, 0x42A4); core[--rp] = 0x05FA; goto L02A4;
+L02FD: GUARD(0x02FD, 0x6281); n = core[sp]; T = core[rp]; sp++; core[sp] = t; t = T;
+L02FE: GUARD(0x02FE, 0x2300); n = t; t = core[sp--]; if (!n) goto L0300;
+L02FF: GUARD(0x02FF, 0x42EB); core[--rp] = 0x0600; goto L02EB;
+L0300: GUARD(0x0300, 0x42B9); core[--rp] = 0x0602; goto L02B9;
+L0301: GUARD(0x0301, 0x6180); n = core[sp]; T = n; core[sp] = t; t = T;
+L0302: GUARD(0x0302, 0x6B00); n = core[sp]; T = t-1; t = T;
+L0303: GUARD(0x0303, 0x02F9); goto L02F9;
+L0304: GUARD(0x0304, 0x600C); n = core[sp]; T = t; rp++; t = T;
+L0305: GUARD(0x0305, 0x0129); goto L0129;
+L0306: GUARD(0x0306, 0x42A4); core[--rp] = 0x060E; goto L02A4;
+L0307: GUARD(0x0307, 0x02F7); goto L02F7;
+L0308: GUARD(0x0308, 0x4109); core[--rp] = 0x0612; goto L0109;
+L0309: GUARD(0x0309, 0x02F8); goto L02F8;
+L030A: GUARD(0x030A, 0x05E6); goto L05E6;
+L030B: GUARD(0x030B, 0x6305); n = core[sp]; T = core[(t>>1)%L]; sp++; rp--; t = T;
+L030C: GUARD(0x030C, 0x6F6D); n = core[sp]; T = -((s_t)n < (s_t)t); sp++; rp++; core[rp] = t; t = n;
+L030D: GUARD(0x030D, 0x6576); n = core[sp]; pc = core[rp] >> 1; d = (d_t)t + n; T = d >> 16; core[sp] = d; n = d; sp -= 2; rp--; core[rp] = t; t = n; goto dispatch;
+L0310: GUARD(0x0310, 0x0614); goto L0614;
+L0316: GUARD(0x0316, 0x0620); goto L0620;
+L0318: GUARD(0x0318, 0x6172); n = core[sp]; pc = core[rp] >> 1; T = n; sp -= 2; core[rp] = t; t = n; goto dispatch;
+L031D: GUARD(0x031D, 0x062C); goto L062C;
+L0321: GUARD(0x0321, 0x7281); n = core[sp]; T = sp << 1; sp++; core[sp] = t; t = T;
+L0322: GUARD(0x0322, 0x6147); n = core[sp]; T = n; sp--; rp--; core[rp] = t; t = T;
+L0323: GUARD(0x0323, 0xC00A); core[++sp] = t; t = 0x400A;
+L0324: GUARD(0x0324, 0x6300); n = core[sp]; T = core[(t>>1)%L]; t = T;
+L0325: GUARD(0x0325, 0x6147); n = core[sp]; T = n; sp--; rp--; core[rp] = t; t = T;
+L0326: GUARD(0x0326, 0x800C); core[++sp] = t; t = 0x000C;
+L0327: GUARD(0x0327, 0x6300); n = core[sp]; T = core[(t>>1)%L]; t = T;
+L0328: GUARD(0x0328, 0x6147); n = core[sp]; T = n; sp--; rp--; core[rp] = t; t = T;
+L0329: GUARD(0x0329, 0x7381); n = core[sp]; T = rp << 1; sp++; core[sp] = t; t = T;
+L032A: GUARD(0x032A, 0xC00A); core[++sp] = t; t = 0x400A;
+L032B: GUARD(0x032B, 0x6403); n = core[sp]; core[(t>>1)%L] = n; T = core[--sp]; dirty = 1; sp--; t = T;
+L032C: GUARD(0x032C, 0x4243); core[--rp] = 0x065A; goto L0243;
+L032D: GUARD(0x032D, 0x600C); n = core[sp]; T = t; rp++; t = T;
+L032E: GUARD(0x032E, 0x628D); n = core[sp]; T = core[rp]; sp++; rp++; core[sp] = t; t = T;
+L032F: GUARD(0x032F, 0xC00A); core[++sp] = t; t = 0x400A;
+L0330: GUARD(0x0330, 0x6403); n = core[sp]; core[(t>>1)%L] = n; T = core[--sp]; dirty = 1; sp--; t = T;
+L0331: GUARD(0x0331, 0x628D); n = core[sp]; T = core[rp]; sp++; rp++; core[sp] = t; t = T;
+L0332: GUARD(0x0332, 0x010E); goto L010E;
+L0333: GUARD(0x0333, 0x063A); goto L063A;
+L0337: GUARD(0x0337, 0x4165); core[--rp] = 0x0670; goto L0165;
+L0338: GUARD(0x0338, 0x2346); n = t; t = core[sp--]; if (!n) goto L0346;
+L0339: GUARD(0x0339, 0xC00A); core[++sp] = t; t = 0x400A;
+L033A: GUARD(0x033A, 0x6300); n = core[sp]; T = core[(t>>1)%L]; t = T;
+L033B: GUARD(0x033B, 0x7503); n = core[sp]; rp = t >> 1; T = n; sp--; t = T;
+L033C: GUARD(0x033C, 0x628D); n = core[sp]; T = core[rp]; sp++; rp++; core[sp] = t; t = T;
+L033D: GUARD(0x033D, 0x800C); core[++sp] = t; t = 0x000C;
+L033E: GUARD(0x033E, 0x6403); n = core[sp]; core[(t>>1)%L] = n; T = core[--sp]; dirty = 1; sp--; t = T;
+L033F: GUARD(0x033F, 0x628D); n = core[sp]; T = core[rp]; sp++; rp++; core[sp] = t; t = T;
+L0340: GUARD(0x0340, 0xC00A); core[++sp] = t; t = 0x400A;
+L0341: GUARD(0x0341, 0x6403); n = core[sp]; core[(t>>1)%L] = n; T = core[--sp]; dirty = 1; sp--; t = T;
+L0342: GUARD(0x0342, 0x6240); n = core[sp]; T = core[rp]; core[rp] = t; t = T;
+L0343: GUARD(0x0343, 0x7400); n = core[sp]; sp = t >> 1; t = T;
+L0344: GUARD(0x0344, 0x6103); n = core[sp]; T = n; sp--; t = T;
+L0345: GUARD(0x0345, 0x628D); n = core[sp]; T = core[rp]; sp++; rp++; core[sp] = t; t = T;
+L0346: GUARD(0x0346, 0x601C); n = core[sp]; pc = core[rp] >> 1; T = t; rp++; t = T; goto dispatch;
+L0347: GUARD(0x0347, 0x4135); core[--rp] = 0x0690; goto L0135;
+L0348: GUARD(0x0348, 0x0337); goto L0337;
+L0349: GUARD(0x0349, 0x8001); core[++sp] = t; t = 0x0001;
+L034A: GUARD(0x034A, 0x42DC); core[--rp] = 0x0696; goto L02DC;
+L034B: GUARD(0x034B, 0x6F03); n = core[sp]; T = -((s_t)n < (s_t)t); sp--; t = T;
+L034C: GUARD(0x034C, 0x4121); core[--rp] = 0x069A; goto L0121;
+L034D: GUARD(0x034D, 0x8004); core[++sp] = t; t = 0x0004;
+L034E: GUARD(0x034E, 0x0347); goto L0347;
+L034F: GUARD(0x034F, 0x0666); goto L0666;
+L0354: GUARD(0x0354, 0x800A); core[++sp] = t; t = 0x000A;
+L0355: GUARD(0x0355, 0x808E); core[++sp] = t; t = 0x008E;
+L0356: GUARD(0x0356, 0x641F); n = core[sp]; pc = core[rp] >> 1; core[(t>>1)%L] = n; T = core[--sp]; dirty = 1; sp--; rp++; t = T; goto dispatch;
+L0357: GUARD(0x0357, 0x069E); goto L069E;
+L035A: GUARD(0x035A, 0x8010); core[++sp] = t; t = 0x0010;
+L035B: GUARD(0x035B, 0x0355); goto L0355;
+L035C: GUARD(0x035C, 0x4117); core[--rp] = 0x06BA; goto L0117;
+L035D: GUARD(0x035D, 0x6081); n = core[sp]; T = t; sp++; core[sp] = t; t = T;
+L035E: GUARD(0x035E, 0x8002); core[++sp] = t; t = 0x0002;
+L035F: GUARD(0x035F, 0x4139); core[--rp] = 0x06C0; goto L0139;
+L0360: GUARD(0x0360, 0x8023); core[++sp] = t; t = 0x0023;
+L0361: GUARD(0x0361, 0x6E03); n = core[sp]; T = -(n < t); sp--; t = T;
+L0362: GUARD(0x0362, 0x4121); core[--rp] = 0x06C6; goto L0121;
+L0363: GUARD(0x0363, 0x4354); core[--rp] = 0x06C8; goto L0354;
+L0364: GUARD(0x0364, 0x8028); core[++sp] = t; t = 0x0028;
+L0365: GUARD(0x0365, 0x0347); goto L0347;
+L0366: GUARD(0x0366, 0x06AE); goto L06AE;
+L036A: GUARD(0x036A, 0x8082); core[++sp] = t; t = 0x0082;
+L036B: GUARD(0x036B, 0x6300); n = core[sp]; T = core[(t>>1)%L]; t = T;
+L036C: GUARD(0x036C, 0x6B00); n = core[sp]; T = t-1; t = T;
+L036D: GUARD(0x036D, 0x6081); n = core[sp]; T = t; sp++; core[sp] = t; t = T;
+L036E: GUARD(0x036E, 0x8082); core[++sp] = t; t = 0x0082;
+L036F: GUARD(0x036F, 0x6403); n = core[sp]; core[(t>>1)%L] = n; T = core[--sp]; dirty = 1; sp--; t = T;
+L0370: GUARD(0x0370, 0x610B); n = core[sp]; core[t >> 1] = (core[t >> 1] & (0xFF00 >> ((t & 1) << 3))) | ((n & 0xFF) << ((t & 1) << 3)); T = core[--sp]; dirty = 1; sp--; t = T;
+L0371: GUARD(0x0371, 0x8082); core[++sp] = t; t = 0x0082;
+L0372: GUARD(0x0372, 0x6300); n = core[sp]; T = core[(t>>1)%L]; t = T;
+L0373: GUARD(0x0373, 0xC100); core[++sp] = t; t = 0x4100;
+L0374: GUARD(0x0374, 0x8080); core[++sp] = t; t = 0x0080;
+L0375: GUARD(0x0375, 0x4139); core[--rp] = 0x06EC; goto L0139;
+L0376: GUARD(0x0376, 0x4170); core[--rp] = 0x06EE; goto L0170;
+L0377: GUARD(0x0377, 0x4121); core[--rp] = 0x06F0; goto L0121;
+L0378: GUARD(0x0378, 0x8011); core[++sp] = t; t = 0x0011;
+L0379: GUARD(0x0379, 0x0347); goto L0347;
+L037A: GUARD(0x037A, 0x6044); n = core[sp]; T = t; rp--; core[rp] = t; t = T;
+L037B: pc = 0x037B; goto fallback;
+L037C: GUARD(0x037C, 0x6240); n = core[sp]; T = core[rp]; core[rp] = t; t = T;
+L037D: pc = 0x037D; goto fallback;
+L037E: GUARD(0x037E, 0x628D); n = core[sp]; T = core[rp]; sp++; rp++; core[sp] = t; t = T;
+L037F: GUARD(0x037F, 0x01E6); goto L01E6;
+L0380: GUARD(0x0380, 0x8009); core[++sp] = t; t = 0x0009;
+L0381: GUARD(0x0381, 0x6181); n = core[sp]; T = n; sp++; core[sp] = t; t = T;
+L0382: GUARD(0x0382, 0x6F03); n = core[sp]; T = -((s_t)n < (s_t)t); sp--; t = T;
+L0383: GUARD(0x0383, 0x8007); core[++sp] = t; t = 0x0007;
+L0384: GUARD(0x0384, 0x6703); n = core[sp]; T = t&n; sp--; t = T;
+L0385: GUARD(0x0385, 0x6523); n = core[sp]; d = (d_t)t + n; T = d >> 16; core[sp] = d; n = d; sp--; t = n;
+L0386: GUARD(0x0386, 0x8030); core[++sp] = t; t = 0x0030;
+L0387: GUARD(0x0387, 0x653F); n = core[sp]; pc = core[rp] >> 1; d = (d_t)t + n; T = d >> 16; core[sp] = d; n = d; sp--; rp++; t = n; goto dispatch;
+L0388: GUARD(0x0388, 0x06CC); goto L06CC;
+L0389: GUARD(0x0389, 0x2302); n = t; t = core[sp--]; if (!n) goto L0302;
+L038A: GUARD(0x038A, 0x003E); goto L003E;
+L038B: GUARD(0x038B, 0x4129); core[--rp] = 0x0718; goto L0129;
+L038C: GUARD(0x038C, 0x8082); core[++sp] = t; t = 0x0082;
+L038D: GUARD(0x038D, 0x6300); n = core[sp]; T = core[(t>>1)%L]; t = T;
+L038E: GUARD(0x038E, 0xC100); core[++sp] = t; t = 0x4100;
+L038F: GUARD(0x038F, 0x013B); goto L013B;
+L0390: GUARD(0x0390, 0x0710); goto L0710;
+L0391: GUARD(0x0391, 0x2301); n = t; t = core[sp--]; if (!n) goto L0301;
+L0392: GUARD(0x0392, 0x8002); core[++sp] = t; t = 0x0002;
+L0393: GUARD(0x0393, 0x434A); core[--rp] = 0x0728; goto L034A;
+L0394: GUARD(0x0394, 0x8000); core[++sp] = t; t = 0x0000;
+L0395: GUARD(0x0395, 0x4117); core[--rp] = 0x072C; goto L0117;
+L0396: GUARD(0x0396, 0x437A); core[--rp] = 0x072E; goto L037A;
+L0397: GUARD(0x0397, 0x4380); core[--rp] = 0x0730; goto L0380;
+L0398: GUARD(0x0398, 0x036A); goto L036A;
+L0399: GUARD(0x0399, 0x0720); goto L0720;
+L039C: GUARD(0x039C, 0x8002); core[++sp] = t; t = 0x0002;
+L039D: GUARD(0x039D, 0x434A); core[--rp] = 0x073C; goto L034A;
+L039E: GUARD(0x039E, 0x8082); core[++sp] = t; t = 0x0082;
+L039F: GUARD(0x039F, 0x6300); n = core[sp]; T = core[(t>>1)%L]; t = T;
+L03A0: GUARD(0x03A0, 0x4117); core[--rp] = 0x0742; goto L0117;
+L03A1: pc = 0x03A1; goto fallback;
+L03A2: GUARD(0x03A2, 0x8082); core[++sp] = t; t = 0x0082;
+L03A3: GUARD(0x03A3, 0x6403); n = core[sp]; core[(t>>1)%L] = n; T = core[--sp]; dirty = 1; sp--; t = T;
+L03A4: GUARD(0x03A4, 0x0371); goto L0371;
+L03A5: GUARD(0x03A5, 0x0732); goto L0732;
+L03A8: GUARD(0x03A8, 0xC100); core[++sp] = t; t = 0x4100;
+L03A9: GUARD(0x03A9, 0x8082); core[++sp] = t; t = 0x0082;
+L03AA: GUARD(0x03AA, 0x641F); n = core[sp]; pc = core[rp] >> 1; core[(t>>1)%L] = n; T = core[--sp]; dirty = 1; sp--; rp++; t = T; goto dispatch;
+L03AB: GUARD(0x03AB, 0x074A); goto L074A;
+L03AF: GUARD(0x03AF, 0x4184); core[--rp] = 0x0760; goto L0184;
+L03B0: GUARD(0x03B0, 0x6C00); n = core[sp]; T = -(t == 0); t = T;
+L03B1: GUARD(0x03B1, 0x4121); core[--rp] = 0x0764; goto L0121;
+L03B2: GUARD(0x03B2, 0x802D); core[++sp] = t; t = 0x002D;
+L03B3: GUARD(0x03B3, 0x036A); goto L036A;
+L03B4: GUARD(0x03B4, 0x6044); n = core[sp]; T = t; rp--; core[rp] = t; t = T;
+L03B5: GUARD(0x03B5, 0x41CE); core[--rp] = 0x076C; goto L01CE;
+L03B6: GUARD(0x03B6, 0x8000); core[++sp] = t; t = 0x0000;
+L03B7: GUARD(0x03B7, 0x43A8); core[--rp] = 0x0770; goto L03A8;
+L03B8: GUARD(0x03B8, 0x439C); core[--rp] = 0x0772; goto L039C;
+L03B9: GUARD(0x03B9, 0x628D); n = core[sp]; T = core[rp]; sp++; rp++; core[sp] = t; t = T;
+L03BA: GUARD(0x03BA, 0x43AF); core[--rp] = 0x0776; goto L03AF;
+L03BB: GUARD(0x03BB, 0x038B); goto L038B;
+L03BC: GUARD(0x03BC, 0x8000); core[++sp] = t; t = 0x0000;
+L03BD: GUARD(0x03BD, 0x43A8); core[--rp] = 0x077C; goto L03A8;
+L03BE: GUARD(0x03BE, 0x439C); core[--rp] = 0x077E; goto L039C;
+L03BF: GUARD(0x03BF, 0x038B); goto L038B;
+L03C0: GUARD(0x03C0, 0x0756); goto L0756;
+L03C3: GUARD(0x03C3, 0x6147); n = core[sp]; T = n; sp--; rp--; core[rp] = t; t = T;
+L03C4: GUARD(0x03C4, 0x43BC); core[--rp] = 0x078A; goto L03BC;
+L03C5: GUARD(0x03C5, 0x628D); n = core[sp]; T = core[rp]; sp++; rp++; core[sp] = t; t = T;
+L03C6: GUARD(0x03C6, 0x413B); core[--rp] = 0x078E; goto L013B;
+L03C7: GUARD(0x03C7, 0x42C7); core[--rp] = 0x0790; goto L02C7;
+L03C8: GUARD(0x03C8, 0x02F7); goto L02F7;
+L03C9: GUARD(0x03C9, 0x6081); n = core[sp]; T = t; sp++; core[sp] = t; t = T;
+L03CA: GUARD(0x03CA, 0x42C6); core[--rp] = 0x0796; goto L02C6;
+L03CB: GUARD(0x03CB, 0x8005); core[++sp] = t; t = 0x0005;
+L03CC: GUARD(0x03CC, 0x03C3); goto L03C3;
+L03CD: GUARD(0x03CD, 0x0780); goto L0780;
+L03D1: GUARD(0x03D1, 0x42C6); core[--rp] = 0x07A4; goto L02C6;
+L03D2: GUARD(0x03D2, 0x02F7); goto L02F7;
+L03D3: GUARD(0x03D3, 0x079A); goto L079A;
+L03D4: GUARD(0x03D4, 0x2E01); n = t; t = core[sp--]; if (!n) pc = 0x0E01; goto dispatch;
+L03D5: GUARD(0x03D5, 0x43B4); core[--rp] = 0x07AC; goto L03B4;
+L03D6: GUARD(0x03D6, 0x03D1); goto L03D1;
+L03D7: GUARD(0x03D7, 0x8002); core[++sp] = t; t = 0x0002;
+L03D8: GUARD(0x03D8, 0x4135); core[--rp] = 0x07B2; goto L0135;
+L03D9: GUARD(0x03D9, 0x671F); n = core[sp]; pc = core[rp] >> 1; T = t&n; sp--; rp++; t = T; goto dispatch;
+L03DA: GUARD(0x03DA, 0x0558); goto L0558;
+L03DE: GUARD(0x03DE, 0x4144); core[--rp] = 0x07BE; goto L0144;
+L03DF: GUARD(0x03DF, 0x6044); n = core[sp]; T = t; rp--; core[rp] = t; t = T;
+L03E0: GUARD(0x03E0, 0x6181); n = core[sp]; T = n; sp++; core[sp] = t; t = T;
+L03E1: GUARD(0x03E1, 0x6081); n = core[sp]; T = t; sp++; core[sp] = t; t = T;
+L03E2: GUARD(0x03E2, 0x43D7); core[--rp] = 0x07C6; goto L03D7;
+L03E3: GUARD(0x03E3, 0x4139); core[--rp] = 0x07C8; goto L0139;
+L03E4: GUARD(0x03E4, 0x413D); core[--rp] = 0x07CA; goto L013D;
+L03E5: GUARD(0x03E5, 0x419A); core[--rp] = 0x07CC; goto L019A;
+L03E6: GUARD(0x03E6, 0x418A); core[--rp] = 0x07CE; goto L018A;
+L03E7: GUARD(0x03E7, 0x610B); n = core[sp]; core[t >> 1] = (core[t >> 1] & (0xFF00 >> ((t & 1) << 3))) | ((n & 0xFF) << ((t & 1) << 3)); T = core[--sp]; dirty = 1; sp--; t = T;
+L03E8: GUARD(0x03E8, 0x412E); core[--rp] = 0x07D2; goto L012E;
+L03E9: GUARD(0x03E9, 0x6180); n = core[sp]; T = n; core[sp] = t; t = T;
+L03EA: pc = 0x03EA; goto fallback;
+L03EB: GUARD(0x03EB, 0x628D); n = core[sp]; T = core[rp]; sp++; rp++; core[sp] = t; t = T;
+L03EC: GUARD(0x03EC, 0x601C); n = core[sp]; pc = core[rp] >> 1; T = t; rp++; t = T; goto dispatch;
+L03ED: GUARD(0x03ED, 0x07A6); goto L07A6;
+L03F4: GUARD(0x03F4, 0x6147); n = core[sp]; T = n; sp--; rp--; core[rp] = t; t = T;
+L03F5: GUARD(0x03F5, 0x6181); n = core[sp]; T = n; sp++; core[sp] = t; t = T;
+L03F6: GUARD(0x03F6, 0x6281); n = core[sp]; T = core[rp]; sp++; core[sp] = t; t = T;
+L03F7: GUARD(0x03F7, 0x6F03); n = core[sp]; T = -((s_t)n < (s_t)t); sp--; t = T;
+L03F8: GUARD(0x03F8, 0x6081); n = core[sp]; T = t; sp++; core[sp] = t; t = T;
+L03F9: GUARD(0x03F9, 0x2400); n = t; t = core[sp--]; if (!n) goto L0400;
+L03FA: GUARD(0x03FA, 0x8008); core[++sp] = t; t = 0x0008;
+L03FB: GUARD(0x03FB, 0x6081); n = core[sp]; T = t; sp++; core[sp] = t; t = T;
+L03FC: GUARD(0x03FC, 0x42B3); core[--rp] = 0x07FA; goto L02B3;
+L03FD: GUARD(0x03FD, 0x8020); core[++sp] = t; t = 0x0020;
+L03FE: GUARD(0x03FE, 0x42B3); core[--rp] = 0x07FE; goto L02B3;
+L03FF: GUARD(0x03FF, 0x42B3); core[--rp] = 0x0800; goto L02B3;
+L0400: GUARD(0x0400, 0x628D); n = core[sp]; T = core[rp]; sp++; rp++; core[sp] = t; t = T;
+L0401: GUARD(0x0401, 0x653F); n = core[sp]; pc = core[rp] >> 1; d = (d_t)t + n; T = d >> 16; core[sp] = d; n = d; sp--; rp++; t = n; goto dispatch;
+L0402: GUARD(0x0402, 0x6081); n = core[sp]; T = t; sp++; core[sp] = t; t = T;
+L0403: GUARD(0x0403, 0x42B3); core[--rp] = 0x0808; goto L02B3;
+L0404: GUARD(0x0404, 0x6181); n = core[sp]; T = n; sp++; core[sp] = t; t = T;
+L0405: GUARD(0x0405, 0x610B); n = core[sp]; core[t >> 1] = (core[t >> 1] & (0xFF00 >> ((t & 1) << 3))) | ((n & 0xFF) << ((t & 1) << 3)); T = core[--sp]; dirty = 1; sp--; t = T;
+L0406: GUARD(0x0406, 0x012E); goto L012E;
+L040A: GUARD(0x040A, 0x6180); n = core[sp]; T = n; core[sp] = t; t = T;
+L040B: GUARD(0x040B, 0x807F); core[++sp] = t; t = 0x007F;
+L040C: GUARD(0x040C, 0x6D03); n = core[sp]; T = -(t == n); sp--; t = T;
+L040D: GUARD(0x040D, 0x6803); n = core[sp]; T = t|n; sp--; t = T;
+L040E: GUARD(0x040E, 0x6C1C); n = core[sp]; pc = core[rp] >> 1; T = -(t == 0); rp++; t = T; goto dispatch;
+L0414: GUARD(0x0414, 0x2417); n = t; t = core[sp--]; if (!n) goto L0417;
+L0415: GUARD(0x0415, 0x8020); core[++sp] = t; t = 0x0020;
+L0416: GUARD(0x0416, 0x0402); goto L0402;
+L0417: GUARD(0x0417, 0x03F4); goto L03F4;
+L0418: GUARD(0x0418, 0x6103); n = core[sp]; T = n; sp--; t = T;
+L0419: GUARD(0x0419, 0x6003); n = core[sp]; T = t; sp--; t = T;
+L041A: GUARD(0x041A, 0x609D); n = core[sp]; pc = core[rp] >> 1; T = t; sp++; rp++; core[sp] = t; t = T; goto dispatch;
+L041B: GUARD(0x041B, 0x6081); n = core[sp]; T = t; sp++; core[sp] = t; t = T;
+L041C: GUARD(0x041C, 0x8020); core[++sp] = t; t = 0x0020;
+L041D: GUARD(0x041D, 0x4139); core[--rp] = 0x083C; goto L0139;
+L041E: GUARD(0x041E, 0x8095); core[++sp] = t; t = 0x0095;
+L041F: GUARD(0x041F, 0x6E03); n = core[sp]; T = -(n < t); sp--; t = T;
+L0420: GUARD(0x0420, 0x6180); n = core[sp]; T = n; core[sp] = t; t = T;
+L0421: GUARD(0x0421, 0x807F); core[++sp] = t; t = 0x007F;
+L0422: GUARD(0x0422, 0x4175); core[--rp] = 0x0846; goto L0175;
+L0423: GUARD(0x0423, 0x671F); n = core[sp]; pc = core[rp] >> 1; T = t&n; sp--; rp++; t = T; goto dispatch;
+L0424: GUARD(0x0424, 0x411D); core[--rp] = 0x084A; goto L011D;
+L0425: GUARD(0x0425, 0x8002); core[++sp] = t; t = 0x0002;
+L0426: GUARD(0x0426, 0x6703); n = core[sp]; T = t&n; sp--; t = T;
+L0427: GUARD(0x0427, 0x017A); goto L017A;
+L0428: GUARD(0x0428, 0x07DA); goto L07DA;
+L042F: GUARD(0x042F, 0x6981); n = core[sp]; T = t^n; sp++; core[sp] = t; t = T;
+L0430: GUARD(0x0430, 0x2449); n = t; t = core[sp--]; if (!n) goto L0449;
+L0431: GUARD(0x0431, 0x6147); n = core[sp]; T = n; sp--; rp--; core[rp] = t; t = T;
+L0432: GUARD(0x0432, 0x4268); core[--rp] = 0x0866; goto L0268;
+L0433: GUARD(0x0433, 0x4282); core[--rp] = 0x0868; goto L0282;
+L0434: GUARD(0x0434, 0x426D); core[--rp] = 0x086A; goto L026D;
+L0435: GUARD(0x0435, 0x41E6); core[--rp] = 0x086C; goto L01E6;
+L0436: GUARD(0x0436, 0x628D); n = core[sp]; T = core[rp]; sp++; rp++; core[sp] = t; t = T;
+L0437: GUARD(0x0437, 0x6180); n = core[sp]; T = n; core[sp] = t; t = T;
+L0438: GUARD(0x0438, 0x6081); n = core[sp]; T = t; sp++; core[sp] = t; t = T;
+L0439: GUARD(0x0439, 0x4424); core[--rp] = 0x0874; goto L0424;
+L043A: GUARD(0x043A, 0x2442); n = t; t = core[sp--]; if (!n) goto L0442;
+L043B: GUARD(0x043B, 0x441B); core[--rp] = 0x0878; goto L041B;
+L043C: GUARD(0x043C, 0x243F); n = t; t = core[sp--]; if (!n) goto L043F;
+L043D: GUARD(0x043D, 0x4402); core[--rp] = 0x087C; goto L0402;
+L043E: GUARD(0x043E, 0x0441); goto L0441;
+L043F: GUARD(0x043F, 0xC016); core[++sp] = t; t = 0x4016;
+L0440: GUARD(0x0440, 0x4245); core[--rp] = 0x0882; goto L0245;
+L0441: GUARD(0x0441, 0x0448); goto L0448;
+L0442: GUARD(0x0442, 0x800A); core[++sp] = t; t = 0x000A;
+L0443: GUARD(0x0443, 0x6903); n = core[sp]; T = t^n; sp--; t = T;
+L0444: GUARD(0x0444, 0x2447); n = t; t = core[sp--]; if (!n) goto L0447;
+L0445: GUARD(0x0445, 0x4402); core[--rp] = 0x088C; goto L0402;
+L0446: GUARD(0x0446, 0x0448); goto L0448;
+L0447: GUARD(0x0447, 0x4418); core[--rp] = 0x0890; goto L0418;
+L0448: GUARD(0x0448, 0x042F); goto L042F;
+L0449: GUARD(0x0449, 0x6103); n = core[sp]; T = n; sp--; t = T;
+L044A: GUARD(0x044A, 0x013B); goto L013B;
+L044B: GUARD(0x044B, 0x0850); goto L0850;
+L0455: GUARD(0x0455, 0x0896); goto L0896;
+L0459: GUARD(0x0459, 0x41D9); core[--rp] = 0x08B4; goto L01D9;
+L045A: GUARD(0x045A, 0x8050); core[++sp] = t; t = 0x0050;
+L045B: GUARD(0x045B, 0xC014); core[++sp] = t; t = 0x4014;
+L045C: GUARD(0x045C, 0x4245); core[--rp] = 0x08BA; goto L0245;
+L045D: GUARD(0x045D, 0xC02A); core[++sp] = t; t = 0x402A;
+L045E: GUARD(0x045E, 0x6403); n = core[sp]; core[(t>>1)%L] = n; T = core[--sp]; dirty = 1; sp--; t = T;
+L045F: GUARD(0x045F, 0x410E); core[--rp] = 0x08C0; goto L010E;
+L0460: GUARD(0x0460, 0x806C); core[++sp] = t; t = 0x006C;
+L0461: GUARD(0x0461, 0x641F); n = core[sp]; pc = core[rp] >> 1; core[(t>>1)%L] = n; T = core[--sp]; dirty = 1; sp--; rp++; t = T; goto dispatch;
+L0462: GUARD(0x0462, 0x42A4); core[--rp] = 0x08C6; goto L02A4;
+L0463: GUARD(0x0463, 0x801F); core[++sp] = t; t = 0x001F;
+L0464: GUARD(0x0464, 0x671F); n = core[sp]; pc = core[rp] >> 1; T = t&n; sp--; rp++; t = T; goto dispatch;
+L0465: GUARD(0x0465, 0x07B4); goto L07B4;
+L0468: GUARD(0x0468, 0x0153); goto L0153;
+L0469: GUARD(0x0469, 0x08CA); goto L08CA;
+L046C: GUARD(0x046C, 0x4468); core[--rp] = 0x08DA; goto L0468;
+L046D: GUARD(0x046D, 0x6081); n = core[sp]; T = t; sp++; core[sp] = t; t = T;
+L046E: GUARD(0x046E, 0x6008); n = core[sp]; T = (core[t >> 1] >> ((t & 1) << 3)) & 0xFF; t = T;
+L046F: GUARD(0x046F, 0x4463); core[--rp] = 0x08E0; goto L0463;
+L0470: GUARD(0x0470, 0x6523); n = core[sp]; d = (d_t)t + n; T = d >> 16; core[sp] = d; n = d; sp--; t = n;
+L0471: GUARD(0x0471, 0x4153); core[--rp] = 0x08E4; goto L0153;
+L0472: GUARD(0x0472, 0x03D7); goto L03D7;
+L0473: GUARD(0x0473, 0x4468); core[--rp] = 0x08E8; goto L0468;
+L0474: GUARD(0x0474, 0x4462); core[--rp] = 0x08EA; goto L0462;
+L0475: GUARD(0x0475, 0x42F7); core[--rp] = 0x08EC; goto L02F7;
+L0476: GUARD(0x0476, 0x02C6); goto L02C6;
+L0477: GUARD(0x0477, 0x4468); core[--rp] = 0x08F0; goto L0468;
+L0478: GUARD(0x0478, 0x8040); core[++sp] = t; t = 0x0040;
+L0479: GUARD(0x0479, 0x6180); n = core[sp]; T = n; core[sp] = t; t = T;
+L047A: GUARD(0x047A, 0x6300); n = core[sp]; T = core[(t>>1)%L]; t = T;
+L047B: GUARD(0x047B, 0x6703); n = core[sp]; T = t&n; sp--; t = T;
+L047C: GUARD(0x047C, 0x017A); goto L017A;
+L047D: GUARD(0x047D, 0x4468); core[--rp] = 0x08FC; goto L0468;
+L047E: GUARD(0x047E, 0x8020); core[++sp] = t; t = 0x0020;
+L047F: GUARD(0x047F, 0x0479); goto L0479;
+L0480: GUARD(0x0480, 0x81E6); core[++sp] = t; t = 0x01E6;
+L0481: GUARD(0x0481, 0x8212); core[++sp] = t; t = 0x0212;
+L0482: GUARD(0x0482, 0x01C4); goto L01C4;
+L0483: GUARD(0x0483, 0x6180); n = core[sp]; T = n; core[sp] = t; t = T;
+L0484: GUARD(0x0484, 0x6147); n = core[sp]; T = n; sp--; rp--; core[rp] = t; t = T;
+L0485: GUARD(0x0485, 0x6081); n = core[sp]; T = t; sp++; core[sp] = t; t = T;
+L0486: GUARD(0x0486, 0x6081); n = core[sp]; T = t; sp++; core[sp] = t; t = T;
+L0487: GUARD(0x0487, 0x249B); n = t; t = core[sp--]; if (!n) goto L049B;
+L0488: GUARD(0x0488, 0x6081); n = core[sp]; T = t; sp++; core[sp] = t; t = T;
+L0489: GUARD(0x0489, 0x4468); core[--rp] = 0x0914; goto L0468;
+L048A: GUARD(0x048A, 0x42A4); core[--rp] = 0x0916; goto L02A4;
+L048B: GUARD(0x048B, 0x809F); core[++sp] = t; t = 0x009F;
+L048C: GUARD(0x048C, 0x6703); n = core[sp]; T = t&n; sp--; t = T;
+L048D: GUARD(0x048D, 0x6281); n = core[sp]; T = core[rp]; sp++; core[sp] = t; t = T;
+L048E: GUARD(0x048E, 0x42A4); core[--rp] = 0x091E; goto L02A4;
+L048F: pc = 0x048F; goto fallback;
+L0490: GUARD(0x0490, 0x6C00); n = core[sp]; T = -(t == 0); t = T;
+L0491: GUARD(0x0491, 0x2498); n = t; t = core[sp--]; if (!n) goto L0498;
+L0492: GUARD(0x0492, 0x600C); n = core[sp]; T = t; rp++; t = T;
+L0493: GUARD(0x0493, 0x6081); n = core[sp]; T = t; sp++; core[sp] = t; t = T;
+L0494: GUARD(0x0494, 0x4477); core[--rp] = 0x092A; goto L0477;
+L0495: GUARD(0x0495, 0x8001); core[++sp] = t; t = 0x0001;
+L0496: GUARD(0x0496, 0x6803); n = core[sp]; T = t|n; sp--; t = T;
+L0497: GUARD(0x0497, 0x0135); goto L0135;
+L0498: GUARD(0x0498, 0x6003); n = core[sp]; T = t; sp--; t = T;
+L0499: GUARD(0x0499, 0x6381); n = core[sp]; T = core[(t>>1)%L]; sp++; core[sp] = t; t = T;
+L049A: GUARD(0x049A, 0x0486); goto L0486;
+L049B: GUARD(0x049B, 0x600C); n = core[sp]; T = t; rp++; t = T;
+L049C: GUARD(0x049C, 0x010D); goto L010D;
+L049E: GUARD(0x049E, 0x8036); core[++sp] = t; t = 0x0036;
+L049F: GUARD(0x049F, 0x6300); n = core[sp]; T = core[(t>>1)%L]; t = T;
+L04A0: GUARD(0x04A0, 0x4483); core[--rp] = 0x0942; goto L0483;
+L04A1: GUARD(0x04A1, 0x4165); core[--rp] = 0x0944; goto L0165;
+L04A2: GUARD(0x04A2, 0x24A7); n = t; t = core[sp--]; if (!n) goto L04A7;
+L04A3: GUARD(0x04A3, 0x6147); n = core[sp]; T = n; sp--; rp--; core[rp] = t; t = T;
+L04A4: GUARD(0x04A4, 0x41F0); core[--rp] = 0x094A; goto L01F0;
+L04A5: GUARD(0x04A5, 0x628D); n = core[sp]; T = core[rp]; sp++; rp++; core[sp] = t; t = T;
+L04A6: GUARD(0x04A6, 0x601C); n = core[sp]; pc = core[rp] >> 1; T = t; rp++; t = T; goto dispatch;
+L04A7: GUARD(0x04A7, 0x6147); n = core[sp]; T = n; sp--; rp--; core[rp] = t; t = T;
+L04A8: GUARD(0x04A8, 0xC01A); core[++sp] = t; t = 0x401A;
+L04A9: GUARD(0x04A9, 0x6381); n = core[sp]; T = core[(t>>1)%L]; sp++; core[sp] = t; t = T;
+L04AA: GUARD(0x04AA, 0x24B9); n = t; t = core[sp--]; if (!n) goto L04B9;
+L04AB: GUARD(0x04AB, 0x6381); n = core[sp]; T = core[(t>>1)%L]; sp++; core[sp] = t; t = T;
+L04AC: GUARD(0x04AC, 0x6300); n = core[sp]; T = core[(t>>1)%L]; t = T;
+L04AD: GUARD(0x04AD, 0x6281); n = core[sp]; T = core[rp]; sp++; core[sp] = t; t = T;
+L04AE: GUARD(0x04AE, 0x6180); n = core[sp]; T = n; core[sp] = t; t = T;
+L04AF: GUARD(0x04AF, 0x4483); core[--rp] = 0x0960; goto L0483;
+L04B0: GUARD(0x04B0, 0x4165); core[--rp] = 0x0962; goto L0165;
+L04B1: GUARD(0x04B1, 0x24B7); n = t; t = core[sp--]; if (!n) goto L04B7;
+L04B2: GUARD(0x04B2, 0x6147); n = core[sp]; T = n; sp--; rp--; core[rp] = t; t = T;
+L04B3: GUARD(0x04B3, 0x41F0); core[--rp] = 0x0968; goto L01F0;
+L04B4: GUARD(0x04B4, 0x628D); n = core[sp]; T = core[rp]; sp++; rp++; core[sp] = t; t = T;
+L04B5: GUARD(0x04B5, 0x600C); n = core[sp]; T = t; rp++; t = T;
+L04B6: GUARD(0x04B6, 0x601C); n = core[sp]; pc = core[rp] >> 1; T = t; rp++; t = T; goto dispatch;
+L04B7: GUARD(0x04B7, 0x4153); core[--rp] = 0x0970; goto L0153;
+L04B8: GUARD(0x04B8, 0x04A9); goto L04A9;
+L04B9: GUARD(0x04B9, 0x410E); core[--rp] = 0x0974; goto L010E;
+L04BA: GUARD(0x04BA, 0x628D); n = core[sp]; T = core[rp]; sp++; rp++; core[sp] = t; t = T;
+L04BB: GUARD(0x04BB, 0x010F); goto L010F;
+L04BC: GUARD(0x04BC, 0x08AA); goto L08AA;
+L04C4: GUARD(0x04C4, 0x7473); n = core[sp]; pc = core[rp] >> 1; sp = t >> 1; sp--; core[rp] = t; t = n; goto dispatch;
+L04C5: GUARD(0x04C5, 0x4483); core[--rp] = 0x098C; goto L0483;
+L04C6: GUARD(0x04C6, 0x01F0); goto L01F0;
+L04C7: GUARD(0x04C7, 0x0978); goto L0978;
+L04CD: GUARD(0x04CD, 0x098E); goto L098E;
+L04DE: GUARD(0x04DE, 0x24E0); n = t; t = core[sp--]; if (!n) goto L04E0;
+L04DF: GUARD(0x04DF, 0x429E); core[--rp] = 0x09C0; goto L029E;
+L04E0: GUARD(0x04E0, 0x42A9); core[--rp] = 0x09C2; goto L02A9;
+L04E1: GUARD(0x04E1, 0x8024); core[++sp] = t; t = 0x0024;
+L04E2: GUARD(0x04E2, 0x6D03); n = core[sp]; T = -(t == n); sp--; t = T;
+L04E3: GUARD(0x04E3, 0x24E6); n = t; t = core[sp--]; if (!n) goto L04E6;
+L04E4: GUARD(0x04E4, 0x435A); core[--rp] = 0x09CA; goto L035A;
+L04E5: GUARD(0x04E5, 0x429E); core[--rp] = 0x09CC; goto L029E;
+L04E6: GUARD(0x04E6, 0x4268); core[--rp] = 0x09CE; goto L0268;
+L04E7: GUARD(0x04E7, 0x8000); core[++sp] = t; t = 0x0000;
+L04E8: GUARD(0x04E8, 0x6081); n = core[sp]; T = t; sp++; core[sp] = t; t = T;
+L04E9: GUARD(0x04E9, 0x426D); core[--rp] = 0x09D4; goto L026D;
+L04EA: GUARD(0x04EA, 0x4117); core[--rp] = 0x09D6; goto L0117;
+L04EB: pc = 0x04EB; goto fallback;
+L04EC: GUARD(0x04EC, 0x6081); n = core[sp]; T = t; sp++; core[sp] = t; t = T;
+L04ED: GUARD(0x04ED, 0x24FF); n = t; t = core[sp--]; if (!n) goto L04FF;
+L04EE: GUARD(0x04EE, 0x42A9); core[--rp] = 0x09DE; goto L02A9;
+L04EF: GUARD(0x04EF, 0x802E); core[++sp] = t; t = 0x002E;
+L04F0: GUARD(0x04F0, 0x6903); n = core[sp]; T = t^n; sp--; t = T;
+L04F1: GUARD(0x04F1, 0x24F8); n = t; t = core[sp--]; if (!n) goto L04F8;
+L04F2: GUARD(0x04F2, 0x41F0); core[--rp] = 0x09E6; goto L01F0;
+L04F3: GUARD(0x04F3, 0x41E6); core[--rp] = 0x09E8; goto L01E6;
+L04F4: GUARD(0x04F4, 0x628D); n = core[sp]; T = core[rp]; sp++; rp++; core[sp] = t; t = T;
+L04F5: GUARD(0x04F5, 0x410D); core[--rp] = 0x09EC; goto L010D;
+L04F6: GUARD(0x04F6, 0x628D); n = core[sp]; T = core[rp]; sp++; rp++; core[sp] = t; t = T;
+L04F7: GUARD(0x04F7, 0x0355); goto L0355;
+L04F8: GUARD(0x04F8, 0x6B00); n = core[sp]; T = t-1; t = T;
+L04F9: GUARD(0x04F9, 0x80AE); core[++sp] = t; t = 0x00AE;
+L04FA: GUARD(0x04FA, 0x6403); n = core[sp]; core[(t>>1)%L] = n; T = core[--sp]; dirty = 1; sp--; t = T;
+L04FB: GUARD(0x04FB, 0x412E); core[--rp] = 0x09F8; goto L012E;
+L04FC: GUARD(0x04FC, 0x80AE); core[++sp] = t; t = 0x00AE;
+L04FD: GUARD(0x04FD, 0x6300); n = core[sp]; T = core[(t>>1)%L]; t = T;
+L04FE: GUARD(0x04FE, 0x04EA); goto L04EA;
+L04FF: GUARD(0x04FF, 0x4129); core[--rp] = 0x0A00; goto L0129;
+L0500: GUARD(0x0500, 0x628D); n = core[sp]; T = core[rp]; sp++; rp++; core[sp] = t; t = T;
+L0501: GUARD(0x0501, 0x2503); n = t; t = core[sp--]; if (!n) goto L0503;
+L0502: GUARD(0x0502, 0x6D08); n = core[sp]; d = 0u - (((d_t)t << 16) | n); core[sp] = d; T = d >> 16; t = T;
+L0503: GUARD(0x0503, 0x628D); n = core[sp]; T = core[rp]; sp++; rp++; core[sp] = t; t = T;
+L0504: GUARD(0x0504, 0x4355); core[--rp] = 0x0A0A; goto L0355;
+L0505: GUARD(0x0505, 0x0109); goto L0109;
+L0506: GUARD(0x0506, 0x6147); n = core[sp]; T = n; sp--; rp--; core[rp] = t; t = T;
+L0507: GUARD(0x0507, 0x6181); n = core[sp]; T = n; sp++; core[sp] = t; t = T;
+L0508: GUARD(0x0508, 0x41EE); core[--rp] = 0x0A12; goto L01EE;
+L0509: GUARD(0x0509, 0x6281); n = core[sp]; T = core[rp]; sp++; core[sp] = t; t = T;
+L050A: pc = 0x050A; goto fallback;
+L050B: GUARD(0x050B, 0x418A); core[--rp] = 0x0A18; goto L018A;
+L050C: GUARD(0x050C, 0x628D); n = core[sp]; T = core[rp]; sp++; rp++; core[sp] = t; t = T;
+L050D: pc = 0x050D; goto fallback;
+L050E: GUARD(0x050E, 0x6103); n = core[sp]; T = n; sp--; t = T;
+L050F: GUARD(0x050F, 0x6003); n = core[sp]; T = t; sp--; t = T;
+L0510: GUARD(0x0510, 0x6044); n = core[sp]; T = t; rp--; core[rp] = t; t = T;
+L0511: GUARD(0x0511, 0x6181); n = core[sp]; T = n; sp++; core[sp] = t; t = T;
+L0512: GUARD(0x0512, 0x4139); core[--rp] = 0x0A26; goto L0139;
+L0513: GUARD(0x0513, 0x41E6); core[--rp] = 0x0A28; goto L01E6;
+L0514: GUARD(0x0514, 0x628D); n = core[sp]; T = core[rp]; sp++; rp++; core[sp] = t; t = T;
+L0515: GUARD(0x0515, 0x6180); n = core[sp]; T = n; core[sp] = t; t = T;
+L0516: GUARD(0x0516, 0x4139); core[--rp] = 0x0A2E; goto L0139;
+L0517: GUARD(0x0517, 0x012E); goto L012E;
+L0518: GUARD(0x0518, 0x099A); goto L099A;
+L051C: GUARD(0x051C, 0x6147); n = core[sp]; T = n; sp--; rp--; core[rp] = t; t = T;
+L051D: GUARD(0x051D, 0x41D9); core[--rp] = 0x0A3C; goto L01D9;
+L051E: GUARD(0x051E, 0x4115); core[--rp] = 0x0A3E; goto L0115;
+L051F: GUARD(0x051F, 0x6523); n = core[sp]; d = (d_t)t + n; T = d >> 16; core[sp] = d; n = d; sp--; t = n;
+L0520: GUARD(0x0520, 0xC02A); core[++sp] = t; t = 0x402A;
+L0521: GUARD(0x0521, 0x6300); n = core[sp]; T = core[(t>>1)%L]; t = T;
+L0522: GUARD(0x0522, 0x4115); core[--rp] = 0x0A46; goto L0115;
+L0523: GUARD(0x0523, 0x4139); core[--rp] = 0x0A48; goto L0139;
+L0524: GUARD(0x0524, 0x8000); core[++sp] = t; t = 0x0000;
+L0525: GUARD(0x0525, 0x427C); core[--rp] = 0x0A4C; goto L027C;
+L0526: GUARD(0x0526, 0x6281); n = core[sp]; T = core[rp]; sp++; core[sp] = t; t = T;
+L0527: GUARD(0x0527, 0x4506); core[--rp] = 0x0A50; goto L0506;
+L0528: GUARD(0x0528, 0x806C); core[++sp] = t; t = 0x006C;
+L0529: GUARD(0x0529, 0x4195); core[--rp] = 0x0A54; goto L0195;
+L052A: GUARD(0x052A, 0x628D); n = core[sp]; T = core[rp]; sp++; rp++; core[sp] = t; t = T;
+L052B: GUARD(0x052B, 0x8020); core[++sp] = t; t = 0x0020;
+L052C: GUARD(0x052C, 0x6D03); n = core[sp]; T = -(t == n); sp--; t = T;
+L052D: GUARD(0x052D, 0x252F); n = t; t = core[sp--]; if (!n) goto L052F;
+L052E: pc = 0x052E; goto fallback;
+L052F: GUARD(0x052F, 0x8000); core[++sp] = t; t = 0x0000;
+L0530: GUARD(0x0530, 0x027C); goto L027C;
+L0531: GUARD(0x0531, 0x0A30); goto L0A30;
+L0534: GUARD(0x0534, 0x0A62); goto L0A62;
+L0539: GUARD(0x0539, 0x0A68); goto L0A68;
+L053F: GUARD(0x053F, 0x0A72); goto L0A72;
+L0540: GUARD(0x0540, 0x5C41); core[--rp] = 0x0A82; pc = 0x1C41; goto dispatch;
+L0541: GUARD(0x0541, 0xC02A); core[++sp] = t; t = 0x402A;
+L0542: GUARD(0x0542, 0x6300); n = core[sp]; T = core[(t>>1)%L]; t = T;
+L0543: GUARD(0x0543, 0x0460); goto L0460;
+L0544: GUARD(0x0544, 0x6081); n = core[sp]; T = t; sp++; core[sp] = t; t = T;
+L0545: GUARD(0x0545, 0x8040); core[++sp] = t; t = 0x0040;
+L0546: GUARD(0x0546, 0x6E03); n = core[sp]; T = -(n < t); sp--; t = T;
+L0547: GUARD(0x0547, 0x4121); core[--rp] = 0x0A90; goto L0121;
+L0548: GUARD(0x0548, 0x8013); core[++sp] = t; t = 0x0013;
+L0549: GUARD(0x0549, 0x0347); goto L0347;
+L054A: GUARD(0x054A, 0x0A7E); goto L0A7E;
+L054D: GUARD(0x054D, 0x0064); goto L0064;
+L054E: GUARD(0x054E, 0x4349); core[--rp] = 0x0A9E; goto L0349;
+L054F: GUARD(0x054F, 0x451C); core[--rp] = 0x0AA0; goto L051C;
+L0550: GUARD(0x0550, 0x4544); core[--rp] = 0x0AA2; goto L0544;
+L0551: GUARD(0x0551, 0x4258); core[--rp] = 0x0AA4; goto L0258;
+L0552: GUARD(0x0552, 0x03DE); goto L03DE;
+L0553: GUARD(0x0553, 0x8020); core[++sp] = t; t = 0x0020;
+L0554: GUARD(0x0554, 0x054E); goto L054E;
+L0555: GUARD(0x0555, 0x0A94); goto L0A94;
+L0558: GUARD(0x0558, 0x0072); goto L0072;
+L055E: GUARD(0x055E, 0x6081); n = core[sp]; T = t; sp++; core[sp] = t; t = T;
+L055F: GUARD(0x055F, 0xBFFF); core[++sp] = t; t = 0x3FFF;
+L0560: GUARD(0x0560, 0x6E03); n = core[sp]; T = -(n < t); sp--; t = T;
+L0561: GUARD(0x0561, 0x4121); core[--rp] = 0x0AC4; goto L0121;
+L0562: GUARD(0x0562, 0x8008); core[++sp] = t; t = 0x0008;
+L0563: GUARD(0x0563, 0x0347); goto L0347;
+L0564: GUARD(0x0564, 0x0AAA); goto L0AAA;
+L0566: GUARD(0x0566, 0x4258); core[--rp] = 0x0ACE; goto L0258;
+L0567: GUARD(0x0567, 0x6081); n = core[sp]; T = t; sp++; core[sp] = t; t = T;
+L0568: GUARD(0x0568, 0x4153); core[--rp] = 0x0AD2; goto L0153;
+L0569: GUARD(0x0569, 0x455E); core[--rp] = 0x0AD4; goto L055E;
+L056A: GUARD(0x056A, 0x425F); core[--rp] = 0x0AD6; goto L025F;
+L056B: GUARD(0x056B, 0x641F); n = core[sp]; pc = core[rp] >> 1; core[(t>>1)%L] = n; T = core[--sp]; dirty = 1; sp--; rp++; t = T; goto dispatch;
+L056C: GUARD(0x056C, 0x0AC8); goto L0AC8;
+L0574: GUARD(0x0574, 0x410B); core[--rp] = 0x0AEA; goto L010B;
+L0575: GUARD(0x0575, 0x6803); n = core[sp]; T = t|n; sp--; t = T;
+L0576: GUARD(0x0576, 0x0566); goto L0566;
+L0577: GUARD(0x0577, 0x0AD8); pc = 0x0AD8; goto dispatch;
+L057C: GUARD(0x057C, 0x6081); n = core[sp]; T = t; sp++; core[sp] = t; t = T;
+L057D: GUARD(0x057D, 0x410B); core[--rp] = 0x0AFC; goto L010B;
+L057E: GUARD(0x057E, 0x6703); n = core[sp]; T = t&n; sp--; t = T;
+L057F: GUARD(0x057F, 0x2584); n = t; t = core[sp--]; if (!n) goto L0584;
+L0580: GUARD(0x0580, 0x6A00); n = core[sp]; T = ~t; t = T;
+L0581: GUARD(0x0581, 0x4574); core[--rp] = 0x0B04; goto L0574;
+L0582: GUARD(0x0582, 0xEA00); core[++sp] = t; t = 0x6A00;
+L0583: GUARD(0x0583, 0x0566); goto L0566;
+L0584: GUARD(0x0584, 0x0574); goto L0574;
+L0585: GUARD(0x0585, 0x415F); core[--rp] = 0x0B0C; goto L015F;
+L0586: GUARD(0x0586, 0xC000); core[++sp] = t; t = 0x4000;
+L0587: GUARD(0x0587, 0x681F); n = core[sp]; pc = core[rp] >> 1; T = t|n; sp--; rp++; t = T; goto dispatch;
+L0588: GUARD(0x0588, 0x0AEE); pc = 0x0AEE; goto dispatch;
+L058E: GUARD(0x058E, 0x4585); core[--rp] = 0x0B1E; goto L0585;
+L058F: GUARD(0x058F, 0x0566); goto L0566;
+L0598: GUARD(0x0598, 0x41D7); core[--rp] = 0x0B32; goto L01D7;
+L0599: GUARD(0x0599, 0x42F7); core[--rp] = 0x0B34; goto L02F7;
+L059A: GUARD(0x059A, 0x800D); core[++sp] = t; t = 0x000D;
+L059B: GUARD(0x059B, 0x0347); goto L0347;
+L05A4: GUARD(0x05A4, 0x08D2); goto L08D2;
+L05AA: GUARD(0x05AA, 0x4111); core[--rp] = 0x0B56; goto L0111;
+L05AB: GUARD(0x05AB, 0x6C00); n = core[sp]; T = -(t == 0); t = T;
+L05AC: GUARD(0x05AC, 0x4121); core[--rp] = 0x0B5A; goto L0121;
+L05AD: GUARD(0x05AD, 0x057C); goto L057C;
+L05AE: GUARD(0x05AE, 0x0B10); pc = 0x0B10; goto dispatch;
+L05B0: GUARD(0x05B0, 0x746E); n = core[sp]; sp = t >> 1; sp -= 2; rp++; core[rp] = t; t = n;
+L05B1: GUARD(0x05B1, 0x7265); n = core[sp]; T = sp << 1; sp++; rp--; core[rp] = t; t = n;
+L05B2: GUARD(0x05B2, 0x7270); n = core[sp]; pc = core[rp] >> 1; T = sp << 1; core[rp] = t; t = n; goto dispatch;
+L05C0: GUARD(0x05C0, 0x446C); core[--rp] = 0x0B82; goto L046C;
+L05C1: GUARD(0x05C1, 0x0243); goto L0243;
+L05D6: GUARD(0x05D6, 0x0B5C); pc = 0x0B5C; goto dispatch;
+L05E1: GUARD(0x05E1, 0x0BAC); pc = 0x0BAC; goto dispatch;
+L05E6: GUARD(0x05E6, 0x6574); n = core[sp]; pc = core[rp] >> 1; d = (d_t)t + n; T = d >> 16; core[sp] = d; n = d; rp--; core[rp] = t; t = n; goto dispatch;
+L05EA: GUARD(0x05EA, 0x4190); core[--rp] = 0x0BD6; goto L0190;
+L05EB: GUARD(0x05EB, 0x6300); n = core[sp]; T = core[(t>>1)%L]; t = T;
+L05EC: GUARD(0x05EC, 0x6903); n = core[sp]; T = t^n; sp--; t = T;
+L05ED: GUARD(0x05ED, 0x0198); goto L0198;
+L05F2: GUARD(0x05F2, 0x42A4); core[--rp] = 0x0BE6; goto L02A4;
+L05F3: GUARD(0x05F3, 0x653F); n = core[sp]; pc = core[rp] >> 1; d = (d_t)t + n; T = d >> 16; core[sp] = d; n = d; sp--; rp++; t = n; goto dispatch;
+L05F4: GUARD(0x05F4, 0x426D); core[--rp] = 0x0BEA; goto L026D;
+L05F5: GUARD(0x05F5, 0x6081); n = core[sp]; T = t; sp++; core[sp] = t; t = T;
+L05F6: GUARD(0x05F6, 0x45F2); core[--rp] = 0x0BEE; goto L05F2;
+L05F7: GUARD(0x05F7, 0x4144); core[--rp] = 0x0BF0; goto L0144;
+L05F8: GUARD(0x05F8, 0x6147); n = core[sp]; T = n; sp--; rp--; core[rp] = t; t = T;
+L05F9: GUARD(0x05F9, 0x6180); n = core[sp]; T = n; core[sp] = t; t = T;
+L05FA: GUARD(0x05FA, 0x6147); n = core[sp]; T = n; sp--; rp--; core[rp] = t; t = T;
+L05FB: GUARD(0x05FB, 0x601C); n = core[sp]; pc = core[rp] >> 1; T = t; rp++; t = T; goto dispatch;
+L05FC: GUARD(0x05FC, 0x45F4); core[--rp] = 0x0BFA; goto L05F4;
+L05FD: GUARD(0x05FD, 0x601C); n = core[sp]; pc = core[rp] >> 1; T = t; rp++; t = T; goto dispatch;
+L05FE: GUARD(0x05FE, 0x45F4); core[--rp] = 0x0BFE; goto L05F4;
+L05FF: GUARD(0x05FF, 0x0306); goto L0306;
+L0600: GUARD(0x0600, 0x0BC2); pc = 0x0BC2; goto dispatch;
+L0609: GUARD(0x0609, 0x0C00); pc = 0x0C00; goto dispatch;
+L060F: GUARD(0x060F, 0x0C12); pc = 0x0C12; goto dispatch;
+L0614: GUARD(0x0614, 0x4109); core[--rp] = 0x0C2A; goto L0109;
+L0615: GUARD(0x0615, 0x0119); goto L0119;
+L061E: GUARD(0x061E, 0x0C1E); pc = 0x0C1E; goto dispatch;
+L0620: GUARD(0x0620, 0x6F62); n = core[sp]; T = -((s_t)n < (s_t)t); sp -= 2; core[rp] = t; t = n;
+L0621: GUARD(0x0621, 0x7472); n = core[sp]; pc = core[rp] >> 1; sp = t >> 1; sp -= 2; core[rp] = t; t = n; goto dispatch;
+L062C: GUARD(0x062C, 0xC02E); core[++sp] = t; t = 0x402E;
+L062D: GUARD(0x062D, 0xC02A); core[++sp] = t; t = 0x402A;
+L062E: GUARD(0x062E, 0x4153); core[--rp] = 0x0C5E; goto L0153;
+L062F: GUARD(0x062F, 0x6403); n = core[sp]; core[(t>>1)%L] = n; T = core[--sp]; dirty = 1; sp--; t = T;
+L0630: GUARD(0x0630, 0x8000); core[++sp] = t; t = 0x0000;
+L0631: GUARD(0x0631, 0x4460); core[--rp] = 0x0C64; goto L0460;
+L0632: GUARD(0x0632, 0xC006); core[++sp] = t; t = 0x4006;
+L0633: GUARD(0x0633, 0x019A); goto L019A;
+L0634: GUARD(0x0634, 0x8004); core[++sp] = t; t = 0x0004;
+L0635: GUARD(0x0635, 0x411D); core[--rp] = 0x0C6C; goto L011D;
+L0636: GUARD(0x0636, 0x6703); n = core[sp]; T = t&n; sp--; t = T;
+L0637: GUARD(0x0637, 0x017A); goto L017A;
+L0638: GUARD(0x0638, 0x0B48); pc = 0x0B48; goto dispatch;
+L063A: GUARD(0x063A, 0x216F); n = t; t = core[sp--]; if (!n) goto L016F;
+L063B: GUARD(0x063B, 0x462C); core[--rp] = 0x0C78; goto L062C;
+L063C: GUARD(0x063C, 0x81A4); core[++sp] = t; t = 0x01A4;
+L063D: GUARD(0x063D, 0xC010); core[++sp] = t; t = 0x4010;
+L063E: GUARD(0x063E, 0x6403); n = core[sp]; core[(t>>1)%L] = n; T = core[--sp]; dirty = 1; sp--; t = T;
+L063F: GUARD(0x063F, 0x81AC); core[++sp] = t; t = 0x01AC;
+L0640: GUARD(0x0640, 0xC012); core[++sp] = t; t = 0x4012;
+L0641: GUARD(0x0641, 0x6403); n = core[sp]; core[(t>>1)%L] = n; T = core[--sp]; dirty = 1; sp--; t = T;
+L0642: GUARD(0x0642, 0x4634); core[--rp] = 0x0C86; goto L0634;
+L0643: GUARD(0x0643, 0x6C00); n = core[sp]; T = -(t == 0); t = T;
+L0644: GUARD(0x0644, 0x8C4C); core[++sp] = t; t = 0x0C4C;
+L0645: GUARD(0x0645, 0x6703); n = core[sp]; T = t&n; sp--; t = T;
+L0646: GUARD(0x0646, 0x813C); core[++sp] = t; t = 0x013C;
+L0647: GUARD(0x0647, 0x8804); core[++sp] = t; t = 0x0804;
+L0648: GUARD(0x0648, 0x4424); core[--rp] = 0x0C92; goto L0424;
+L0649: GUARD(0x0649, 0x264D); n = t; t = core[sp--]; if (!n) goto L064D;
+L064A: GUARD(0x064A, 0x4129); core[--rp] = 0x0C96; goto L0129;
+L064B: GUARD(0x064B, 0x8572); core[++sp] = t; t = 0x0572;
+L064C: GUARD(0x064C, 0x881E); core[++sp] = t; t = 0x081E;
+L064D: GUARD(0x064D, 0x885A); core[++sp] = t; t = 0x085A;
+L064E: GUARD(0x064E, 0xC014); core[++sp] = t; t = 0x4014;
+L064F: GUARD(0x064F, 0x6403); n = core[sp]; core[(t>>1)%L] = n; T = core[--sp]; dirty = 1; sp--; t = T;
+L0650: GUARD(0x0650, 0xC016); core[++sp] = t; t = 0x4016;
+L0651: GUARD(0x0651, 0x6403); n = core[sp]; core[(t>>1)%L] = n; T = core[--sp]; dirty = 1; sp--; t = T;
+L0652: GUARD(0x0652, 0xC018); core[++sp] = t; t = 0x4018;
+L0653: GUARD(0x0653, 0x6403); n = core[sp]; core[(t>>1)%L] = n; T = core[--sp]; dirty = 1; sp--; t = T;
+L0654: GUARD(0x0654, 0x80E6); core[++sp] = t; t = 0x00E6;
+L0655: GUARD(0x0655, 0x641F); n = core[sp]; pc = core[rp] >> 1; core[(t>>1)%L] = n; T = core[--sp]; dirty = 1; sp--; rp++; t = T; goto dispatch;
+L0658: GUARD(0x0658, 0x0C70); pc = 0x0C70; goto dispatch;
+L0660: GUARD(0x0660, 0x0C3C); pc = 0x0C3C; goto dispatch;
+L0665: GUARD(0x0665, 0x0CC0); pc = 0x0CC0; goto dispatch;
+L0666: GUARD(0x0666, 0x5B41); core[--rp] = 0x0CCE; pc = 0x1B41; goto dispatch;
+L0667: GUARD(0x0667, 0x8078); core[++sp] = t; t = 0x0078;
+L0668: GUARD(0x0668, 0x019A); goto L019A;
+L0669: GUARD(0x0669, 0xC800); core[++sp] = t; t = 0x4800;
+L066A: GUARD(0x066A, 0x741C); n = core[sp]; pc = core[rp] >> 1; sp = t >> 1; rp++; t = T; goto dispatch;
+L066B: GUARD(0x066B, 0x4165); core[--rp] = 0x0CD8; goto L0165;
+L066C: GUARD(0x066C, 0x6C00); n = core[sp]; T = -(t == 0); t = T;
+L066D: GUARD(0x066D, 0x4121); core[--rp] = 0x0CDC; goto L0121;
+L066E: GUARD(0x066E, 0x43D5); core[--rp] = 0x0CDE; goto L03D5;
+L066F: GUARD(0x066F, 0x803F); core[++sp] = t; t = 0x003F;
+L0670: GUARD(0x0670, 0x42B9); core[--rp] = 0x0CE2; goto L02B9;
+L0671: GUARD(0x0671, 0x42BE); core[--rp] = 0x0CE4; goto L02BE;
+L0672: GUARD(0x0672, 0x4669); core[--rp] = 0x0CE6; goto L0669;
+L0673: GUARD(0x0673, 0x462C); core[--rp] = 0x0CE8; goto L062C;
+L0674: GUARD(0x0674, 0x8036); core[++sp] = t; t = 0x0036;
+L0675: GUARD(0x0675, 0x419A); core[--rp] = 0x0CEC; goto L019A;
+L0676: GUARD(0x0676, 0x0667); goto L0667;
+L0682: GUARD(0x0682, 0x0CCA); pc = 0x0CCA; goto dispatch;
+L0686: GUARD(0x0686, 0x4673); core[--rp] = 0x0D0E; goto L0673;
+L0687: GUARD(0x0687, 0x4459); core[--rp] = 0x0D10; goto L0459;
+L0688: GUARD(0x0688, 0x8CEE); core[++sp] = t; t = 0x0CEE;
+L0689: GUARD(0x0689, 0x4321); core[--rp] = 0x0D14; goto L0321;
+L068A: GUARD(0x068A, 0x466B); core[--rp] = 0x0D16; goto L066B;
+L068B: GUARD(0x068B, 0x0687); goto L0687;
+L0699: GUARD(0x0699, 0x0D04); pc = 0x0D04; goto dispatch;
+L069E: GUARD(0x069E, 0x0065); goto L0065;
+L06AE: GUARD(0x06AE, 0xABAD); core[++sp] = t; t = 0x2BAD;
+L06AF: GUARD(0x06AF, 0x6D03); n = core[sp]; T = -(t == n); sp--; t = T;
+L06B0: GUARD(0x06B0, 0x4121); core[--rp] = 0x0D62; goto L0121;
+L06B1: GUARD(0x06B1, 0x8016); core[++sp] = t; t = 0x0016;
+L06B2: GUARD(0x06B2, 0x0347); goto L0347;
+L06C4: GUARD(0x06C4, 0x6081); n = core[sp]; T = t; sp++; core[sp] = t; t = T;
+L06C5: GUARD(0x06C5, 0x6008); n = core[sp]; T = (core[t >> 1] >> ((t & 1) << 3)) & 0xFF; t = T;
+L06C6: GUARD(0x06C6, 0x4121); core[--rp] = 0x0D8E; goto L0121;
+L06C7: GUARD(0x06C7, 0x800A); core[++sp] = t; t = 0x000A;
+L06C8: GUARD(0x06C8, 0x0347); goto L0347;
+L06CC: GUARD(0x06CC, 0x0598); goto L0598;
+L06CF: GUARD(0x06CF, 0x0D32); pc = 0x0D32; goto dispatch;
+L06D6: GUARD(0x06D6, 0x0D9E); pc = 0x0D9E; goto dispatch;
+L06DE: GUARD(0x06DE, 0x0DAC); pc = 0x0DAC; goto dispatch;
+L06ED: GUARD(0x06ED, 0x0DBC); pc = 0x0DBC; goto dispatch;
+L06F9: GUARD(0x06F9, 0x0DDA); pc = 0x0DDA; goto dispatch;
+L0709: GUARD(0x0709, 0x0DF2); pc = 0x0DF2; goto dispatch;
+L070E: GUARD(0x070E, 0x0E12); pc = 0x0E12; goto dispatch;
+L0710: GUARD(0x0710, 0x6167); n = core[sp]; T = n; sp--; rp--; core[rp] = t; t = n;
+L0711: GUARD(0x0711, 0x6E69); n = core[sp]; T = -((sd_t)(((d_t)S(1) << 16) | S(2)) < (sd_t)(((d_t)t << 16) | n)); sp -= 2; sp++; core[rp] = t; t = n;
+L0712: GUARD(0x0712, 0x415F); core[--rp] = 0x0E26; goto L015F;
+L0713: GUARD(0x0713, 0x0566); goto L0566;
+L0714: GUARD(0x0714, 0x0E1C); pc = 0x0E1C; goto dispatch;
+L071B: GUARD(0x071B, 0x4258); core[--rp] = 0x0E38; goto L0258;
+L071C: GUARD(0x071C, 0x010F); goto L010F;
+L071D: GUARD(0x071D, 0x471B); core[--rp] = 0x0E3C; goto L071B;
+L071E: GUARD(0x071E, 0x0712); goto L0712;
+L071F: GUARD(0x071F, 0x0E28); pc = 0x0E28; goto dispatch;
+L0720: GUARD(0x0720, 0x6962); n = core[sp]; T = t^n; sp -= 2; core[rp] = t; t = n;
+L0721: GUARD(0x0721, 0x0066); goto L0066;
+L0724: GUARD(0x0724, 0x0E3E); pc = 0x0E3E; goto dispatch;
+L0728: GUARD(0x0728, 0x4258); core[--rp] = 0x0E52; goto L0258;
+L0729: GUARD(0x0729, 0x415F); core[--rp] = 0x0E54; goto L015F;
+L072A: GUARD(0x072A, 0x6181); n = core[sp]; T = n; sp++; core[sp] = t; t = T;
+L072B: GUARD(0x072B, 0x6300); n = core[sp]; T = core[(t>>1)%L]; t = T;
+L072C: GUARD(0x072C, 0x6803); n = core[sp]; T = t|n; sp--; t = T;
+L072D: GUARD(0x072D, 0x0198); goto L0198;
+L072E: GUARD(0x072E, 0x0E48); pc = 0x0E48; goto dispatch;
+L0732: GUARD(0x0732, 0x471D); core[--rp] = 0x0E66; goto L071D;
+L0733: GUARD(0x0733, 0x6180); n = core[sp]; T = n; core[sp] = t; t = T;
+L0734: GUARD(0x0734, 0x0728); goto L0728;
+L0735: GUARD(0x0735, 0x0E5C); pc = 0x0E5C; goto dispatch;
+L073A: GUARD(0x073A, 0x0E6A); pc = 0x0E6A; goto dispatch;
+L0742: GUARD(0x0742, 0xC002); core[++sp] = t; t = 0x4002;
+L0743: GUARD(0x0743, 0x6300); n = core[sp]; T = core[(t>>1)%L]; t = T;
+L0744: GUARD(0x0744, 0x046C); goto L046C;
+L0745: GUARD(0x0745, 0x0E74); pc = 0x0E74; goto dispatch;
+L074A: GUARD(0x074A, 0x4742); core[--rp] = 0x0E96; goto L0742;
+L074B: GUARD(0x074B, 0x058E); goto L058E;
+L074C: GUARD(0x074C, 0x0E8A); pc = 0x0E8A; goto dispatch;
+L0756: GUARD(0x0756, 0x6403); n = core[sp]; core[(t>>1)%L] = n; T = core[--sp]; dirty = 1; sp--; t = T;
+L0757: GUARD(0x0757, 0x0667); goto L0667;
+L0758: GUARD(0x0758, 0x0E98); pc = 0x0E98; goto dispatch;
+L0763: GUARD(0x0763, 0x0EB0); pc = 0x0EB0; goto dispatch;
+L076B: GUARD(0x076B, 0x0EC6); pc = 0x0EC6; goto dispatch;
+L0774: GUARD(0x0774, 0x0ED6); pc = 0x0ED6; goto dispatch;
+L0780: GUARD(0x0780, 0x0EE8); pc = 0x0EE8; goto dispatch;
+L0788: GUARD(0x0788, 0x0000); goto L0000;
+L0798: GUARD(0x0798, 0x803A); core[++sp] = t; t = 0x003A;
+L0799: GUARD(0x0799, 0x6300); n = core[sp]; T = core[(t>>1)%L]; t = T;
+L079A: GUARD(0x079A, 0x6081); n = core[sp]; T = t; sp++; core[sp] = t; t = T;
+L079B: GUARD(0x079B, 0xC300); core[++sp] = t; t = 0x4300;
+L079C: GUARD(0x079C, 0x80C0); core[++sp] = t; t = 0x00C0;
+L079D: GUARD(0x079D, 0x6523); n = core[sp]; d = (d_t)t + n; T = d >> 16; core[sp] = d; n = d; sp--; t = n;
+L079E: GUARD(0x079E, 0x4170); core[--rp] = 0x0F3E; goto L0170;
+L079F: GUARD(0x079F, 0x27A2); n = t; t = core[sp--]; if (!n) goto L07A2;
+L07A0: GUARD(0x07A0, 0x8008); core[++sp] = t; t = 0x0008;
+L07A1: GUARD(0x07A1, 0x0347); goto L0347;
+L07A2: GUARD(0x07A2, 0x8036); core[++sp] = t; t = 0x0036;
+L07A3: GUARD(0x07A3, 0x6300); n = core[sp]; T = core[(t>>1)%L]; t = T;
+L07A4: GUARD(0x07A4, 0x6181); n = core[sp]; T = n; sp++; core[sp] = t; t = T;
+L07A5: GUARD(0x07A5, 0x6403); n = core[sp]; core[(t>>1)%L] = n; T = core[--sp]; dirty = 1; sp--; t = T;
+L07A6: GUARD(0x07A6, 0x4153); core[--rp] = 0x0F4E; goto L0153;
+L07A7: GUARD(0x07A7, 0x4258); core[--rp] = 0x0F50; goto L0258;
+L07A8: GUARD(0x07A8, 0x6180); n = core[sp]; T = n; core[sp] = t; t = T;
+L07A9: GUARD(0x07A9, 0x425F); core[--rp] = 0x0F54; goto L025F;
+L07AA: GUARD(0x07AA, 0x4553); core[--rp] = 0x0F56; goto L0553;
+L07AB: GUARD(0x07AB, 0x46C4); core[--rp] = 0x0F58; goto L06C4;
+L07AC: GUARD(0x07AC, 0x6180); n = core[sp]; T = n; core[sp] = t; t = T;
+L07AD: GUARD(0x07AD, 0x025F); goto L025F;
+L07B4: GUARD(0x07B4, 0x4121); core[--rp] = 0x0F6A; goto L0121;
+L07B5: GUARD(0x07B5, 0x6103); n = core[sp]; T = n; sp--; t = T;
+L07B6: GUARD(0x07B6, 0x4798); core[--rp] = 0x0F6E; goto L0798;
+L07B7: GUARD(0x07B7, 0x6081); n = core[sp]; T = t; sp++; core[sp] = t; t = T;
+L07B8: GUARD(0x07B8, 0x45FC); core[--rp] = 0x0F72; goto L05FC;
+L07B9: GUARD(0x07B9, 0x3A02); n = t; t = core[sp--]; if (!n) pc = 0x1A02; goto dispatch;
+L07BA: GUARD(0x07BA, 0x007D); goto L007D;
+L07D9: GUARD(0x07D9, 0x0F00); pc = 0x0F00; goto dispatch;
+L07DA: pc = 0x07DA; goto fallback;
+L07DB: GUARD(0x07DB, 0x003A); goto L003A;
+L0803: GUARD(0x0803, 0x0FB2); pc = 0x0FB2; goto dispatch;
+L0819: GUARD(0x0819, 0x1006); pc = 0x1006; goto dispatch;
+L081F: GUARD(0x081F, 0x1032); pc = 0x1032; goto dispatch;
+L0826: GUARD(0x0826, 0x103E); pc = 0x103E; goto dispatch;
+L082D: GUARD(0x082D, 0x0CB0); pc = 0x0CB0; goto dispatch;
+L0836: GUARD(0x0836, 0x105A); pc = 0x105A; goto dispatch;
+L0842: GUARD(0x0842, 0x8000); core[++sp] = t; t = 0x0000;
+L0843: GUARD(0x0843, 0x6147); n = core[sp]; T = n; sp--; rp--; core[rp] = t; t = T;
+L0844: GUARD(0x0844, 0x6381); n = core[sp]; T = core[(t>>1)%L]; sp++; core[sp] = t; t = T;
+L0845: GUARD(0x0845, 0x6281); n = core[sp]; T = core[rp]; sp++; core[sp] = t; t = T;
+L0846: GUARD(0x0846, 0x4175); core[--rp] = 0x108E; goto L0175;
+L0847: GUARD(0x0847, 0x284A); n = t; t = core[sp--]; if (!n) goto L084A;
+L0848: GUARD(0x0848, 0x4153); core[--rp] = 0x1092; goto L0153;
+L0849: GUARD(0x0849, 0x0844); goto L0844;
+L084A: GUARD(0x084A, 0x600C); n = core[sp]; T = t; rp++; t = T;
+L084B: GUARD(0x084B, 0x601C); n = core[sp]; pc = core[rp] >> 1; T = t; rp++; t = T; goto dispatch;
+L084C: GUARD(0x084C, 0x104C); pc = 0x104C; goto dispatch;
+L0850: GUARD(0x0850, 0x6472); n = core[sp]; pc = core[rp] >> 1; core[(t>>1)%L] = n; T = core[--sp]; dirty = 1; sp -= 2; core[rp] = t; t = n; goto dispatch;
+L0852: GUARD(0x0852, 0xC01A); core[++sp] = t; t = 0x401A;
+L0853: GUARD(0x0853, 0x4842); core[--rp] = 0x10A8; goto L0842;
+L0854: GUARD(0x0854, 0x6081); n = core[sp]; T = t; sp++; core[sp] = t; t = T;
+L0855: GUARD(0x0855, 0x414D); core[--rp] = 0x10AC; goto L014D;
+L0856: GUARD(0x0856, 0x6180); n = core[sp]; T = n; core[sp] = t; t = T;
+L0857: GUARD(0x0857, 0xC01A); core[++sp] = t; t = 0x401A;
+L0858: GUARD(0x0858, 0x4139); core[--rp] = 0x10B2; goto L0139;
+L0859: GUARD(0x0859, 0x415F); core[--rp] = 0x10B4; goto L015F;
+L085A: GUARD(0x085A, 0x6044); n = core[sp]; T = t; rp--; core[rp] = t; t = T;
+L085B: GUARD(0x085B, 0x6B00); n = core[sp]; T = t-1; t = T;
+L085C: GUARD(0x085C, 0x41C9); core[--rp] = 0x10BA; goto L01C9;
+L085D: GUARD(0x085D, 0x2860); n = t; t = core[sp--]; if (!n) goto L0860;
+L085E: GUARD(0x085E, 0x8032); core[++sp] = t; t = 0x0032;
+L085F: GUARD(0x085F, 0x0347); goto L0347;
+L0860: GUARD(0x0860, 0x6147); n = core[sp]; T = n; sp--; rp--; core[rp] = t; t = T;
+L0861: GUARD(0x0861, 0x0865); goto L0865;
+L0862: GUARD(0x0862, 0x6381); n = core[sp]; T = core[(t>>1)%L]; sp++; core[sp] = t; t = T;
+L0863: GUARD(0x0863, 0x6180); n = core[sp]; T = n; core[sp] = t; t = T;
+L0864: GUARD(0x0864, 0x414D); core[--rp] = 0x10CA; goto L014D;
+L0865: GUARD(0x0865, 0x7E81); n = core[sp]; if ((T = core[rp])) { core[rp] = T - 1; T = 0; } else { rp++; T = -1; } sp++; core[sp] = t; t = T;
+L0866: GUARD(0x0866, 0x2862); n = t; t = core[sp--]; if (!n) goto L0862;
+L0867: GUARD(0x0867, 0x6300); n = core[sp]; T = core[(t>>1)%L]; t = T;
+L0868: GUARD(0x0868, 0x628D); n = core[sp]; T = core[rp]; sp++; rp++; core[sp] = t; t = T;
+L0869: GUARD(0x0869, 0x601C); n = core[sp]; pc = core[rp] >> 1; T = t; rp++; t = T; goto dispatch;
+L086A: GUARD(0x086A, 0x0000); goto L0000;
+L0873: GUARD(0x0873, 0x8060); core[++sp] = t; t = 0x0060;
+L0874: GUARD(0x0874, 0x601C); n = core[sp]; pc = core[rp] >> 1; T = t; rp++; t = T; goto dispatch;
+L0875: GUARD(0x0875, 0x10D4); pc = 0x10D4; goto dispatch;
+L087C: GUARD(0x087C, 0x10EA); pc = 0x10EA; goto dispatch;
+L0882: GUARD(0x0882, 0x6081); n = core[sp]; T = t; sp++; core[sp] = t; t = T;
+L0883: GUARD(0x0883, 0x4109); core[--rp] = 0x1108; goto L0109;
+L0884: GUARD(0x0884, 0x6D03); n = core[sp]; T = -(t == n); sp--; t = T;
+L0885: GUARD(0x0885, 0x288A); n = t; t = core[sp--]; if (!n) goto L088A;
+L0886: GUARD(0x0886, 0x6103); n = core[sp]; T = n; sp--; t = T;
+L0887: GUARD(0x0887, 0x8032); core[++sp] = t; t = 0x0032;
+L0888: GUARD(0x0888, 0x8001); core[++sp] = t; t = 0x0001;
+L0889: GUARD(0x0889, 0x0882); goto L0882;
+L088A: GUARD(0x088A, 0x6081); n = core[sp]; T = t; sp++; core[sp] = t; t = T;
+L088B: GUARD(0x088B, 0x8008); core[++sp] = t; t = 0x0008;
+L088C: GUARD(0x088C, 0x416B); core[--rp] = 0x111A; goto L016B;
+L088D: GUARD(0x088D, 0x2890); n = t; t = core[sp--]; if (!n) goto L0890;
+L088E: GUARD(0x088E, 0x8031); core[++sp] = t; t = 0x0031;
+L088F: GUARD(0x088F, 0x0347); goto L0347;
+L0890: GUARD(0x0890, 0xC01A); core[++sp] = t; t = 0x401A;
+L0891: GUARD(0x0891, 0x6180); n = core[sp]; T = n; core[sp] = t; t = T;
+L0892: GUARD(0x0892, 0x6147); n = core[sp]; T = n; sp--; rp--; core[rp] = t; t = T;
+L0893: GUARD(0x0893, 0x0897); goto L0897;
+L0894: GUARD(0x0894, 0x4190); core[--rp] = 0x112A; goto L0190;
+L0895: GUARD(0x0895, 0x6403); n = core[sp]; core[(t>>1)%L] = n; T = core[--sp]; dirty = 1; sp--; t = T;
+L0896: GUARD(0x0896, 0x4153); core[--rp] = 0x112E; goto L0153;
+L0897: GUARD(0x0897, 0x7E81); n = core[sp]; if ((T = core[rp])) { core[rp] = T - 1; T = 0; } else { rp++; T = -1; } sp++; core[sp] = t; t = T;
+L0898: GUARD(0x0898, 0x2894); n = t; t = core[sp--]; if (!n) goto L0894;
+L0899: GUARD(0x0899, 0x019A); goto L019A;
+L089A: GUARD(0x089A, 0x10F8); pc = 0x10F8; goto dispatch;
+L089E: GUARD(0x089E, 0x8032); core[++sp] = t; t = 0x0032;
+L089F: GUARD(0x089F, 0x4873); core[--rp] = 0x1140; goto L0873;
+L08A0: GUARD(0x08A0, 0x8002); core[++sp] = t; t = 0x0002;
+L08A1: GUARD(0x08A1, 0x0882); goto L0882;
+L08A2: GUARD(0x08A2, 0x4468); core[--rp] = 0x1146; goto L0468;
+L08A3: GUARD(0x08A3, 0x6008); n = core[sp]; T = (core[t >> 1] >> ((t & 1) << 3)) & 0xFF; t = T;
+L08A4: GUARD(0x08A4, 0x8080); core[++sp] = t; t = 0x0080;
+L08A5: GUARD(0x08A5, 0x6703); n = core[sp]; T = t&n; sp--; t = T;
+L08A6: GUARD(0x08A6, 0x6C1C); n = core[sp]; pc = core[rp] >> 1; T = -(t == 0); rp++; t = T; goto dispatch;
+L08A7: GUARD(0x08A7, 0x4165); core[--rp] = 0x1150; goto L0165;
+L08A8: GUARD(0x08A8, 0x28B0); n = t; t = core[sp--]; if (!n) goto L08B0;
+L08A9: GUARD(0x08A9, 0x6081); n = core[sp]; T = t; sp++; core[sp] = t; t = T;
+L08AA: GUARD(0x08AA, 0x48A2); core[--rp] = 0x1156; goto L08A2;
+L08AB: GUARD(0x08AB, 0x28AE); n = t; t = core[sp--]; if (!n) goto L08AE;
+L08AC: GUARD(0x08AC, 0x6081); n = core[sp]; T = t; sp++; core[sp] = t; t = T;
+L08AD: GUARD(0x08AD, 0x4473); core[--rp] = 0x115C; goto L0473;
+L08AE: GUARD(0x08AE, 0x6300); n = core[sp]; T = core[(t>>1)%L]; t = T;
+L08AF: GUARD(0x08AF, 0x08A7); goto L08A7;
+L08B0: GUARD(0x08B0, 0x02BE); goto L02BE;
+L08B1: GUARD(0x08B1, 0x1134); pc = 0x1134; goto dispatch;
+L08C2: GUARD(0x08C2, 0x1098); pc = 0x1098; goto dispatch;
+L08C8: GUARD(0x08C8, 0x1184); pc = 0x1184; goto dispatch;
+L08CA: GUARD(0x08CA, 0x6665); n = core[sp]; d = (d_t)t * n; T = d >> 16; core[sp] = d; n = d; sp++; rp--; core[rp] = t; t = n;
+L08CB: GUARD(0x08CB, 0x6E69); n = core[sp]; T = -((sd_t)(((d_t)S(1) << 16) | S(2)) < (sd_t)(((d_t)t << 16) | n)); sp -= 2; sp++; core[rp] = t; t = n;
+L08CC: GUARD(0x08CC, 0x7469); n = core[sp]; T = core[(m_t)(core[6] - 1 - t) % L]; sp++; core[rp] = t; t = n;
+L08CD: GUARD(0x08CD, 0x6F69); n = core[sp]; d = (sd_t)(s_t)n * (s_t)t; core[sp] = d; T = d >> 16; sp++; core[rp] = t; t = n;
+L08CE: GUARD(0x08CE, 0x736E); n = core[sp]; T = rp << 1; sp -= 2; rp++; core[rp] = t; t = n;
+L08CF: GUARD(0x08CF, 0xC01A); core[++sp] = t; t = 0x401A;
+L08D0: GUARD(0x08D0, 0x6300); n = core[sp]; T = core[(t>>1)%L]; t = T;
+L08D1: GUARD(0x08D1, 0x01B8); goto L01B8;
+L08D2: GUARD(0x08D2, 0x6081); n = core[sp]; T = t; sp++; core[sp] = t; t = T;
+L08D3: GUARD(0x08D3, 0x28E0); n = t; t = core[sp--]; if (!n) goto L08E0;
+L08D4: GUARD(0x08D4, 0x6B00); n = core[sp]; T = t-1; t = T;
+L08D5: GUARD(0x08D5, 0x6180); n = core[sp]; T = n; core[sp] = t; t = T;
+L08D6: GUARD(0x08D6, 0x6147); n = core[sp]; T = n; sp--; rp--; core[rp] = t; t = T;
+L08D7: GUARD(0x08D7, 0x48D2); core[--rp] = 0x11B0; goto L08D2;
+L08D8: GUARD(0x08D8, 0x6181); n = core[sp]; T = n; sp++; core[sp] = t; t = T;
+L08D9: GUARD(0x08D9, 0x6281); n = core[sp]; T = core[rp]; sp++; core[sp] = t; t = T;
+L08DA: GUARD(0x08DA, 0x6903); n = core[sp]; T = t^n; sp--; t = T;
+L08DB: GUARD(0x08DB, 0x28DF); n = t; t = core[sp--]; if (!n) goto L08DF;
+L08DC: GUARD(0x08DC, 0x412E); core[--rp] = 0x11BA; goto L012E;
+L08DD: GUARD(0x08DD, 0x628D); n = core[sp]; T = core[rp]; sp++; rp++; core[sp] = t; t = T;
+L08DE: GUARD(0x08DE, 0x01EE); goto L01EE;
+L08DF: GUARD(0x08DF, 0x600C); n = core[sp]; T = t; rp++; t = T;
+L08E0: GUARD(0x08E0, 0x601C); n = core[sp]; pc = core[rp] >> 1; T = t; rp++; t = T; goto dispatch;
+L08E1: GUARD(0x08E1, 0x1190); pc = 0x1190; goto dispatch;
+L08EA: GUARD(0x08EA, 0x11C2); pc = 0x11C2; goto dispatch;
+L08F6: GUARD(0x08F6, 0x11D4); pc = 0x11D4; goto dispatch;
+L08FD: GUARD(0x08FD, 0x11EC); pc = 0x11EC; goto dispatch;
+L0909: GUARD(0x0909, 0x11FA); pc = 0x11FA; goto dispatch;
+L0911: GUARD(0x0911, 0x1212); pc = 0x1212; goto dispatch;
+L091C: GUARD(0x091C, 0x1222); pc = 0x1222; goto dispatch;
+L0920: GUARD(0x0920, 0x4349); core[--rp] = 0x1242; goto L0349;
+L0921: GUARD(0x0921, 0x6081); n = core[sp]; T = t; sp++; core[sp] = t; t = T;
+L0922: GUARD(0x0922, 0x803F); core[++sp] = t; t = 0x003F;
+L0923: GUARD(0x0923, 0x4170); core[--rp] = 0x1248; goto L0170;
+L0924: GUARD(0x0924, 0x2927); n = t; t = core[sp--]; if (!n) goto L0927;
+L0925: GUARD(0x0925, 0x8023); core[++sp] = t; t = 0x0023;
+L0926: GUARD(0x0926, 0x0347); goto L0347;
+L0927: GUARD(0x0927, 0x6081); n = core[sp]; T = t; sp++; core[sp] = t; t = T;
+L0928: GUARD(0x0928, 0x80A4); core[++sp] = t; t = 0x00A4;
+L0929: GUARD(0x0929, 0x6403); n = core[sp]; core[(t>>1)%L] = n; T = core[--sp]; dirty = 1; sp--; t = T;
+L092A: GUARD(0x092A, 0x800A); core[++sp] = t; t = 0x000A;
+L092B: GUARD(0x092B, 0x711F); n = core[sp]; pc = core[rp] >> 1; T = n << t; sp--; rp++; t = T; goto dispatch;
+L0938: GUARD(0x0938, 0x1238); pc = 0x1238; goto dispatch;
+L0952: GUARD(0x0952, 0x4920); core[--rp] = 0x12A6; goto L0920;
+L0953: GUARD(0x0953, 0x611F); n = core[sp]; pc = core[rp] >> 1; T = n; sp--; rp++; t = T; goto dispatch;
+L0954: GUARD(0x0954, 0x1270); pc = 0x1270; goto dispatch;
+L096C: GUARD(0x096C, 0x8026); core[++sp] = t; t = 0x0026;
+L096D: GUARD(0x096D, 0x6300); n = core[sp]; T = core[(t>>1)%L]; t = T;
+L096E: GUARD(0x096E, 0x4113); core[--rp] = 0x12DE; goto L0113;
+L096F: GUARD(0x096F, 0x6C1C); n = core[sp]; pc = core[rp] >> 1; T = -(t == 0); rp++; t = T; goto dispatch;
+L0970: GUARD(0x0970, 0x8001); core[++sp] = t; t = 0x0001;
+L0971: GUARD(0x0971, 0x8026); core[++sp] = t; t = 0x0026;
+L0972: GUARD(0x0972, 0x05EA); goto L05EA;
+L0973: GUARD(0x0973, 0x496C); core[--rp] = 0x12E8; goto L096C;
+L0974: GUARD(0x0974, 0x2976); n = t; t = core[sp--]; if (!n) goto L0976;
+L0975: GUARD(0x0975, 0x010F); goto L010F;
+L0976: GUARD(0x0976, 0x801E); core[++sp] = t; t = 0x001E;
+L0977: GUARD(0x0977, 0x6300); n = core[sp]; T = core[(t>>1)%L]; t = T;
+L0978: GUARD(0x0978, 0x4258); core[--rp] = 0x12F2; goto L0258;
+L0979: GUARD(0x0979, 0x6903); n = core[sp]; T = t^n; sp--; t = T;
+L097A: GUARD(0x097A, 0x297D); n = t; t = core[sp--]; if (!n) goto L097D;
+L097B: GUARD(0x097B, 0x8002); core[++sp] = t; t = 0x0002;
+L097C: GUARD(0x097C, 0x601C); n = core[sp]; pc = core[rp] >> 1; T = t; rp++; t = T; goto dispatch;
+L097D: GUARD(0x097D, 0x8020); core[++sp] = t; t = 0x0020;
+L097E: GUARD(0x097E, 0x6300); n = core[sp]; T = core[(t>>1)%L]; t = T;
+L097F: GUARD(0x097F, 0x8020); core[++sp] = t; t = 0x0020;
+L0980: GUARD(0x0980, 0x419A); core[--rp] = 0x1302; goto L019A;
+L0981: GUARD(0x0981, 0x8000); core[++sp] = t; t = 0x0000;
+L0982: GUARD(0x0982, 0x4258); core[--rp] = 0x1306; goto L0258;
+L0983: GUARD(0x0983, 0x6A0B); n = core[sp]; T = embed_crc(h, n, t); sp--; t = T;
+L0984: GUARD(0x0984, 0x6903); n = core[sp]; T = t^n; sp--; t = T;
+L0985: GUARD(0x0985, 0x2988); n = t; t = core[sp--]; if (!n) goto L0988;
+L0986: GUARD(0x0986, 0x8003); core[++sp] = t; t = 0x0003;
+L0987: GUARD(0x0987, 0x601C); n = core[sp]; pc = core[rp] >> 1; T = t; rp++; t = T; goto dispatch;
+L0988: GUARD(0x0988, 0x4970); core[--rp] = 0x1312; goto L0970;
+L0989: GUARD(0x0989, 0x010F); goto L010F;
+L098A: GUARD(0x098A, 0x4973); core[--rp] = 0x1316; goto L0973;
+L098B: GUARD(0x098B, 0x4165); core[--rp] = 0x1318; goto L0165;
+L098C: GUARD(0x098C, 0x2990); n = t; t = core[sp--]; if (!n) goto L0990;
+L098D: GUARD(0x098D, 0x4135); core[--rp] = 0x131C; goto L0135;
+L098E: GUARD(0x098E, 0x6081); n = core[sp]; T = t; sp++; core[sp] = t; t = T;
+L098F: GUARD(0x098F, 0x0119); goto L0119;
+L0990: GUARD(0x0990, 0x8012); core[++sp] = t; t = 0x0012;
+L0991: GUARD(0x0991, 0x4952); core[--rp] = 0x1324; goto L0952;
+L0992: GUARD(0x0992, 0x463B); core[--rp] = 0x1326; goto L063B;
+L0993: GUARD(0x0993, 0x489E); core[--rp] = 0x1328; goto L089E;
+L0994: GUARD(0x0994, 0x4669); core[--rp] = 0x132A; goto L0669;
+L0995: GUARD(0x0995, 0x8001); core[++sp] = t; t = 0x0001;
+L0996: GUARD(0x0996, 0x6A00); n = core[sp]; T = ~t; t = T;
+L0997: GUARD(0x0997, 0x7503); n = core[sp]; rp = t >> 1; T = n; sp--; t = T;
+L0998: GUARD(0x0998, 0x80DA); core[++sp] = t; t = 0x00DA;
+L0999: GUARD(0x0999, 0x0245); goto L0245;
+L099A: GUARD(0x099A, 0x4634); core[--rp] = 0x1336; goto L0634;
+L099B: GUARD(0x099B, 0x4121); core[--rp] = 0x1338; goto L0121;
+L099C: GUARD(0x099C, 0x435A); core[--rp] = 0x133A; goto L035A;
+L099D: GUARD(0x099D, 0x45FE); core[--rp] = 0x133C; goto L05FE;
+L099E: pc = 0x099E; goto fallback;
+L099F: GUARD(0x099F, 0x4F46); core[--rp] = 0x1340; pc = 0x0F46; goto dispatch;
+L09A0: GUARD(0x09A0, 0x5452); core[--rp] = 0x1342; pc = 0x1452; goto dispatch;
+L09A1: GUARD(0x09A1, 0x2048); n = t; t = core[sp--]; if (!n) goto L0048;
+L09A2: GUARD(0x09A2, 0x0076); goto L0076;
+L09AF: GUARD(0x09AF, 0x499A); core[--rp] = 0x1360; goto L099A;
+L09B0: GUARD(0x09B0, 0x0686); goto L0686;
+L09B1: GUARD(0x09B1, 0x6181); n = core[sp]; T = n; sp++; core[sp] = t; t = T;
+L09B2: GUARD(0x09B2, 0x446C); core[--rp] = 0x1366; goto L046C;
+L09B3: GUARD(0x09B3, 0x4175); core[--rp] = 0x1368; goto L0175;
+L09B4: GUARD(0x09B4, 0x29B6); n = t; t = core[sp--]; if (!n) goto L09B6;
+L09B5: GUARD(0x09B5, 0x010E); goto L010E;
+L09B6: GUARD(0x09B6, 0x0468); goto L0468;
+L09B7: GUARD(0x09B7, 0x9FFF); core[++sp] = t; t = 0x1FFF;
+L09B8: GUARD(0x09B8, 0x671F); n = core[sp]; pc = core[rp] >> 1; T = t&n; sp--; rp++; t = T; goto dispatch;
+L09B9: GUARD(0x09B9, 0x4159); core[--rp] = 0x1374; goto L0159;
+L09BA: GUARD(0x09BA, 0x49B7); core[--rp] = 0x1376; goto L09B7;
+L09BB: GUARD(0x09BB, 0x6147); n = core[sp]; T = n; sp--; rp--; core[rp] = t; t = T;
+L09BC: GUARD(0x09BC, 0x6081); n = core[sp]; T = t; sp++; core[sp] = t; t = T;
+L09BD: GUARD(0x09BD, 0x29CD); n = t; t = core[sp--]; if (!n) goto L09CD;
+L09BE: GUARD(0x09BE, 0x6381); n = core[sp]; T = core[(t>>1)%L]; sp++; core[sp] = t; t = T;
+L09BF: GUARD(0x09BF, 0x6181); n = core[sp]; T = n; sp++; core[sp] = t; t = T;
+L09C0: GUARD(0x09C0, 0x6281); n = core[sp]; T = core[rp]; sp++; core[sp] = t; t = T;
+L09C1: GUARD(0x09C1, 0x41EE); core[--rp] = 0x1384; goto L01EE;
+L09C2: GUARD(0x09C2, 0x41C4); core[--rp] = 0x1386; goto L01C4;
+L09C3: GUARD(0x09C3, 0x29CB); n = t; t = core[sp--]; if (!n) goto L09CB;
+L09C4: GUARD(0x09C4, 0x6381); n = core[sp]; T = core[(t>>1)%L]; sp++; core[sp] = t; t = T;
+L09C5: GUARD(0x09C5, 0x6281); n = core[sp]; T = core[rp]; sp++; core[sp] = t; t = T;
+L09C6: GUARD(0x09C6, 0x49B1); core[--rp] = 0x138E; goto L09B1;
+L09C7: GUARD(0x09C7, 0x4165); core[--rp] = 0x1390; goto L0165;
+L09C8: GUARD(0x09C8, 0x29CB); n = t; t = core[sp--]; if (!n) goto L09CB;
+L09C9: GUARD(0x09C9, 0x600C); n = core[sp]; T = t; rp++; t = T;
+L09CA: GUARD(0x09CA, 0x601F); n = core[sp]; pc = core[rp] >> 1; T = t; sp--; rp++; t = T; goto dispatch;
+L09CB: GUARD(0x09CB, 0x6300); n = core[sp]; T = core[(t>>1)%L]; t = T;
+L09CC: GUARD(0x09CC, 0x09BC); goto L09BC;
+L09CD: GUARD(0x09CD, 0x600C); n = core[sp]; T = t; rp++; t = T;
+L09CE: GUARD(0x09CE, 0x601C); n = core[sp]; pc = core[rp] >> 1; T = t; rp++; t = T; goto dispatch;
+L09CF: GUARD(0x09CF, 0x6147); n = core[sp]; T = n; sp--; rp--; core[rp] = t; t = T;
+L09D0: GUARD(0x09D0, 0x4852); core[--rp] = 0x13A2; goto L0852;
+L09D1: GUARD(0x09D1, 0x6081); n = core[sp]; T = t; sp++; core[sp] = t; t = T;
+L09D2: GUARD(0x09D2, 0x29E0); n = t; t = core[sp--]; if (!n) goto L09E0;
+L09D3: GUARD(0x09D3, 0x6180); n = core[sp]; T = n; core[sp] = t; t = T;
+L09D4: GUARD(0x09D4, 0x6281); n = core[sp]; T = core[rp]; sp++; core[sp] = t; t = T;
+L09D5: GUARD(0x09D5, 0x49B9); core[--rp] = 0x13AC; goto L09B9;
+L09D6: GUARD(0x09D6, 0x4165); core[--rp] = 0x13AE; goto L0165;
+L09D7: GUARD(0x09D7, 0x29DE); n = t; t = core[sp--]; if (!n) goto L09DE;
+L09D8: GUARD(0x09D8, 0x6147); n = core[sp]; T = n; sp--; rp--; core[rp] = t; t = T;
+L09D9: GUARD(0x09D9, 0x6B00); n = core[sp]; T = t-1; t = T;
+L09DA: GUARD(0x09DA, 0x42E7); core[--rp] = 0x13B6; goto L02E7;
+L09DB: GUARD(0x09DB, 0x628D); n = core[sp]; T = core[rp]; sp++; rp++; core[sp] = t; t = T;
+L09DC: GUARD(0x09DC, 0x600C); n = core[sp]; T = t; rp++; t = T;
+L09DD: GUARD(0x09DD, 0x601C); n = core[sp]; pc = core[rp] >> 1; T = t; rp++; t = T; goto dispatch;
+L09DE: GUARD(0x09DE, 0x6B00); n = core[sp]; T = t-1; t = T;
+L09DF: GUARD(0x09DF, 0x09D1); goto L09D1;
+L09E0: GUARD(0x09E0, 0x600C); n = core[sp]; T = t; rp++; t = T;
+L09E1: GUARD(0x09E1, 0x601C); n = core[sp]; pc = core[rp] >> 1; T = t; rp++; t = T; goto dispatch;
+L09E2: GUARD(0x09E2, 0x6147); n = core[sp]; T = n; sp--; rp--; core[rp] = t; t = T;
+L09E3: GUARD(0x09E3, 0x6700); n = core[sp]; T = t&n; t = T;
+L09E4: GUARD(0x09E4, 0x628D); n = core[sp]; T = core[rp]; sp++; rp++; core[sp] = t; t = T;
+L09E5: GUARD(0x09E5, 0x6D1F); n = core[sp]; pc = core[rp] >> 1; T = -(t == n); sp--; rp++; t = T; goto dispatch;
+L09E6: GUARD(0x09E6, 0x6081); n = core[sp]; T = t; sp++; core[sp] = t; t = T;
+L09E7: GUARD(0x09E7, 0x49B7); core[--rp] = 0x13D0; goto L09B7;
+L09E8: GUARD(0x09E8, 0x4159); core[--rp] = 0x13D2; goto L0159;
+L09E9: GUARD(0x09E9, 0x43CA); core[--rp] = 0x13D4; goto L03CA;
+L09EA: GUARD(0x09EA, 0x42C6); core[--rp] = 0x13D6; goto L02C6;
+L09EB: GUARD(0x09EB, 0x49CF); core[--rp] = 0x13D8; goto L09CF;
+L09EC: GUARD(0x09EC, 0x4165); core[--rp] = 0x13DA; goto L0165;
+L09ED: GUARD(0x09ED, 0x29F0); n = t; t = core[sp--]; if (!n) goto L09F0;
+L09EE: GUARD(0x09EE, 0x4462); core[--rp] = 0x13DE; goto L0462;
+L09EF: GUARD(0x09EF, 0x42F7); core[--rp] = 0x13E0; goto L02F7;
+L09F0: GUARD(0x09F0, 0x601C); n = core[sp]; pc = core[rp] >> 1; T = t; rp++; t = T; goto dispatch;
+L09F1: GUARD(0x09F1, 0x410B); core[--rp] = 0x13E4; goto L010B;
+L09F2: GUARD(0x09F2, 0x410B); core[--rp] = 0x13E6; goto L010B;
+L09F3: GUARD(0x09F3, 0x49E2); core[--rp] = 0x13E8; goto L09E2;
+L09F4: GUARD(0x09F4, 0x29FA); n = t; t = core[sp--]; if (!n) goto L09FA;
+L09F5: GUARD(0x09F5, 0x804C); core[++sp] = t; t = 0x004C;
+L09F6: GUARD(0x09F6, 0x42B9); core[--rp] = 0x13EE; goto L02B9;
+L09F7: GUARD(0x09F7, 0xFFFF); core[++sp] = t; t = 0x7FFF;
+L09F8: GUARD(0x09F8, 0x6703); n = core[sp]; T = t&n; sp--; t = T;
+L09F9: GUARD(0x09F9, 0x03CA); goto L03CA;
+L09FA: GUARD(0x09FA, 0xE000); core[++sp] = t; t = 0x6000;
+L09FB: GUARD(0x09FB, 0xE000); core[++sp] = t; t = 0x6000;
+L09FC: GUARD(0x09FC, 0x49E2); core[--rp] = 0x13FA; goto L09E2;
+L09FD: GUARD(0x09FD, 0x2A01); n = t; t = core[sp--]; if (!n) goto L0A01;
+L09FE: GUARD(0x09FE, 0x8041); core[++sp] = t; t = 0x0041;
+L09FF: GUARD(0x09FF, 0x42B9); core[--rp] = 0x1400; goto L02B9;
+L0A00: GUARD(0x0A00, 0x611F); n = core[sp]; pc = core[rp] >> 1; T = n; sp--; rp++; t = T; goto dispatch;
+L0A01: GUARD(0x0A01, 0xE000); core[++sp] = t; t = 0x6000;
+L0A02: GUARD(0x0A02, 0xC000); core[++sp] = t; t = 0x4000;
+L0A03: GUARD(0x0A03, 0x49E2); core[--rp] = 0x1408; goto L09E2;
+L0A04: GUARD(0x0A04, 0x2A08); n = t; t = core[sp--]; if (!n) goto L0A08;
+L0A05: GUARD(0x0A05, 0x8043); core[++sp] = t; t = 0x0043;
+L0A06: GUARD(0x0A06, 0x42B9); core[--rp] = 0x140E; goto L02B9;
+L0A07: GUARD(0x0A07, 0x09E6); goto L09E6;
+L0A08: GUARD(0x0A08, 0xE000); core[++sp] = t; t = 0x6000;
+L0A09: GUARD(0x0A09, 0xA000); core[++sp] = t; t = 0x2000;
+L0A0A: GUARD(0x0A0A, 0x49E2); core[--rp] = 0x1416; goto L09E2;
+L0A0B: GUARD(0x0A0B, 0x2A0F); n = t; t = core[sp--]; if (!n) goto L0A0F;
+L0A0C: GUARD(0x0A0C, 0x805A); core[++sp] = t; t = 0x005A;
+L0A0D: GUARD(0x0A0D, 0x42B9); core[--rp] = 0x141C; goto L02B9;
+L0A0E: GUARD(0x0A0E, 0x09E6); goto L09E6;
+L0A0F: GUARD(0x0A0F, 0x8042); core[++sp] = t; t = 0x0042;
+L0A10: GUARD(0x0A10, 0x42B9); core[--rp] = 0x1422; goto L02B9;
+L0A11: GUARD(0x0A11, 0x09E6); goto L09E6;
+L0A12: GUARD(0x0A12, 0x6147); n = core[sp]; T = n; sp--; rp--; core[rp] = t; t = T;
+L0A13: GUARD(0x0A13, 0x6081); n = core[sp]; T = t; sp++; core[sp] = t; t = T;
+L0A14: GUARD(0x0A14, 0x6281); n = core[sp]; T = core[rp]; sp++; core[sp] = t; t = T;
+L0A15: GUARD(0x0A15, 0x6E03); n = core[sp]; T = -(n < t); sp--; t = T;
+L0A16: GUARD(0x0A16, 0x2A20); n = t; t = core[sp--]; if (!n) goto L0A20;
+L0A17: GUARD(0x0A17, 0x43C9); core[--rp] = 0x1430; goto L03C9;
+L0A18: GUARD(0x0A18, 0x42D2); core[--rp] = 0x1432; goto L02D2;
+L0A19: GUARD(0x0A19, 0x6381); n = core[sp]; T = core[(t>>1)%L]; sp++; core[sp] = t; t = T;
+L0A1A: GUARD(0x0A1A, 0x43C9); core[--rp] = 0x1436; goto L03C9;
+L0A1B: GUARD(0x0A1B, 0x42C6); core[--rp] = 0x1438; goto L02C6;
+L0A1C: GUARD(0x0A1C, 0x49F1); core[--rp] = 0x143A; goto L09F1;
+L0A1D: GUARD(0x0A1D, 0x42BE); core[--rp] = 0x143C; goto L02BE;
+L0A1E: GUARD(0x0A1E, 0x4153); core[--rp] = 0x143E; goto L0153;
+L0A1F: GUARD(0x0A1F, 0x0A13); goto L0A13;
+L0A20: GUARD(0x0A20, 0x600C); n = core[sp]; T = t; rp++; t = T;
+L0A21: GUARD(0x0A21, 0x611F); n = core[sp]; pc = core[rp] >> 1; T = n; sp--; rp++; t = T; goto dispatch;
+L0A22: GUARD(0x0A22, 0x12A8); pc = 0x12A8; goto dispatch;
+L0A30: GUARD(0x0A30, 0x6081); n = core[sp]; T = t; sp++; core[sp] = t; t = T;
+L0A31: GUARD(0x0A31, 0x4473); core[--rp] = 0x1464; goto L0473;
+L0A32: GUARD(0x0A32, 0x6081); n = core[sp]; T = t; sp++; core[sp] = t; t = T;
+L0A33: GUARD(0x0A33, 0x42BE); core[--rp] = 0x1468; goto L02BE;
+L0A34: GUARD(0x0A34, 0x446C); core[--rp] = 0x146A; goto L046C;
+L0A35: GUARD(0x0A35, 0x628D); n = core[sp]; T = core[rp]; sp++; rp++; core[sp] = t; t = T;
+L0A36: GUARD(0x0A36, 0x4A12); core[--rp] = 0x146E; goto L0A12;
+L0A37: GUARD(0x0A37, 0x42C6); core[--rp] = 0x1470; goto L02C6;
+L0A38: GUARD(0x0A38, 0x803B); core[++sp] = t; t = 0x003B;
+L0A39: GUARD(0x0A39, 0x42B9); core[--rp] = 0x1474; goto L02B9;
+L0A3A: GUARD(0x0A3A, 0x6081); n = core[sp]; T = t; sp++; core[sp] = t; t = T;
+L0A3B: GUARD(0x0A3B, 0x447D); core[--rp] = 0x1478; goto L047D;
+L0A3C: GUARD(0x0A3C, 0x2A45); n = t; t = core[sp--]; if (!n) goto L0A45;
+L0A3D: GUARD(0x0A3D, 0x45FE); core[--rp] = 0x147C; goto L05FE;
+L0A3E: GUARD(0x0A3E, 0x200D); n = t; t = core[sp--]; if (!n) goto L000D;
+L0A3F: GUARD(0x0A3F, 0x6F63); n = core[sp]; T = -((s_t)n < (s_t)t); sp--; core[rp] = t; t = n;
+L0A40: GUARD(0x0A40, 0x706D); n = core[sp]; T = n >> t; sp++; rp++; core[rp] = t; t = n;
+L0A41: GUARD(0x0A41, 0x6C69); n = core[sp]; d = (((d_t)S(1) << 16) | S(2)) - (((d_t)t << 16) | n); S(2) = d; T = d >> 16; sp++; core[rp] = t; t = n;
+L0A42: GUARD(0x0A42, 0x2D65); n = t; t = core[sp--]; if (!n) pc = 0x0D65; goto dispatch;
+L0A43: GUARD(0x0A43, 0x6E6F); n = core[sp]; T = -(n < t); sp--; rp++; core[rp] = t; t = n;
+L0A44: pc = 0x0A44; goto fallback;
+L0A45: GUARD(0x0A45, 0x6081); n = core[sp]; T = t; sp++; core[sp] = t; t = T;
+L0A46: GUARD(0x0A46, 0x4480); core[--rp] = 0x148E; goto L0480;
+L0A47: GUARD(0x0A47, 0x2A4D); n = t; t = core[sp--]; if (!n) goto L0A4D;
+L0A48: GUARD(0x0A48, 0x45FE); core[--rp] = 0x1492; goto L05FE;
+L0A49: GUARD(0x0A49, 0x2007); n = t; t = core[sp--]; if (!n) goto L0007;
+L0A4A: GUARD(0x0A4A, 0x6E69); n = core[sp]; T = -((sd_t)(((d_t)S(1) << 16) | S(2)) < (sd_t)(((d_t)t << 16) | n)); sp -= 2; sp++; core[rp] = t; t = n;
+L0A4B: GUARD(0x0A4B, 0x696C); n = core[sp]; T = t^n; rp++; core[rp] = t; t = n;
+L0A4C: GUARD(0x0A4C, 0x656E); n = core[sp]; d = (d_t)t + n; T = d >> 16; core[sp] = d; n = d; sp -= 2; rp++; core[rp] = t; t = n;
+L0A4D: GUARD(0x0A4D, 0x4477); core[--rp] = 0x149C; goto L0477;
+L0A4E: GUARD(0x0A4E, 0x2A56); n = t; t = core[sp--]; if (!n) goto L0A56;
+L0A4F: GUARD(0x0A4F, 0x45FE); core[--rp] = 0x14A0; goto L05FE;
+L0A50: GUARD(0x0A50, 0x200A); n = t; t = core[sp--]; if (!n) goto L000A;
+L0A51: GUARD(0x0A51, 0x6D69); n = core[sp]; d = 0u - (((d_t)t << 16) | n); core[sp] = d; T = d >> 16; sp++; core[rp] = t; t = n;
+L0A52: GUARD(0x0A52, 0x656D); n = core[sp]; d = (d_t)t + n; T = d >> 16; core[sp] = d; n = d; sp++; rp++; core[rp] = t; t = n;
+L0A53: GUARD(0x0A53, 0x6964); n = core[sp]; T = t^n; rp--; core[rp] = t; t = n;
+L0A54: GUARD(0x0A54, 0x7461); n = core[sp]; sp = t >> 1; sp++; core[rp] = t; t = n;
+L0A55: GUARD(0x0A55, 0x0065); goto L0065;
+L0A56: GUARD(0x0A56, 0x02BE); goto L02BE;
+L0A57: GUARD(0x0A57, 0x1444); pc = 0x1444; goto dispatch;
+L0A62: GUARD(0x0A62, 0x45FE); core[--rp] = 0x14C6; goto L05FE;
+L0A63: GUARD(0x0A63, 0x2004); n = t; t = core[sp--]; if (!n) goto L0004;
+L0A64: GUARD(0x0A64, 0x733C); n = core[sp]; pc = core[rp] >> 1; T = rp << 1; rp++; t = n; goto dispatch;
+L0A67: GUARD(0x0A67, 0x415F); core[--rp] = 0x14D0; goto L015F;
+L0A68: GUARD(0x0A68, 0x6147); n = core[sp]; T = n; sp--; rp--; core[rp] = t; t = T;
+L0A69: GUARD(0x0A69, 0x0A6D); goto L0A6D;
+L0A6A: GUARD(0x0A6A, 0x6381); n = core[sp]; T = core[(t>>1)%L]; sp++; core[sp] = t; t = T;
+L0A6B: GUARD(0x0A6B, 0x43CA); core[--rp] = 0x14D8; goto L03CA;
+L0A6C: GUARD(0x0A6C, 0x4153); core[--rp] = 0x14DA; goto L0153;
+L0A6D: GUARD(0x0A6D, 0x7E81); n = core[sp]; if ((T = core[rp])) { core[rp] = T - 1; T = 0; } else { rp++; T = -1; } sp++; core[sp] = t; t = T;
+L0A6E: GUARD(0x0A6E, 0x2A6A); n = t; t = core[sp--]; if (!n) goto L0A6A;
+L0A6F: GUARD(0x0A6F, 0x601C); n = core[sp]; pc = core[rp] >> 1; T = t; rp++; t = T; goto dispatch;
+L0A70: GUARD(0x0A70, 0x14AE); pc = 0x14AE; goto dispatch;
+L0A72: GUARD(0x0A72, 0x6D75); n = core[sp]; pc = core[rp] >> 1; T = -(t == n); sp++; rp--; core[rp] = t; t = n; goto dispatch;
+L0A7A: GUARD(0x0A7A, 0x42BE); core[--rp] = 0x14F6; goto L02BE;
+L0A7B: GUARD(0x0A7B, 0x8010); core[++sp] = t; t = 0x0010;
+L0A7C: GUARD(0x0A7C, 0x418A); core[--rp] = 0x14FA; goto L018A;
+L0A7D: GUARD(0x0A7D, 0x6181); n = core[sp]; T = n; sp++; core[sp] = t; t = T;
+L0A7E: GUARD(0x0A7E, 0x43CA); core[--rp] = 0x14FE; goto L03CA;
+L0A7F: GUARD(0x0A7F, 0x42D2); core[--rp] = 0x1500; goto L02D2;
+L0A80: GUARD(0x0A80, 0x4A67); core[--rp] = 0x1502; goto L0A67;
+L0A81: GUARD(0x0A81, 0x41EE); core[--rp] = 0x1504; goto L01EE;
+L0A82: GUARD(0x0A82, 0x8002); core[++sp] = t; t = 0x0002;
+L0A83: GUARD(0x0A83, 0x42C7); core[--rp] = 0x1508; goto L02C7;
+L0A84: GUARD(0x0A84, 0x4308); core[--rp] = 0x150A; goto L0308;
+L0A85: GUARD(0x0A85, 0x7E81); n = core[sp]; if ((T = core[rp])) { core[rp] = T - 1; T = 0; } else { rp++; T = -1; } sp++; core[sp] = t; t = T;
+L0A86: GUARD(0x0A86, 0x2A7A); n = t; t = core[sp--]; if (!n) goto L0A7A;
+L0A87: GUARD(0x0A87, 0x611F); n = core[sp]; pc = core[rp] >> 1; T = n; sp--; rp++; t = T; goto dispatch;
+L0A94: GUARD(0x0A94, 0x653F); n = core[sp]; pc = core[rp] >> 1; d = (d_t)t + n; T = d >> 16; core[sp] = d; n = d; sp--; rp++; t = n; goto dispatch;
+L0A95: GUARD(0x0A95, 0x0000); goto L0000;
+L0A98: GUARD(0x0A98, 0x152A); pc = 0x152A; goto dispatch;
+L0A9C: GUARD(0x0A9C, 0x1530); pc = 0x1530; goto dispatch;
+L0AA2: GUARD(0x0AA2, 0x1538); pc = 0x1538; goto dispatch;
+L0AA6: GUARD(0x0AA6, 0x1544); pc = 0x1544; goto dispatch;
+L0AAA: GUARD(0x0AAA, 0x8020); core[++sp] = t; t = 0x0020;
+L0AAB: pc = 0x0AAB; goto fallback;
+L0AAC: GUARD(0x0AAC, 0x601C); n = core[sp]; pc = core[rp] >> 1; T = t; rp++; t = T; goto dispatch;
+L0AAD: GUARD(0x0AAD, 0x154C); pc = 0x154C; goto dispatch;
+L0AB2: GUARD(0x0AB2, 0x155A); pc = 0x155A; goto dispatch;
+L0AB6: GUARD(0x0AB6, 0x1564); pc = 0x1564; goto dispatch;
+L0ABA: GUARD(0x0ABA, 0x156C); pc = 0x156C; goto dispatch;
+L0AC0: GUARD(0x0AC0, 0x1574); pc = 0x1574; goto dispatch;
+L0AC8: GUARD(0x0AC8, 0x4115); core[--rp] = 0x1592; goto L0115;
+L0AC9: GUARD(0x0AC9, 0x6523); n = core[sp]; d = (d_t)t + n; T = d >> 16; core[sp] = d; n = d; sp--; t = n;
+L0ACA: GUARD(0x0ACA, 0x6180); n = core[sp]; T = n; core[sp] = t; t = T;
+L0ACB: GUARD(0x0ACB, 0x41D7); core[--rp] = 0x1598; goto L01D7;
+L0ACC: GUARD(0x0ACC, 0x6003); n = core[sp]; T = t; sp--; t = T;
+L0ACD: GUARD(0x0ACD, 0x4115); core[--rp] = 0x159C; goto L0115;
+L0ACE: GUARD(0x0ACE, 0x4139); core[--rp] = 0x159E; goto L0139;
+L0ACF: pc = 0x0ACF; goto fallback;
+L0AD0: GUARD(0x0AD0, 0x0541); goto L0541;
+L0AD1: GUARD(0x0AD1, 0x1580); pc = 0x1580; goto dispatch;
+}
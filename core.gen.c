@@ -0,0 +1,253 @@
+/* eForth image */
+#include <stdint.h>
+#include <stddef.h>
+
+const uint8_t embed_default_block[] = {
+20,0,0,0,255,127,0,36,71,3,0,128,0,0,20,0,0,0,255,127,0,36,137,70,84,
+72,13,10,26,10,172,21,47,231,1,0,132,25,1,0,138,9,141,98,28,96,141,98,28,
+99,98,17,162,21,0,0,16,15,0,0,0,0,3,112,97,100,23,64,0,65,60,0,4,99,101,
+108,108,0,23,64,2,0,70,0,5,98,47,98,117,102,23,64,0,4,172,21,224,20,108,16,
+82,0,3,62,105,110,21,64,0,0,100,0,5,115,116,97,116,101,21,64,0,0,110,0,3,
+104,108,100,21,64,0,0,122,0,4,98,97,115,101,0,21,64,10,0,132,0,4,115,112,
+97,110,0,21,64,0,0,144,0,3,98,108,107,21,64,0,0,156,0,3,100,112,108,21,64,
+255,255,166,0,7,99,117,114,114,101,110,116,21,64,96,0,0,0,9,60,108,105,116,
+101,114,97,108,62,21,64,84,11,190,0,6,60,98,111,111,116,62,0,21,64,94,19,
+206,0,4,60,111,107,62,0,21,64,0,0,176,0,3,100,117,112,157,96,232,0,4,111,
+118,101,114,0,157,97,240,0,6,105,110,118,101,114,116,0,28,106,220,0,3,117,
+109,43,28,101,6,1,3,117,109,42,28,102,250,0,1,43,63,101,22,1,1,42,63,102,
+28,1,4,115,119,97,112,0,156,97,34,1,3,110,105,112,31,96,44,1,4,100,114,
+111,112,0,31,97,52,1,1,64,28,99,62,1,1,33,31,100,68,1,6,114,115,104,105,
+102,116,0,31,112,74,1,6,108,115,104,105,102,116,0,31,113,86,1,1,61,31,109,
+98,1,2,117,60,0,31,110,104,1,1,60,31,111,112,1,3,97,110,100,31,103,118,1,
+3,120,111,114,31,105,126,1,2,111,114,0,31,104,134,1,2,49,45,0,28,107,142,
+1,2,48,61,0,28,108,14,1,3,114,120,63,189,120,158,1,3,116,120,33,63,119,
+166,1,6,40,115,97,118,101,41,0,31,118,174,1,2,118,109,0,28,124,150,1,6,117,
+109,47,109,111,100,0,156,121,194,1,4,47,109,111,100,0,156,122,206,1,1,47,
+31,122,216,1,3,109,111,100,63,122,222,1,36,101,120,105,116,0,28,96,230,1,
+34,62,114,0,71,97,240,1,34,114,62,0,141,98,248,1,34,114,64,0,129,98,0,2,
+37,114,100,114,111,112,12,96,0,128,28,106,255,255,28,106,3,97,3,97,0,128,
+28,96,120,128,28,99,1,128,31,103,108,128,28,99,142,128,28,99,71,97,0,123,
+12,96,28,96,0,128,0,125,129,96,63,125,36,33,12,96,28,96,28,96,8,2,5,50,
+100,114,111,112,3,97,31,97,74,2,2,49,43,0,1,128,63,101,86,2,6,110,101,103,
+97,116,101,0,0,107,28,106,96,2,1,45,53,65,63,101,129,97,57,1,129,97,63,
+101,110,2,7,97,108,105,103,110,101,100,129,96,19,65,63,101,126,2,3,98,121,
+101,0,128,9,65,25,1,2,128,57,1,142,2,5,99,101,108,108,43,2,128,63,101,158,
+2,5,99,101,108,108,115,1,128,31,113,170,2,5,99,104,97,114,115,1,128,31,
+112,182,2,4,63,100,117,112,0,129,96,104,33,157,96,28,96,194,2,1,62,128,97,
+31,111,210,2,2,117,62,0,128,97,31,110,218,2,2,60,62,0,3,109,28,106,228,2,
+3,48,60,62,0,108,28,106,238,2,2,48,62,0,0,128,107,1,248,2,2,48,60,0,0,
+128,31,111,2,3,4,50,100,117,112,0,129,97,157,97,12,3,4,116,117,99,107,0,
+128,97,157,97,24,3,2,43,33,0,144,65,0,99,35,101,128,97,31,100,0,128,152,1,
+36,3,3,49,43,33,1,128,128,97,149,1,56,3,3,49,45,33,9,65,160,1,68,3,2,50,
+33,0,144,65,3,100,83,65,31,100,78,3,2,50,64,0,129,96,83,65,0,99,128,97,28,
+99,188,128,28,99,188,128,31,100,92,3,2,98,108,0,32,128,28,96,116,3,6,119,
+105,116,104,105,110,0,59,65,71,97,57,65,141,98,31,110,129,96,132,1,126,3,3,
+97,98,115,201,65,209,33,53,1,28,96,150,3,6,115,111,117,114,99,101,0,42,
+192,177,1,215,65,31,97,164,3,9,115,111,117,114,99,101,45,105,100,6,192,28,
+99,182,3,3,114,111,116,71,97,128,97,141,98,156,97,198,3,4,45,114,111,116,
+0,230,65,230,1,230,65,31,97,3,104,28,108,212,3,7,100,110,101,103,97,116,
+101,8,109,28,96,232,3,2,100,43,0,10,107,28,96,246,3,2,100,45,0,10,108,28,
+96,0,4,2,100,60,0,11,110,28,96,10,4,2,109,42,0,8,111,28,96,20,4,5,109,47,
+109,111,100,11,112,28,96,201,65,24,34,8,109,28,96,132,65,28,34,53,65,28,96,
+30,4,6,115,109,47,114,101,109,0,129,97,71,97,71,97,21,66,129,98,206,65,
+128,121,141,98,129,98,3,105,25,66,128,97,141,98,25,66,156,97,58,4,5,42,47,
+109,111,100,71,97,8,111,141,98,34,2,98,4,2,42,47,0,53,66,31,96,114,4,7,101,
+120,101,99,117,116,101,71,97,28,96,0,99,101,65,73,34,67,2,28,96,124,4,2,99,
+64,0,8,96,28,96,148,4,2,99,33,0,11,97,28,96,158,4,4,104,101,114,101,0,94,
+128,28,99,168,4,5,97,108,105,103,110,88,66,68,65,94,128,31,100,180,4,5,97,
+108,108,111,116,94,128,149,1,64,98,128,97,71,97,71,97,28,96,141,98,141,98,
+128,97,64,98,28,96,196,4,3,109,105,110,129,111,120,34,31,97,31,96,228,4,3,
+109,97,120,138,65,107,65,118,2,242,4,3,107,101,121,16,192,69,66,129,96,138,
+34,3,96,1,128,9,65,25,65,0,108,130,34,129,96,9,65,117,65,33,65,3,97,74,65,
+130,2,254,4,7,47,115,116,114,105,110,103,129,97,117,66,230,65,61,65,238,65,
+57,1,1,128,152,2,38,5,5,99,111,117,110,116,129,96,46,65,128,97,8,96,28,96,
+129,97,8,96,28,96,186,1,3,99,114,99,11,106,28,96,182,65,28,99,24,192,69,2,
+64,5,4,101,109,105,116,0,18,192,69,2,106,5,2,99,114,0,13,128,185,66,10,
+128,185,2,118,5,5,115,112,97,99,101,1,128,32,128,128,97,0,128,124,66,71,97,
+207,2,129,96,185,66,129,126,205,34,31,97,58,128,185,66,198,2,129,114,128,
+97,57,1,132,5,5,100,101,112,116,104,0,200,213,66,77,65,95,1,176,5,4,112,
+105,99,107,0,89,65,213,66,28,99,89,65,213,66,0,116,31,97,129,96,127,128,32,
+128,196,65,242,34,3,97,95,128,28,96,192,5,4,116,121,112,101,0,0,128,71,97,
+129,96,4,35,128,97,164,66,129,98,0,35,235,66,185,66,128,97,0,107,249,2,12,
+96,41,1,164,66,247,2,9,65,248,2,230,5,5,99,109,111,118,101,11,98,28,96,20,
+6,4,102,105,108,108,0,11,99,28,96,32,6,5,101,114,97,115,101,0,128,11,99,
+28,96,44,6,5,99,97,116,99,104,129,114,71,97,10,192,0,99,71,97,12,128,0,99,
+71,97,129,115,10,192,3,100,67,66,12,96,141,98,10,192,3,100,141,98,14,1,58,
+6,5,116,104,114,111,119,101,65,70,35,10,192,0,99,3,117,141,98,12,128,3,
+100,141,98,10,192,3,100,64,98,0,116,3,97,141,98,28,96,53,65,55,3,1,128,220,
+66,3,111,33,65,4,128,71,3,102,6,7,100,101,99,105,109,97,108,10,128,142,
+128,31,100,158,6,3,104,101,120,16,128,85,3,23,65,129,96,2,128,57,65,35,128,
+3,110,33,65,84,67,40,128,71,3,174,6,4,104,111,108,100,0,130,128,0,99,0,
+107,129,96,130,128,3,100,11,97,130,128,0,99,0,193,128,128,57,65,112,65,33,
+65,17,128,71,3,68,96,128,121,64,98,128,121,141,98,230,1,9,128,129,97,3,
+111,7,128,3,103,35,101,48,128,63,101,204,6,2,35,62,0,41,65,130,128,0,99,0,
+193,59,1,16,7,1,35,2,128,74,67,0,128,23,65,122,67,128,67,106,3,32,7,2,35,
+115,0,2,128,74,67,130,128,0,99,23,65,11,105,130,128,3,100,113,3,50,7,2,60,
+35,0,0,193,130,128,31,100,74,7,4,115,105,103,110,0,132,65,0,108,33,65,45,
+128,106,3,68,96,206,65,0,128,168,67,156,67,141,98,175,67,139,3,0,128,168,
+67,156,67,139,3,86,7,3,117,46,114,71,97,188,67,141,98,59,65,199,66,247,2,
+129,96,198,66,5,128,195,3,128,7,2,117,46,0,188,67,198,66,247,2,154,7,1,46,
+180,67,209,3,2,128,53,65,31,103,88,5,5,112,97,99,107,36,68,65,68,96,129,97,
+129,96,215,67,57,65,61,65,154,65,138,65,11,97,46,65,128,97,11,98,141,98,28,
+96,166,7,7,99,111,109,112,97,114,101,11,103,28,96,71,97,129,97,129,98,3,
+111,129,96,0,36,8,128,129,96,179,66,32,128,179,66,179,66,141,98,63,101,129,
+96,179,66,129,97,11,97,46,1,129,96,8,128,3,109,128,97,127,128,3,109,3,104,
+28,108,129,96,13,128,3,105,24,36,7,68,23,36,32,128,2,4,244,3,3,97,3,96,
+157,96,129,96,32,128,57,65,149,128,3,110,128,97,127,128,117,65,31,103,29,
+65,2,128,3,103,122,1,218,7,6,97,99,99,101,112,116,0,61,65,129,97,129,105,
+73,36,71,97,104,66,130,66,109,66,230,65,141,98,128,97,129,96,36,68,66,36,
+27,68,63,36,2,68,65,4,22,192,69,66,72,4,10,128,3,105,71,36,2,68,72,4,24,
+68,47,4,3,97,59,1,80,8,6,101,120,112,101,99,116,0,20,192,69,66,154,128,3,
+100,31,97,150,8,5,113,117,101,114,121,217,65,80,128,20,192,69,66,42,192,3,
+100,14,65,108,128,31,100,164,66,31,128,31,103,180,7,3,110,102,97,83,1,202,
+8,3,99,102,97,104,68,129,96,8,96,99,68,35,101,83,65,215,3,104,68,98,68,
+247,66,198,2,104,68,64,128,128,97,0,99,3,103,122,1,104,68,32,128,121,4,230,
+129,18,130,196,1,128,97,71,97,129,96,129,96,155,36,129,96,104,68,164,66,
+159,128,3,103,129,98,164,66,11,103,0,108,152,36,12,96,129,96,119,68,1,128,
+3,104,53,1,3,96,129,99,134,4,12,96,13,1,129,96,54,128,0,99,131,68,101,65,
+167,36,71,97,240,65,141,98,28,96,71,97,26,192,129,99,185,36,129,99,0,99,
+129,98,128,97,131,68,101,65,183,36,71,97,240,65,141,98,12,96,28,96,83,65,
+169,4,14,65,141,98,15,1,170,8,15,115,101,97,114,99,104,45,119,111,114,100,
+108,105,115,116,131,68,240,1,120,9,4,102,105,110,100,0,157,68,240,1,142,9,
+7,62,110,117,109,98,101,114,23,65,11,104,28,96,9,65,174,128,3,100,23,65,
+71,97,169,66,45,128,3,109,68,96,224,36,158,66,169,66,36,128,3,109,230,36,
+90,67,158,66,104,66,0,128,129,96,109,66,23,65,11,104,129,96,255,36,169,66,
+46,128,3,105,248,36,240,65,230,65,141,98,13,65,141,98,85,3,0,107,174,128,
+3,100,46,65,174,128,0,99,234,4,41,65,141,98,3,37,8,109,141,98,85,67,9,1,
+71,97,129,97,238,65,129,98,11,100,138,65,141,98,11,101,3,97,3,96,68,96,
+129,97,57,65,230,65,141,98,128,97,57,65,46,1,154,9,5,112,97,114,115,101,71,
+97,217,65,21,65,35,101,42,192,0,99,21,65,57,65,0,128,124,66,129,98,6,69,
+108,128,149,65,141,98,32,128,3,109,47,37,8,102,0,128,124,2,48,10,65,41,28,
+96,98,10,65,40,41,128,28,69,41,1,104,10,2,46,40,0,41,128,28,69,247,2,114,
+10,65,92,42,192,0,99,96,4,129,96,64,128,3,110,33,65,19,128,71,3,126,10,4,
+119,111,114,100,0,73,67,28,69,68,69,88,66,222,3,32,128,78,5,148,10,4,99,
+104,97,114,0,83,69,164,66,3,97,8,96,28,96,129,96,255,191,3,110,33,65,8,128,
+71,3,170,10,1,44,88,66,129,96,83,65,94,69,95,66,31,100,200,10,2,99,44,0,
+88,66,94,69,11,97,94,128,159,1,11,65,3,104,102,5,216,10,103,108,105,116,
+101,114,97,108,129,96,11,65,3,103,132,37,0,106,116,69,0,234,102,5,116,5,95,
+65,0,192,31,104,238,10,8,99,111,109,112,105,108,101,44,0,133,69,102,5,129,
+96,128,68,150,37,108,68,0,99,102,5,108,68,142,5,215,65,247,66,13,128,71,3,
+129,96,125,68,0,108,33,65,215,65,247,66,14,128,71,3,210,8,9,40,108,105,116,
+101,114,97,108,41,17,65,0,108,33,65,124,5,16,11,9,105,110,116,101,114,112,
+114,101,116,203,68,101,65,194,37,17,65,190,37,127,65,189,37,108,68,67,2,
+144,5,3,97,156,69,108,68,67,2,68,96,164,66,213,68,212,37,12,96,174,128,0,
+99,132,65,205,37,3,97,210,5,17,65,208,37,128,97,204,128,69,66,204,128,69,
+2,141,98,152,5,92,11,39,99,111,109,112,105,108,101,141,98,129,99,102,69,
+83,65,71,97,28,96,172,11,9,105,109,109,101,100,105,97,116,101,64,128,177,
+66,104,68,144,65,0,99,3,105,152,1,104,68,128,128,128,97,234,5,164,66,63,
+101,109,66,129,96,242,69,68,65,71,97,128,97,71,97,28,96,244,69,28,96,244,
+69,6,3,194,11,98,36,34,0,219,69,252,69,34,128,78,69,242,69,95,2,0,12,98,
+46,34,0,219,69,254,69,5,6,18,12,5,97,98,111,114,116,9,65,9,65,25,1,128,97,
+27,38,6,67,190,66,19,6,31,97,244,69,22,6,30,12,102,97,98,111,114,116,34,0,
+219,69,28,70,5,6,17,65,33,65,254,69,3,32,111,107,190,2,46,192,42,192,83,65,
+3,100,0,128,96,68,6,192,154,1,4,128,29,65,3,103,122,1,72,11,3,105,111,33,
+44,70,164,129,16,192,3,100,172,129,18,192,3,100,52,70,0,108,76,140,3,103,
+60,129,4,136,36,68,77,38,41,65,114,133,30,136,90,136,20,192,3,100,22,192,
+3,100,24,192,3,100,230,128,31,100,17,128,185,2,112,12,4,102,105,108,101,
+0,172,140,60,129,30,136,77,6,60,12,1,93,9,65,120,128,31,100,192,12,65,91,
+120,128,154,1,0,200,28,116,101,65,0,108,33,65,213,67,63,128,185,66,190,66,
+105,70,44,70,54,128,154,65,103,6,83,69,129,96,8,96,127,38,180,69,0,128,74,
+67,119,6,3,97,230,128,69,2,202,12,4,113,117,105,116,0,115,70,89,68,238,
+140,33,67,107,70,135,6,28,96,215,65,21,65,225,65,230,128,28,99,230,128,3,
+100,6,192,3,100,96,68,42,192,170,1,4,13,8,101,118,97,108,117,97,116,101,0,
+141,70,104,66,104,66,71,97,0,128,9,65,0,128,146,70,238,140,33,67,141,98,
+109,66,109,66,146,70,55,3,173,171,3,109,33,65,22,128,71,3,129,96,182,65,
+131,68,0,108,33,65,198,66,41,65,2,192,0,99,115,68,254,69,9,114,101,100,101,
+102,105,110,101,100,190,2,129,96,8,96,33,65,10,128,71,3,83,69,203,68,33,65,
+152,5,201,70,108,4,50,13,65,39,205,70,17,65,213,38,124,5,28,96,158,13,105,
+91,99,111,109,112,105,108,101,93,205,70,142,5,172,13,102,91,99,104,97,114,
+93,0,89,69,124,5,54,128,0,99,0,108,33,65,54,128,154,65,8,243,102,5,188,13,
+97,59,174,70,229,70,28,224,102,69,103,70,101,65,248,38,182,65,31,100,28,
+96,218,13,1,58,94,66,88,66,129,96,2,192,3,100,177,66,102,69,83,69,196,70,
+179,70,242,69,95,66,173,171,98,6,242,13,101,98,101,103,105,110,88,2,18,14,
+101,97,103,97,105,110,95,65,102,5,28,14,101,117,110,116,105,108,0,192,3,
+104,18,7,88,66,15,1,27,71,18,7,40,14,98,105,102,0,27,71,24,7,62,14,100,116,
+104,101,110,0,88,66,95,65,129,97,0,99,3,104,152,1,72,14,100,101,108,115,
+101,0,29,71,128,97,40,7,92,14,101,119,104,105,108,101,34,7,106,14,102,114,
+101,112,101,97,116,0,128,97,18,71,40,7,2,192,0,99,108,4,116,14,103,114,101,
+99,117,114,115,101,66,71,142,5,138,14,6,99,114,101,97,116,101,0,251,70,3,
+97,219,69,21,64,182,65,3,100,103,6,152,14,5,62,98,111,100,121,83,1,141,98,
+133,69,66,71,31,100,3,100,102,5,176,14,101,100,111,101,115,62,219,69,93,71,
+141,226,102,5,198,14,8,118,97,114,105,97,98,108,101,0,81,71,0,128,102,5,
+214,14,8,99,111,110,115,116,97,110,116,0,81,71,46,128,133,69,88,66,77,65,
+97,7,232,14,7,58,110,111,110,97,109,101,27,71,173,171,98,6,0,0,100,101,
+120,105,116,0,8,243,102,69,28,224,102,5,124,69,8,244,102,5,164,66,230,65,
+164,66,11,103,28,108,58,128,0,99,129,96,0,195,192,128,35,101,112,65,162,39,
+8,128,71,3,54,128,0,99,129,97,3,100,83,65,88,66,128,97,95,66,83,69,196,
+70,128,97,95,2,129,96,252,69,2,45,45,0,147,71,0,108,33,65,3,97,152,71,129,
+96,252,69,2,58,125,0,147,71,181,39,28,96,129,96,77,65,54,128,3,100,129,96,
+242,69,68,65,64,128,230,65,234,69,129,97,255,255,0,106,3,104,129,97,3,100,
+83,65,32,143,95,65,129,97,3,100,83,65,58,128,3,100,46,1,35,102,51,69,0,15,
+98,123,58,0,56,128,0,99,54,128,3,100,0,195,58,128,3,100,0,128,0,128,152,
+71,174,71,129,96,252,69,2,58,125,0,147,71,0,108,255,39,129,96,252,69,1,
+124,147,71,246,39,41,65,9,65,254,7,129,97,250,39,0,128,124,69,230,65,128,
+97,190,71,128,97,229,7,41,65,124,69,11,242,102,5,178,15,98,116,111,0,83,
+69,54,128,0,99,131,68,203,70,3,96,129,96,0,195,3,110,18,40,32,128,71,3,
+108,68,0,99,255,255,3,103,124,69,11,245,102,5,6,16,99,102,111,114,71,225,
+102,69,88,2,50,16,100,110,101,120,116,0,129,254,102,69,24,7,62,16,99,97,
+102,116,3,97,29,71,13,71,156,97,176,12,4,104,105,100,101,0,201,70,238,5,35,
+125,71,97,28,96,90,16,5,116,114,97,99,101,205,70,29,65,68,96,1,128,3,104,
+51,72,141,98,63,125,0,128,71,97,129,99,129,98,117,65,74,40,83,65,68,8,12,
+96,28,96,76,16,9,103,101,116,45,111,114,100,101,114,26,192,66,72,129,96,
+77,65,128,97,26,192,57,65,95,65,68,96,0,107,201,65,96,40,50,128,71,3,71,
+97,101,8,129,99,128,97,77,65,129,126,98,40,0,99,141,98,28,96,0,0,14,102,
+111,114,116,104,45,119,111,114,100,108,105,115,116,0,96,128,28,96,212,16,6,
+115,121,115,116,101,109,0,98,128,28,96,234,16,9,115,101,116,45,111,114,100,
+101,114,129,96,9,65,3,109,138,40,3,97,50,128,1,128,130,8,129,96,8,128,107,
+65,144,40,49,128,71,3,26,192,128,97,71,97,151,8,144,65,3,100,83,65,129,
+126,148,40,154,1,248,16,5,102,111,114,116,104,50,128,115,72,2,128,130,8,
+104,68,8,96,128,128,3,103,28,108,101,65,176,40,129,96,162,72,174,40,129,96,
+115,68,0,99,167,8,190,2,52,17,5,119,111,114,100,115,82,72,101,65,193,40,
+128,97,129,96,190,66,208,67,210,66,0,99,167,72,0,107,182,8,28,96,152,16,4,
+111,110,108,121,0,9,65,130,8,132,17,11,100,101,102,105,110,105,116,105,111,
+110,115,26,192,0,99,184,1,129,96,224,40,0,107,128,97,71,97,210,72,129,97,
+129,98,3,105,223,40,46,65,141,98,238,1,12,96,28,96,144,17,6,45,111,114,100,
+101,114,0,82,72,210,72,3,96,130,8,194,17,6,43,111,114,100,101,114,0,68,96,
+230,72,82,72,141,98,128,97,46,65,130,8,212,17,6,101,100,105,116,111,114,0,
+52,128,239,8,236,17,6,117,112,100,97,116,101,0,9,65,12,192,31,100,164,128,
+28,99,5,73,63,101,250,17,4,115,97,118,101,0,0,128,88,66,3,118,55,3,18,18,
+5,102,108,117,115,104,12,192,0,99,0,108,33,65,0,128,9,65,15,9,34,18,5,98,
+108,111,99,107,73,67,129,96,63,128,112,65,39,41,35,128,71,3,129,96,164,128,
+3,100,10,128,31,113,6,128,31,113,6,128,31,112,44,73,128,97,32,73,35,101,
+64,128,28,96,48,73,159,6,56,18,4,108,111,97,100,0,0,128,15,128,71,97,138,
+65,104,66,54,73,109,66,46,65,129,126,63,41,41,1,124,128,185,2,3,128,199,
+66,64,128,45,128,200,66,190,2,129,96,2,128,195,3,32,73,31,97,112,18,4,108,
+105,115,116,0,129,96,82,73,190,66,73,73,0,128,129,96,16,128,3,111,106,41,
+138,65,79,73,71,73,48,73,8,67,71,73,190,66,46,65,93,9,73,73,41,1,38,128,0,
+99,19,65,28,108,1,128,38,128,234,5,108,73,118,41,15,1,30,128,0,99,88,66,3,
+105,125,41,2,128,28,96,32,128,0,99,32,128,154,65,0,128,88,66,11,106,3,105,
+136,41,3,128,28,96,112,73,15,1,115,73,101,65,144,41,53,65,129,96,25,1,18,
+128,82,73,59,70,158,72,105,70,1,128,0,106,3,117,218,128,69,2,52,70,33,65,
+90,67,254,69,8,101,70,79,82,84,72,32,118,0,132,153,0,128,195,67,190,66,84,
+67,88,66,213,67,0,192,88,66,57,65,208,67,190,2,154,73,134,6,129,97,108,68,
+117,65,182,41,14,1,104,4,255,159,31,103,89,65,183,73,71,97,129,96,205,41,
+129,99,129,97,129,98,238,65,196,65,203,41,129,99,129,98,177,73,101,65,203,
+41,12,96,31,96,0,99,188,9,12,96,28,96,71,97,82,72,129,96,224,41,128,97,
+129,98,185,73,101,65,222,41,71,97,0,107,231,66,141,98,12,96,28,96,0,107,
+209,9,12,96,28,96,71,97,0,103,141,98,31,109,129,96,183,73,89,65,202,67,198,
+66,207,73,101,65,240,41,98,68,247,66,28,96,11,65,11,65,226,73,250,41,76,
+128,185,66,255,255,3,103,202,3,0,224,0,224,226,73,1,42,65,128,185,66,31,97,
+0,224,0,192,226,73,8,42,67,128,185,66,230,9,0,224,0,160,226,73,15,42,90,
+128,185,66,230,9,66,128,185,66,230,9,71,97,129,96,129,98,3,110,32,42,201,
+67,210,66,129,99,201,67,198,66,241,73,190,66,83,65,19,10,12,96,31,97,168,
+18,3,115,101,101,83,69,157,68,203,70,128,97,129,109,45,42,3,97,88,66,71,
+97,190,66,210,66,129,96,115,68,129,96,190,66,108,68,141,98,18,74,198,66,
+59,128,185,66,129,96,125,68,69,42,254,69,13,32,99,111,109,112,105,108,101,
+45,111,110,108,121,129,96,128,68,77,42,254,69,7,32,105,110,108,105,110,
+101,119,68,86,42,254,69,10,32,105,109,109,101,100,105,97,116,101,0,190,2,
+68,20,2,46,115,0,220,66,101,65,98,42,129,96,228,66,213,67,0,107,91,10,254,
+69,4,32,60,115,112,0,190,2,95,65,71,97,109,10,129,99,202,67,83,65,129,126,
+106,42,28,96,174,20,4,100,117,109,112,0,16,128,35,101,4,128,3,112,71,97,
+133,10,190,66,16,128,138,65,129,97,202,67,210,66,103,74,238,65,2,128,199,
+66,8,67,129,126,122,42,31,97,5,73,32,9,129,96,0,132,46,73,3,110,33,65,24,
+128,71,3,138,74,44,73,136,74,63,101,0,0,1,108,82,9,42,21,1,118,5,73,88,9,
+48,21,1,110,1,128,7,73,151,74,154,10,56,21,1,112,9,65,159,10,68,21,1,122,
+136,74,0,132,32,128,11,99,28,96,76,21,1,107,145,74,64,128,170,10,90,21,1,
+115,2,73,21,9,100,21,1,113,52,128,230,8,108,21,1,120,184,74,5,73,60,73,251,
+8,116,21,2,105,97,0,44,73,35,101,136,74,35,101,217,65,21,65,35,101,128,
+97,215,65,3,96,21,65,57,65,11,98,65,5,128,21,1,105,0,128,128,97,195,10,
+
+};
+
+const size_t embed_default_block_size =  5548;
+
@@ -1,23 +1,675 @@
 /* Embed Forth Virtual Machine, Richard James Howe, 2017-2018, MIT License */
 #include "embed.h"
+#include "jit.h"
+#include "super.h"
 #include <assert.h>
 #include <stdint.h>
 #include <stddef.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 
 #define SHADOW    (7)     /**< start location of shadow registers */
 #define MIN(X, Y) ((X) > (Y) ? (Y) : (X))
 
+/* Cells holding variables of the eForth image that 'embed.fth' builds. The
+ * meta-compiler defines them as constants, compiled as literals, so unlike
+ * 'here' and 'pad' they have no header to be looked up by, and the functions
+ * that use them, 'embed_find', 'embed_call' and those built on them, only
+ * work with that image. */
+#define VM_HANDLER (0x400A >> 1) /**< 'handler', the frame 'throw' unwinds to */
+#define VM_EMIT    (0x4012 >> 1) /**< '<emit>', the execution vector of 'emit' */
+#define VM_CONTEXT (0x401A >> 1) /**< 'context', the search order, up to eight word lists */
+
 typedef cell_t        m_t; /**< The VM is 16-bit, 'uintptr_t' would be more useful */
 typedef signed_cell_t s_t; /**< used for signed calculation and casting */
 typedef double_cell_t d_t; /**< should be double the size of 'm_t' and unsigned */
+typedef signed_double_cell_t sd_t; /**< used for signed double cell calculations */
+
+typedef enum { /* 'decoded_t' codes, ALU operation 'N' is 'VM_ALU + N' */
+	VM_UNDECODED, VM_LITERAL, VM_BRANCH, VM_ZBRANCH, VM_CALL, VM_ALU,
+	VM_ALU_EXT     = VM_ALU + 32,         /**< first extended ALU operation, see 'EMBED_ALU_EXT' */
+	/* superinstructions, see 'super.h', only the first 32 ALU operations are fused */
+	VM_LIT_ALU     = VM_ALU_EXT + 32,     /**< literal, ALU operation 'N' is 'VM_LIT_ALU + N' */
+	VM_ALU_ZBRANCH = VM_LIT_ALU + 32,     /**< ALU operation 'N', 0branch is 'VM_ALU_ZBRANCH + N' */
+	VM_ALU_BRANCH  = VM_ALU_ZBRANCH + 32, /**< ALU operation 'N', branch is 'VM_ALU_BRANCH + N' */
+	VM_ALU_CALL    = VM_ALU_BRANCH + 32,  /**< ALU operation 'N', call is 'VM_ALU_CALL + N' */
+	VM_ALU_LIT     = VM_ALU_CALL + 32,    /**< ALU operation 'N', literal is 'VM_ALU_LIT + N' */
+	VM_LIT_LIT     = VM_ALU_LIT + 32,     /**< literal, literal */
+	VM_LIT_CALL,                          /**< literal, call */
+	VM_CODES,
+} decoded_e;
+
+typedef struct { /* a pre-decoded instruction, see 'embed_cache_size' */
+	uint8_t code;   /**< 'decoded_e' value, VM_UNDECODED if entry is invalid */
+	uint8_t flags;  /**< 't->n', 't->r', 'n->t' and 'r->pc' bits of an ALU instruction */
+	int8_t  dd, rd; /**< data and return stack deltas of an ALU instruction */
+	m_t     arg;    /**< literal value or branch/call target */
+	m_t     arg2;   /**< second literal or call target of a superinstruction */
+} decoded_t;
+
+/* A superinstruction covers the cell after the one it is decoded from as
+ * well, so a write to a cell also invalidates the entry before it. */
+static inline void vm_invalidate(decoded_t * const cache, const m_t addr) {
+	cache[addr % EMBED_CORE_SIZE].code = VM_UNDECODED;
+	cache[(addr - 1u) % EMBED_CORE_SIZE].code = VM_UNDECODED;
+}
 
 /* NB. MMU operations could be improved by allowing exceptions to be thrown */
 m_t  embed_mmu_read_cb(embed_t const * const h, m_t addr)       { return ((m_t*)h->m)[addr]; }
-void embed_mmu_write_cb(embed_t * const h, m_t addr, m_t value) { ((m_t*)h->m)[addr] = value; }
+void embed_mmu_write_cb(embed_t * const h, m_t addr, m_t value) {
+	((m_t*)h->m)[addr] = value;
+	if (h->cache)
+		vm_invalidate(h->cache, addr);
+	if (h->jit)
+		embed_jit_invalidate(h->jit, addr);
+}
+
+uint8_t embed_mmu_read_byte_cb(embed_t const * const h, m_t addr) {
+	return h->o.read(h, addr >> 1) >> ((addr & 1) << 3);
+}
+
+void embed_mmu_write_byte_cb(embed_t * const h, m_t addr, uint8_t value) {
+	const unsigned shift = (addr & 1) << 3;
+	const m_t cell = h->o.read(h, addr >> 1);
+	h->o.write(h, addr >> 1, (cell & ~(0xFFu << shift)) | ((m_t)value << shift));
+}
 
 static inline int is_big_endian(void)              { return (*(uint16_t *)"\0\xff" < 0x100); }
+
+/* Bulk memory operations for 'cmove' and 'fill', on 'length' bytes from the
+ * byte addresses 'dst' and 'src', in a core of 'bytes' bytes. The specialized
+ * loops ('fast') have the default MMU callbacks and can use 'memmove' and
+ * 'memset' on the core, unless the range wraps around it or the host is big
+ * endian, in which case it, and the general loop, go through the byte
+ * callbacks a byte at a time. Moving is done as if through a temporary buffer
+ * so that overlapping ranges are safe. */
+static void vm_written(embed_t * const h, const m_t dst, const m_t length) {
+	if (!length || !(h->cache || h->jit))
+		return;
+	for (size_t i = dst >> 1; i <= (dst + length - 1u) >> 1; i++) {
+		if (h->cache)
+			vm_invalidate(h->cache, i);
+		if (h->jit)
+			embed_jit_invalidate(h->jit, i);
+	}
+}
+
+/* the core as bytes from byte address 'b', if 'u' bytes from it can be used directly */
+static inline uint8_t *vm_direct(embed_t * const h, const int fast, const size_t bytes, const m_t b, const m_t u) {
+	return fast && !is_big_endian() && ((size_t)b + u) <= bytes ? (uint8_t*)h->m + b : NULL;
+}
+
+static inline m_t vm_byte(embed_t * const h, const uint8_t * const direct, const size_t bytes, const m_t b, const m_t i) {
+	if (direct)
+		return direct[i];
+	return (h->o.read_byte ? h->o.read_byte : embed_mmu_read_byte_cb)(h, (m_t)(b + i) % bytes);
+}
+
+static void vm_move(embed_t * const h, const int fast, const size_t bytes, const m_t dst, const m_t src, const m_t length) {
+	uint8_t * const to = vm_direct(h, fast, bytes, dst, length), * const from = vm_direct(h, fast, bytes, src, length);
+	if (to && from) {
+		memmove(to, from, length);
+		vm_written(h, dst, length);
+		return;
+	}
+	const embed_mmu_read_byte_t  mrb = h->o.read_byte  ? h->o.read_byte  : embed_mmu_read_byte_cb;
+	const embed_mmu_write_byte_t mwb = h->o.write_byte ? h->o.write_byte : embed_mmu_write_byte_cb;
+	for (size_t i = 0; i < length; i++) {
+		const m_t o = dst > src ? length - i - 1u : i;
+		mwb(h, (m_t)(dst + o) % bytes, mrb(h, (m_t)(src + o) % bytes));
+	}
+}
+
+static void vm_fill(embed_t * const h, const int fast, const size_t bytes, const m_t dst, const m_t length, const uint8_t c) {
+	if (fast && ((size_t)dst + length) <= bytes) {
+		memset((uint8_t*)h->m + dst, c, length);
+		vm_written(h, dst, length);
+		return;
+	}
+	const embed_mmu_write_byte_t mwb = h->o.write_byte ? h->o.write_byte : embed_mmu_write_byte_cb;
+	for (size_t i = 0; i < length; i++)
+		mwb(h, (m_t)(dst + i) % bytes, c);
+}
+
+/* A space delimiter is a class of bytes, memchr cannot find it, instead
+ * eight bytes at a time are tested for any byte below 0x21 (or above 0x20
+ * when skipping) with the 'hasless' and 'hasmore' tricks, leaving the byte
+ * loop to find which one it is. */
+#define VM_BYTES(N)   ((~(uint64_t)0 / 255u) * (N))
+#define VM_BLANKS(W)  (((W) - VM_BYTES(0x21)) & ~(W) & VM_BYTES(0x80))
+#define VM_GRAPHS(W)  ((((W) + VM_BYTES(127 - 0x20)) | (W)) & VM_BYTES(0x80))
+
+static m_t vm_blank(const uint8_t * const direct, const m_t u, const int skip) {
+	m_t i = 0;
+	for (uint64_t w = 0; (size_t)i + sizeof w <= u; i += sizeof w) {
+		memcpy(&w, direct + i, sizeof w);
+		if (skip ? VM_GRAPHS(w) : VM_BLANKS(w))
+			break;
+	}
+	for (; i < u; i++)
+		if ((direct[i] <= ' ') != skip)
+			return i;
+	return u;
+}
+
+/* Text scanning for 'parse' and 'compare', on byte addresses as above. As
+ * in the Forth words these replace, a space as the delimiter 'c' matches
+ * any control character as well. 'vm_scan' returns the number of bytes
+ * before the first delimiter in the string 'b' of length 'u', or before the
+ * first non-delimiter if 'skip' is set. */
+static m_t vm_scan(embed_t * const h, const int fast, const size_t bytes, const m_t b, const m_t u, const m_t c, const int skip) {
+	const uint8_t * const direct = vm_direct(h, fast, bytes, b, u);
+	if (direct && c == ' ')
+		return vm_blank(direct, u, skip);
+	if (direct && !skip && c < 0x100) {
+		const uint8_t * const found = memchr(direct, c, u);
+		return found ? (m_t)(found - direct) : u;
+	}
+	for (m_t i = 0; i < u; i++) {
+		const m_t ch = vm_byte(h, direct, bytes, b, i);
+		if ((c == ' ' ? ch <= ' ' : ch == c) != skip)
+			return i;
+	}
+	return u;
+}
+
+static m_t vm_trailing(embed_t * const h, const int fast, const size_t bytes, const m_t b, m_t u) {
+	const uint8_t * const direct = vm_direct(h, fast, bytes, b, u);
+	while (u && vm_byte(h, direct, bytes, b, u - 1u) <= ' ')
+		u--;
+	return u;
+}
+
+/* Strings of different lengths compare as the difference in length, else it
+ * is the difference of the first pair of bytes that differ */
+static m_t vm_compare(embed_t * const h, const int fast, const size_t bytes, const m_t a1, const m_t u1, const m_t a2, const m_t u2) {
+	if (u1 != u2)
+		return u1 - u2;
+	const uint8_t * const d1 = vm_direct(h, fast, bytes, a1, u1), * const d2 = vm_direct(h, fast, bytes, a2, u2);
+	if (d1 && d2 && !memcmp(d1, d2, u1))
+		return 0;
+	for (m_t i = 0; i < u1; i++) {
+		const m_t diff = vm_byte(h, d1, bytes, a1, i) - vm_byte(h, d2, bytes, a2, i);
+		if (diff)
+			return diff;
+	}
+	return 0;
+}
+
+/* write 'length' bytes of 'data' to the core at byte address 'a' */
+static void vm_store(embed_t * const h, const int fast, const size_t bytes, const m_t a, const uint8_t * const data, const m_t length) {
+	uint8_t * const direct = vm_direct(h, fast, bytes, a, length);
+	if (direct) {
+		memcpy(direct, data, length);
+		vm_written(h, a, length);
+		return;
+	}
+	const embed_mmu_write_byte_t mwb = h->o.write_byte ? h->o.write_byte : embed_mmu_write_byte_cb;
+	for (size_t i = 0; i < length; i++)
+		mwb(h, (m_t)(a + i) % bytes, data[i]);
+}
+
+/* read 'length' bytes from the core at byte address 'a' into 'data' */
+static void vm_load(embed_t * const h, const int fast, const size_t bytes, const m_t a, uint8_t * const data, const m_t length) {
+	const uint8_t * const direct = vm_direct(h, fast, bytes, a, length);
+	if (direct) {
+		memcpy(data, direct, length);
+		return;
+	}
+	for (m_t i = 0; i < length; i++)
+		data[i] = vm_byte(h, NULL, bytes, a, i);
+}
+
+/* Numeric conversion for '>number' and '#s', digits are '0' to '9' then 'A'
+ * onwards as in the Forth words 'digit?' and 'digit'. 'vm_number' adds the
+ * digits at the start of the string 'b' of length 'u' to '*ud', returning
+ * how many there were. 'vm_digits' stores the digits of '*ud', least
+ * significant first, in the bytes before 'a' and returns where they start. */
+static m_t vm_number(embed_t * const h, const int fast, const size_t bytes, const m_t b, const m_t u, const m_t base, d_t * const ud) {
+	const uint8_t * const direct = vm_direct(h, fast, bytes, b, u);
+	for (m_t i = 0; i < u; i++) {
+		m_t digit = vm_byte(h, direct, bytes, b, i) - '0';
+		if (digit > 9 && (digit -= 7) < 10)
+			return i;
+		if (digit >= base)
+			return i;
+		*ud = (*ud * base) + digit;
+	}
+	return u;
+}
+
+static m_t vm_digits(embed_t * const h, const int fast, const size_t bytes, m_t a, d_t *ud, const m_t base) {
+	uint8_t digits[sizeof(d_t) * 8];
+	size_t u = sizeof(digits);
+	do {
+		const m_t digit = *ud % base;
+		*ud /= base;
+		digits[--u] = digit + (digit > 9 ? 'A' - 10 : '0');
+	} while (*ud);
+	const m_t length = sizeof(digits) - u;
+	a -= length;
+	vm_store(h, fast, bytes, a, digits + u, length);
+	return a;
+}
+
+/* CRC-16/CCITT, polynomial $1021 and initial value $FFFF, for 'crc' and
+ * 'embed_crc', a byte at a time with a table instead of the shifts used by
+ * the Forth word 'ccitt' it replaces */
+static inline m_t vm_crc_byte(const m_t crc, const uint8_t byte) {
+	static const uint16_t table[256] = {
+	0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+	0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF,
+	0x1231, 0x0210, 0x3273, 0x2252, 0x52B5, 0x4294, 0x72F7, 0x62D6,
+	0x9339, 0x8318, 0xB37B, 0xA35A, 0xD3BD, 0xC39C, 0xF3FF, 0xE3DE,
+	0x2462, 0x3443, 0x0420, 0x1401, 0x64E6, 0x74C7, 0x44A4, 0x5485,
+	0xA56A, 0xB54B, 0x8528, 0x9509, 0xE5EE, 0xF5CF, 0xC5AC, 0xD58D,
+	0x3653, 0x2672, 0x1611, 0x0630, 0x76D7, 0x66F6, 0x5695, 0x46B4,
+	0xB75B, 0xA77A, 0x9719, 0x8738, 0xF7DF, 0xE7FE, 0xD79D, 0xC7BC,
+	0x48C4, 0x58E5, 0x6886, 0x78A7, 0x0840, 0x1861, 0x2802, 0x3823,
+	0xC9CC, 0xD9ED, 0xE98E, 0xF9AF, 0x8948, 0x9969, 0xA90A, 0xB92B,
+	0x5AF5, 0x4AD4, 0x7AB7, 0x6A96, 0x1A71, 0x0A50, 0x3A33, 0x2A12,
+	0xDBFD, 0xCBDC, 0xFBBF, 0xEB9E, 0x9B79, 0x8B58, 0xBB3B, 0xAB1A,
+	0x6CA6, 0x7C87, 0x4CE4, 0x5CC5, 0x2C22, 0x3C03, 0x0C60, 0x1C41,
+	0xEDAE, 0xFD8F, 0xCDEC, 0xDDCD, 0xAD2A, 0xBD0B, 0x8D68, 0x9D49,
+	0x7E97, 0x6EB6, 0x5ED5, 0x4EF4, 0x3E13, 0x2E32, 0x1E51, 0x0E70,
+	0xFF9F, 0xEFBE, 0xDFDD, 0xCFFC, 0xBF1B, 0xAF3A, 0x9F59, 0x8F78,
+	0x9188, 0x81A9, 0xB1CA, 0xA1EB, 0xD10C, 0xC12D, 0xF14E, 0xE16F,
+	0x1080, 0x00A1, 0x30C2, 0x20E3, 0x5004, 0x4025, 0x7046, 0x6067,
+	0x83B9, 0x9398, 0xA3FB, 0xB3DA, 0xC33D, 0xD31C, 0xE37F, 0xF35E,
+	0x02B1, 0x1290, 0x22F3, 0x32D2, 0x4235, 0x5214, 0x6277, 0x7256,
+	0xB5EA, 0xA5CB, 0x95A8, 0x8589, 0xF56E, 0xE54F, 0xD52C, 0xC50D,
+	0x34E2, 0x24C3, 0x14A0, 0x0481, 0x7466, 0x6447, 0x5424, 0x4405,
+	0xA7DB, 0xB7FA, 0x8799, 0x97B8, 0xE75F, 0xF77E, 0xC71D, 0xD73C,
+	0x26D3, 0x36F2, 0x0691, 0x16B0, 0x6657, 0x7676, 0x4615, 0x5634,
+	0xD94C, 0xC96D, 0xF90E, 0xE92F, 0x99C8, 0x89E9, 0xB98A, 0xA9AB,
+	0x5844, 0x4865, 0x7806, 0x6827, 0x18C0, 0x08E1, 0x3882, 0x28A3,
+	0xCB7D, 0xDB5C, 0xEB3F, 0xFB1E, 0x8BF9, 0x9BD8, 0xABBB, 0xBB9A,
+	0x4A75, 0x5A54, 0x6A37, 0x7A16, 0x0AF1, 0x1AD0, 0x2AB3, 0x3A92,
+	0xFD2E, 0xED0F, 0xDD6C, 0xCD4D, 0xBDAA, 0xAD8B, 0x9DE8, 0x8DC9,
+	0x7C26, 0x6C07, 0x5C64, 0x4C45, 0x3CA2, 0x2C83, 0x1CE0, 0x0CC1,
+	0xEF1F, 0xFF3E, 0xCF5D, 0xDF7C, 0xAF9B, 0xBFBA, 0x8FD9, 0x9FF8,
+	0x6E17, 0x7E36, 0x4E55, 0x5E74, 0x2E93, 0x3EB2, 0x0ED1, 0x1EF0,
+	};
+	return (crc << 8) ^ table[((crc >> 8) ^ byte) & 0xFF];
+}
+
+static m_t vm_crc(embed_t * const h, const int fast, const size_t bytes, const m_t b, const m_t u) {
+	const uint8_t * const direct = vm_direct(h, fast, bytes, b, u);
+	m_t crc = 0xFFFF;
+	for (m_t i = 0; i < u; i++)
+		crc = vm_crc_byte(crc, vm_byte(h, direct, bytes, b, i));
+	return crc;
+}
+
+/* Floored division for 'm/mod', the quotient is rounded towards negative
+ * infinity so the remainder takes the sign of the divisor */
+static inline sd_t vm_floored(const sd_t d, const s_t n, s_t * const remainder) {
+	if (n == -1) { /* 'd / n' could overflow */
+		*remainder = 0;
+		return (sd_t)(0u - (d_t)d);
+	}
+	sd_t q = d / n, r = d % n;
+	if (r && ((r < 0) != (n < 0))) {
+		q--;
+		r += n;
+	}
+	*remainder = r;
+	return q;
+}
+
+/* Floating point unit, see 'embed_fpu_t' and 'float.fth'. There is no
+ * dependency on the maths library, rounding is done by converting to an
+ * integer, which is exact for floats that have a fractional part. */
+static inline float vm_floor(const float r) {
+	if (!(r > -8388608.0f && r < 8388608.0f)) /* 2^23, large floats and NaN are integers */
+		return r;
+	const float i = (float)(int32_t)r;
+	return i > r ? i - 1.0f : i;
+}
+
+static inline float vm_round(const float r) { /* round half to even, as 'fround' requires */
+	if (!(r > -8388608.0f && r < 8388608.0f))
+		return r;
+	const float i = vm_floor(r), fraction = r - i;
+	return fraction > 0.5f || (fraction == 0.5f && ((int32_t)i & 1)) ? i + 1.0f : i;
+}
+
+/* truncate towards zero, out of range values and NaN become '-limit' */
+static inline sd_t vm_truncate(const float r, const float limit) {
+	return r > -limit - 1.0f && r < limit ? (sd_t)r : (sd_t)-limit;
+}
+
+/* '>float', the string 'b' of length 'u' is converted if it has the syntax
+ * of the Forth standard, which 'strtof' accepts once the exponent has been
+ * put into the form it expects, or is all spaces. */
+static int vm_to_float(embed_t * const h, const int fast, const size_t bytes, const m_t b, const m_t u, float * const r) {
+	const uint8_t * const direct = vm_direct(h, fast, bytes, b, u);
+	char buf[64];
+	m_t i = 0, j = 0, digits = 0;
+	while (i < u && vm_byte(h, direct, bytes, b, i) == ' ')
+		i++;
+	if (i == u) {
+		*r = 0.0f;
+		return 1;
+	}
+	if (u > sizeof(buf) - 3)
+		return 0;
+	i = 0;
+#define VM_PEEK() (i < u ? vm_byte(h, direct, bytes, b, i) : 0)
+	if (VM_PEEK() == '+' || VM_PEEK() == '-')
+		buf[j++] = VM_PEEK(), i++;
+	for (; VM_PEEK() >= '0' && VM_PEEK() <= '9'; i++, digits++)
+		buf[j++] = VM_PEEK();
+	if (VM_PEEK() == '.')
+		for (buf[j++] = '.', i++; VM_PEEK() >= '0' && VM_PEEK() <= '9'; i++, digits++)
+			buf[j++] = VM_PEEK();
+	if (!digits)
+		return 0;
+	const m_t c = VM_PEEK();
+	if (c == 'e' || c == 'E' || c == 'd' || c == 'D' || c == '+' || c == '-') {
+		buf[j++] = 'e';
+		if (c != '+' && c != '-')
+			i++;
+		if (VM_PEEK() == '+' || VM_PEEK() == '-')
+			buf[j++] = VM_PEEK(), i++;
+		if (!(VM_PEEK() >= '0' && VM_PEEK() <= '9'))
+			buf[j++] = '0';
+		for (; VM_PEEK() >= '0' && VM_PEEK() <= '9'; i++)
+			buf[j++] = VM_PEEK();
+	}
+#undef VM_PEEK
+	if (i != u)
+		return 0;
+	buf[j] = 0;
+	*r = strtof(buf, NULL);
+	return 1;
+}
+
+/* 'represent', the 'u' most significant digits of 'r' are stored at 'b' and
+ * the exponent, sign and whether 'r' is finite are returned in 'c' */
+static void vm_represent(embed_t * const h, const int fast, const size_t bytes, const m_t b, const m_t u, const float r, m_t c[3]) {
+	char buf[64] = { 0 };
+	uint8_t digits[48] = { 0 };
+	const int finite = r == r && r - r == 0.0f;
+	const m_t precision = MIN(u, 40);
+	m_t length = 0;
+	c[0] = 0;
+	if (finite) {
+		snprintf(buf, sizeof buf, "%.*e", precision ? precision - 1 : 0, r < 0 ? -r : r);
+		char *e = buf;
+		for (; *e && *e != 'e'; e++)
+			if (*e != '.')
+				digits[length++] = *e;
+		c[0] = strtol(e + 1, NULL, 10) + 1;
+	} else {
+		snprintf(buf, sizeof buf, "%s", r == r ? "inf" : "nan");
+		for (; buf[length]; length++)
+			digits[length] = buf[length];
+	}
+	length = MIN(length, u);
+	vm_store(h, fast, bytes, b, digits, length);
+	vm_fill(h, fast, bytes, (m_t)(b + length), u - length, finite ? '0' : ' ');
+	c[1] = -(r < 0);
+	c[2] = -finite;
+}
+
+/* 'c' holds the top three cells of the data stack, deepest first, which the
+ * operation 'op' replaces the top '*in' of with '*out' cells, starting at
+ * 'c[0]'. Floats are stored in the core as two cells, the lower half first.
+ * Returns zero, or a number for the trap handler to throw (negated). */
+static m_t vm_fpu(embed_t * const h, const int fast, const size_t bytes, const m_t op, m_t c[3], int * const in, int * const out) {
+	static const struct { uint8_t in, fin, fout; } ops[] = { /* data stack cells and floats used */
+		{ 0, 0, 0 }, /*  0: fdepth    ( -- n ) */
+		{ 0, 1, 0 }, /*  1: fdrop */
+		{ 0, 1, 2 }, /*  2: fdup */
+		{ 0, 2, 2 }, /*  3: fswap */
+		{ 0, 2, 3 }, /*  4: fover */
+		{ 0, 3, 3 }, /*  5: frot */
+		{ 0, 2, 1 }, /*  6: f+ */
+		{ 0, 2, 1 }, /*  7: f- */
+		{ 0, 2, 1 }, /*  8: f* */
+		{ 0, 2, 1 }, /*  9: f/ */
+		{ 0, 1, 1 }, /* 10: fnegate */
+		{ 0, 1, 1 }, /* 11: fabs */
+		{ 0, 2, 1 }, /* 12: fmax */
+		{ 0, 2, 1 }, /* 13: fmin */
+		{ 0, 1, 1 }, /* 14: floor */
+		{ 0, 1, 1 }, /* 15: fround */
+		{ 0, 1, 0 }, /* 16: f0<       ( -- f ) */
+		{ 0, 1, 0 }, /* 17: f0=       ( -- f ) */
+		{ 0, 2, 0 }, /* 18: f<        ( -- f ) */
+		{ 1, 0, 1 }, /* 19: s>f       ( n -- ) */
+		{ 2, 0, 1 }, /* 20: d>f       ( d -- ) */
+		{ 0, 1, 0 }, /* 21: f>s       ( -- n ) */
+		{ 0, 1, 0 }, /* 22: f>d       ( -- d ) */
+		{ 1, 0, 1 }, /* 23: f@        ( a -- ) */
+		{ 1, 1, 0 }, /* 24: f!        ( a -- ) */
+		{ 2, 0, 1 }, /* 25: bits>f    ( u u -- ) */
+		{ 0, 1, 0 }, /* 26: f>bits    ( -- u u ) */
+		{ 2, 0, 1 }, /* 27: >float    ( b u -- f ), only pushes a float if it succeeds */
+		{ 2, 1, 0 }, /* 28: represent ( b u -- n f f ) */
+	};
+	BUILD_BUG_ON(sizeof(float) != sizeof(d_t));
+	embed_fpu_t * const f = h->fpu;
+	if (op >= sizeof(ops)/sizeof(ops[0]))
+		return 21;
+	if (f->depth < ops[op].fin)
+		return 45;
+	if (f->depth - ops[op].fin + ops[op].fout > EMBED_FPU_DEPTH)
+		return 44;
+	float * const s = f->stack + f->depth - ops[op].fin;
+	const float x = ops[op].fin ? s[0] : 0.0f;
+	const m_t cells = bytes / 2u;
+	size_t fout = ops[op].fout;
+	d_t d = 0;
+	*in = ops[op].in;
+	*out = 0;
+	switch (op) {
+	case  0: c[0] = f->depth; *out = 1; break;
+	case  1: break;
+	case  2: s[1] = x; break;
+	case  3: s[0] = s[1]; s[1] = x; break;
+	case  4: s[2] = x; break;
+	case  5: s[0] = s[1]; s[1] = s[2]; s[2] = x; break;
+	case  6: s[0] = x + s[1]; break;
+	case  7: s[0] = x - s[1]; break;
+	case  8: s[0] = x * s[1]; break;
+	case  9: s[0] = x / s[1]; break;
+	case 10: s[0] = -x; break;
+	case 11: s[0] = x < 0 ? -x : x; break;
+	case 12: s[0] = x < s[1] ? s[1] : x; break;
+	case 13: s[0] = s[1] < x ? s[1] : x; break;
+	case 14: s[0] = vm_floor(x); break;
+	case 15: s[0] = vm_round(x); break;
+	case 16: c[0] = -(x < 0); *out = 1; break;
+	case 17: c[0] = -(x == 0); *out = 1; break;
+	case 18: c[0] = -(x < s[1]); *out = 1; break;
+	case 19: s[0] = (s_t)c[2]; break;
+	case 20: s[0] = (sd_t)(((d_t)c[2] << 16) | c[1]); break;
+	case 21: c[0] = vm_truncate(x, 32768.0f); *out = 1; break;
+	case 22: d = vm_truncate(x, 2147483648.0f); c[0] = d; c[1] = d >> 16; *out = 2; break;
+	case 23: d = h->o.read(h, (c[2] >> 1) % cells) | ((d_t)h->o.read(h, ((c[2] >> 1) + 1u) % cells) << 16);
+		memcpy(&s[0], &d, sizeof d);
+		break;
+	case 24: memcpy(&d, &x, sizeof d);
+		h->o.write(h, (c[2] >> 1) % cells, d);
+		h->o.write(h, ((c[2] >> 1) + 1u) % cells, d >> 16);
+		break;
+	case 25: d = ((d_t)c[2] << 16) | c[1]; memcpy(&s[0], &d, sizeof d); break;
+	case 26: memcpy(&d, &x, sizeof d); c[0] = d; c[1] = d >> 16; *out = 2; break;
+	case 27: c[0] = -vm_to_float(h, fast, bytes, c[1], c[2], &s[0]); fout = !!c[0]; *out = 1; break;
+	case 28: vm_represent(h, fast, bytes, c[1], c[2], x, c); *out = 3; break;
+	}
+	f->depth = f->depth - ops[op].fin + fout;
+	return 0;
+}
+
+/* Native overrides, see 'embed_native_add'. 'vm_native' is called in place
+ * of a call to an address with an override, with the registers in 'regs', it
+ * returns zero if the Forth word should be called as usual, otherwise the
+ * override was run and 'regs' continue after the call, or at the trap handler
+ * if it threw. */
+static int vm_native(embed_t * const h, const int fast, const size_t bytes, embed_natives_t * const n, const m_t addr, m_t regs[4]) {
+	embed_override_t * const e = &n->entry[n->slot[addr] - 1u];
+	if (vm_crc(h, fast, bytes, e->addr << 1, e->length << 1) != e->crc) {
+		e->passes++;
+		return 0;
+	}
+	for (size_t i = 0; i < 4; i++)
+		h->o.write(h, i, regs[i]);
+	const int r = e->fn(h, e->param);
+	if (r == EMBED_NATIVE_PASS) {
+		e->passes++;
+		return 0;
+	}
+	e->calls++;
+	for (size_t i = 0; i < 4; i++)
+		regs[i] = h->o.read(h, i);
+	if (r)
+		regs[0] = 4, regs[1] = r;
+	return 1;
+}
+
+static int vm_native_set(embed_natives_t * const n, const m_t addr, const m_t length, const m_t crc, const embed_native_t fn, void * const param) {
+	if (n->count >= EMBED_NATIVES || addr >= EMBED_CORE_SIZE || n->slot[addr])
+		return -1;
+	embed_override_t * const e = &n->entry[n->count];
+	memset(e, 0, sizeof(*e));
+	e->fn = fn, e->param = param, e->addr = addr, e->length = length, e->crc = crc;
+	n->slot[addr] = ++n->count;
+	return 0;
+}
+
+int embed_native_add(embed_t *h, embed_natives_t *n, const m_t xt, const m_t length, const embed_native_t fn, void *param) {
+	assert(h && n && fn);
+	return vm_native_set(n, xt >> 1, (length + 1u) >> 1, embed_crc(h, xt & ~1u, (length + 1u) & ~1u), fn, param);
+}
+
+/* '(search-wordlist)' ( a pwd -- pwd pwd 1 | pwd pwd -1 | 0 ), names are
+ * compared with their hidden bit, so hidden words are not found */
+static int vm_native_search(embed_t *h, void *param) {
+	(void)param;
+	const embed_mmu_read_byte_t mrb = h->o.read_byte ? h->o.read_byte : embed_mmu_read_byte_cb;
+	const m_t cells = embed_cells(h);
+	m_t a = 0, pwd = 0, prev = 0;
+	if (embed_pop(h, &pwd) < 0 || embed_pop(h, &a) < 0)
+		return 4;
+	const m_t u = mrb(h, a);
+	for (prev = pwd; pwd; prev = pwd, pwd = h->o.read(h, (pwd >> 1) % cells)) {
+		const m_t count = mrb(h, (m_t)(pwd + 2u));
+		m_t i = 0;
+		if ((count & 0x9F) != u)
+			continue;
+		for (i = 0; i < u && mrb(h, (m_t)(pwd + 3u + i)) == mrb(h, (m_t)(a + 1u + i)); i++)
+			;
+		if (i == u)
+			return embed_push(h, prev) || embed_push(h, pwd) || embed_push(h, count & 0x40 ? 1 : -1) ? 3 : 0;
+	}
+	return embed_push(h, 0) ? 3 : 0;
+}
+
+/* 'type' ( b u -- ), if '<emit>' holds a word that is just the instruction
+ * 'tx!', passed in 'param', as it does unless it has been changed */
+static int vm_native_type(embed_t *h, void *param) {
+	const m_t emit = h->o.read(h, VM_EMIT) >> 1, tx = (uintptr_t)param;
+	const embed_mmu_read_byte_t mrb = h->o.read_byte ? h->o.read_byte : embed_mmu_read_byte_cb;
+	m_t b = 0, u = 0;
+	if (!h->o.put || h->o.read(h, emit % embed_cells(h)) != tx)
+		return EMBED_NATIVE_PASS;
+	if (embed_pop(h, &u) < 0 || embed_pop(h, &b) < 0)
+		return 4;
+	for (m_t i = 0; i < u; i++)
+		h->o.put(mrb(h, (m_t)(b + i)), h->o.out);
+	return 0;
+}
+
+static inline m_t vm_block_cell(const uint8_t * const b, const size_t i) { return b[2*i] | (b[2*i + 1] << 8); }
+
+/* The default overrides are found by name in the headers of the words in
+ * 'embed_default_block', a header is a cell with a link to the header of the
+ * word defined before it in the same word list, or zero, then the name, a
+ * counted string whose count has the flags in its top three bits, then the
+ * code. 'vm_block_header' finds the header of the last word called 'name'. */
+static size_t vm_block_header(const uint8_t * const b, const size_t cells, const char * const name) {
+	const size_t u = strlen(name);
+	size_t found = 0;
+	for (size_t i = 1; i + 1 + u / 2 < cells; i++) {
+		const m_t link = vm_block_cell(b, i - 1);
+		if ((b[2*i] & 0x9F) == u && !(link & 1) && link < 2*(i - 1) && !memcmp(&b[2*i + 1], name, u))
+			found = i - 1;
+	}
+	return found;
+}
+
+static inline size_t vm_block_code(const uint8_t * const b, const size_t header) {
+	return header + 1 + (((b[2*(header + 1)] & 0x1F) + 2) >> 1);
+}
+
+/* the header of the next word in the same word list, where the body of the word before it ends */
+static size_t vm_block_next(const uint8_t * const b, const size_t cells, const size_t header) {
+	for (size_t i = header + 1; i + 1 < cells; i++)
+		if (vm_block_cell(b, i) == 2*header && (b[2*(i + 1)] & 0x1F))
+			return i;
+	return cells;
+}
+
+int embed_native_default(embed_natives_t *n) {
+	assert(n);
+	static const struct {
+		const char *name;   /* word to override */
+		int follow;         /* override the word it calls first instead */
+		embed_native_t fn;
+	} natives[] = {
+		{ "search-wordlist", 1, vm_native_search }, /* '(search-wordlist)' has no header */
+		{ "type",            0, vm_native_type   }, /* and the headerless 'typist' it falls through into */
+	};
+	const uint8_t * const b = embed_default_block;
+	const size_t cells = MIN((size_t)vm_block_cell(b, 15) >> 1, embed_default_block_size >> 1);
+	const size_t tx = vm_block_header(b, cells, "tx!");
+	void * const param = tx ? (void*)(uintptr_t)vm_block_cell(b, vm_block_code(b, tx)) : NULL;
+	int added = 0;
+	for (size_t i = 0; i < sizeof(natives)/sizeof(natives[0]); i++) {
+		const size_t header = vm_block_header(b, cells, natives[i].name);
+		size_t addr = vm_block_code(b, header), end = vm_block_next(b, cells, header);
+		if (!header || !tx)
+			return -1;
+		if (natives[i].follow) {
+			const m_t call = vm_block_cell(b, addr);
+			if ((call & 0xE000) != 0x4000 || (call & 0x1FFF) >= header)
+				return -1;
+			addr = call & 0x1FFF, end = header;
+		}
+		m_t crc = 0xFFFF;
+		for (size_t j = 2*addr; j < 2*end; j++)
+			crc = vm_crc_byte(crc, b[j]);
+		if (vm_native_set(n, addr, end - addr, crc, natives[i].fn, param) < 0)
+			return -1;
+		added++;
+	}
+	return added;
+}
+
+size_t embed_cache_size(void)                      { return EMBED_CORE_SIZE * sizeof(decoded_t); }
+void embed_cache_flush(embed_t *h) {
+	assert(h);
+	if (h->cache)
+		memset(h->cache, 0, embed_cache_size());
+	if (h->jit)
+		embed_jit_flush(h->jit);
+}
+
+void embed_core_dirty(embed_t *h, const m_t addr, const size_t cells) {
+	assert(h);
+	for (size_t i = 0; i < cells && i < EMBED_CORE_SIZE; i++) {
+		const m_t a = (m_t)(addr + i) % EMBED_CORE_SIZE;
+		if (h->cache)
+			vm_invalidate(h->cache, a);
+		if (h->jit)
+			embed_jit_invalidate(h->jit, a);
+	}
+}
+
 static void embed_normalize(embed_t *h, size_t l)  { assert(h); if (is_big_endian()) embed_buffer_swap(h->m, l); }
 int embed_nputc_cb(int ch, void *file)             { (void)file; return ch; }
 int embed_ngetc_cb(void *file, int *no_data)       { (void)file; assert(no_data); *no_data = 0; return -1; }
@@ -34,6 +686,7 @@ int embed_load_buffer(embed_t *h, const uint8_t *buf, size_t length) {
 	assert(h && buf);
 	memcpy(h->m, buf, MIN(EMBED_CORE_SIZE*2, length));
 	embed_normalize(h, length/2);
+	embed_cache_flush(h);
 	return length < 128 ? -70 /* read-file IOR */ : 0; /* minimum size checks, 128 bytes */
 }
 
@@ -75,6 +728,222 @@ int embed_eval(embed_t *h, const char *str) {
 	return r;
 }
 
+/* The search order is at 'context', up to eight word lists ending with a
+ * zero, each holding the header of the last word defined in it, see
+ * 'vm_native_search' for the layout of a header */
+int embed_find(embed_t *h, const char *name, cell_t *xt) {
+	assert(h && name && xt);
+	const embed_mmu_read_t mr = h->o.read;
+	const embed_mmu_read_byte_t mrb = h->o.read_byte ? h->o.read_byte : embed_mmu_read_byte_cb;
+	const m_t cells = embed_cells(h);
+	const size_t u = strlen(name);
+	*xt = 0;
+	if (!u || u > 0x1F)
+		return -1;
+	for (m_t i = 0, wid = 0; i < 8 && (wid = mr(h, (VM_CONTEXT + i) % cells)); i++)
+		for (m_t pwd = mr(h, (wid >> 1) % cells); pwd; pwd = mr(h, (pwd >> 1) % cells)) {
+			size_t j = 0;
+			if ((mrb(h, (m_t)(pwd + 2u)) & 0x9F) != u)
+				continue;
+			for (j = 0; j < u && mrb(h, (m_t)(pwd + 3u + j)) == (uint8_t)name[j]; j++)
+				;
+			if (j == u) {
+				*xt = pwd + 2u + ((u + 2u) & ~1u);
+				return 0;
+			}
+		}
+	return -1;
+}
+
+/* The dictionary pointer is found from the literal that 'here' compiles to */
+static int vm_dictionary_pointer(embed_t * const h, m_t * const cp) {
+	cell_t xt = 0;
+	*cp = 0;
+	if (embed_find(h, "here", &xt) < 0)
+		return -1;
+	const m_t literal = h->o.read(h, (xt >> 1) % embed_cells(h));
+	if (!(literal & 0x8000))
+		return -1;
+	*cp = (literal & 0x7FFF) >> 1;
+	return 0;
+}
+
+/* The frame is the one 'catch' makes (the stack pointer, 'handler' and the
+ * frame pointer, in cell 6, pushed onto the return stack and
+ * 'handler' pointed at it) under the return address of the sentinel. If the
+ * word returns normally it is to the sentinel with the frame still there, if
+ * it throws, 'throw' unwinds the frame and returns to the sentinel with the
+ * value thrown on top of the stack and the return stack as it was. The
+ * sentinel halts the virtual machine, as the program counter then leaves the
+ * core, before the instruction in it can be executed. The program counter,
+ * return stack and 'handler' are restored, the variable stack is left as the
+ * word left it. */
+static int vm_call(embed_t * const h, const cell_t xt) {
+	const embed_mmu_read_t  mr = h->o.read;
+	const embed_mmu_write_t mw = h->o.write;
+	const m_t cells = embed_cells(h), sentinel = cells - 1, handler = VM_HANDLER;
+	const m_t pc = mr(h, 0), rp = mr(h, 2), sp = mr(h, 3), old = mr(h, handler);
+	int r = 0;
+	if (rp < 5 || (m_t)(rp - 5) <= sp || rp > cells)
+		return -5; /* return stack overflow */
+	mw(h, rp - 1, sentinel << 1);
+	mw(h, rp - 2, sp << 1);
+	mw(h, rp - 3, old);
+	mw(h, rp - 4, mr(h, 6));
+	mw(h, handler, (rp - 4) << 1);
+	mw(h, rp - 5, sentinel << 1);
+	mw(h, 0, (xt >> 1) % cells);
+	mw(h, 2, rp - 5);
+	embed_vm(h);
+	if (mr(h, 0) != cells)
+		r = EMBED_CALL_HALTED;
+	else if (mr(h, 2) == rp)
+		r = (s_t)mr(h, 1);
+	else if (mr(h, 2) != rp - 4)
+		r = EMBED_CALL_HALTED;
+	mw(h, handler, old);
+	mw(h, 0, pc), mw(h, 2, rp);
+	return r;
+}
+
+int embed_call(embed_t *h, const cell_t xt, const cell_t *args, const size_t nargs, cell_t *results, const size_t nresults) {
+	assert(h && (args || !nargs) && (results || !nresults));
+	const embed_mmu_read_t  mr = h->o.read;
+	const embed_mmu_write_t mw = h->o.write;
+	const m_t t = mr(h, 1), sp = mr(h, 3);
+	const size_t depth = embed_depth(h);
+	int r = 0;
+	for (size_t i = 0; i < nargs; i++)
+		if ((r = embed_push(h, args[i])) < 0)
+			goto restore;
+	if ((r = vm_call(h, xt)))
+		goto restore;
+	if (embed_depth(h) < depth + nresults) {
+		r = -4; /* stack underflow */
+		goto restore;
+	}
+	for (size_t i = nresults; i-- > 0;)
+		embed_pop(h, &results[i]);
+restore:
+	mw(h, 1, t), mw(h, 3, sp);
+	return r;
+}
+
+/* The generation is a hash of the search order and the header of the last
+ * word defined in each word list in it, which changes whenever a word is
+ * defined, or forgotten, in them, and of 'base' and 'state'. A variable
+ * made by 'tvariable' is a call to 'doVar' followed by its cell, their
+ * addresses are looked up once. */
+static uint32_t vm_snippet_hash(uint32_t hash, const uint8_t byte) {
+	return (hash ^ byte) * 16777619u; /* FNV-1a */
+}
+
+static uint32_t vm_snippet_generation(embed_t * const h, embed_snippets_t * const s) {
+	static const char *variables[] = { "base", "state" };
+	const embed_mmu_read_t mr = h->o.read;
+	const m_t cells = embed_cells(h);
+	uint32_t hash = 2166136261u;
+	for (m_t i = 0, wid = 0; i < 8 && (wid = mr(h, (VM_CONTEXT + i) % cells)); i++) {
+		const m_t pwd = mr(h, (wid >> 1) % cells);
+		hash = vm_snippet_hash(vm_snippet_hash(hash, wid), wid >> 8);
+		hash = vm_snippet_hash(vm_snippet_hash(hash, pwd), pwd >> 8);
+	}
+	for (size_t i = 0; i < sizeof(variables)/sizeof(variables[0]); i++) {
+		cell_t xt = 0;
+		if (!s->variables[i] && embed_find(h, variables[i], &xt) == 0)
+			s->variables[i] = ((xt >> 1) + 1u) % cells;
+		const m_t v = s->variables[i] ? mr(h, s->variables[i]) : 0;
+		hash = vm_snippet_hash(vm_snippet_hash(hash, v), v >> 8);
+	}
+	return hash;
+}
+
+static void vm_snippet_flush(embed_snippets_t * const s) {
+	if (s->count)
+		s->flushes++;
+	s->count = 0;
+	s->used = 0;
+}
+
+/* evaluate a line that leaves one more cell on the stack, and pop it */
+static int vm_snippet_eval(embed_t * const h, const char * const line, m_t *result) {
+	const size_t depth = embed_depth(h);
+	if (embed_eval(h, line) < 0 || embed_depth(h) != depth + 1)
+		return -1;
+	return embed_pop(h, result);
+}
+
+static int vm_snippet_run(embed_t * const h, const cell_t xt) {
+	const m_t t = h->o.read(h, 1), sp = h->o.read(h, 3);
+	const int r = vm_call(h, xt);
+	if (r)
+		h->o.write(h, 1, t), h->o.write(h, 3, sp);
+	return r;
+}
+
+/* A snippet is compiled twice when it is first seen, at the end of the
+ * dictionary to measure it and then into the reserved area, setting the
+ * dictionary pointer with 'allot' and putting it back afterwards, so the
+ * code never needs relocating. Numbers are given in hexadecimal with a '$'
+ * prefix, so they are read correctly whatever 'base' is. If a snippet fails
+ * to compile the dictionary pointer is put back directly, as the code after
+ * the error is not run. */
+int embed_eval_cached(embed_t *h, embed_snippets_t *s, const char *str) {
+	assert(h && s && str);
+	char line[EMBED_SNIPPET_LENGTH + 64] = { 0 };
+	const size_t u = strlen(str);
+	const uint32_t generation = vm_snippet_generation(h, s);
+	uint32_t hash = 2166136261u;
+	m_t cp = 0, here = 0, size = 0, xt = 0;
+	if (u >= EMBED_SNIPPET_LENGTH)
+		return embed_eval(h, str);
+	for (size_t i = 0; i < u; i++)
+		hash = vm_snippet_hash(hash, (uint8_t)str[i]);
+	if (generation != s->generation) {
+		vm_snippet_flush(s);
+		s->generation = generation;
+	}
+	for (size_t i = 0; i < s->count; i++)
+		if (s->entry[i].hash == hash && !strcmp(s->entry[i].text, str)) {
+			s->hits++;
+			return vm_snippet_run(h, s->entry[i].xt);
+		}
+	s->misses++;
+	if (vm_dictionary_pointer(h, &cp) < 0)
+		return -1;
+	here = h->o.read(h, cp);
+	if (!s->area || here < s->area + EMBED_SNIPPET_AREA) { /* no area yet, or it was forgotten */
+		if (here + EMBED_SNIPPET_AREA > 0x4000) /* code must be in the first 16KiB */
+			return embed_eval(h, str);
+		snprintf(line, sizeof(line), "here $%X allot\n", (unsigned)EMBED_SNIPPET_AREA);
+		if (vm_snippet_eval(h, line, &here) < 0)
+			return -1;
+		vm_snippet_flush(s);
+		s->area = here;
+	}
+	here = h->o.read(h, cp);
+	snprintf(line, sizeof(line), "here :noname\n%s\n; drop here over - swap here - allot\n", str);
+	if (vm_snippet_eval(h, line, &size) < 0) {
+		h->o.write(h, cp, here);
+		return -1; /* it failed to compile, the error has been reported as it would have been */
+	}
+	if (size > EMBED_SNIPPET_AREA)
+		return embed_eval(h, str);
+	if (s->count >= EMBED_SNIPPETS || s->used + size > EMBED_SNIPPET_AREA)
+		vm_snippet_flush(s);
+	snprintf(line, sizeof(line), "here $%X over - allot :noname\n%s\n; swap here - allot\n", (unsigned)(s->area + s->used), str);
+	if (vm_snippet_eval(h, line, &xt) < 0) {
+		h->o.write(h, cp, here);
+		return -1;
+	}
+	embed_snippet_t * const e = &s->entry[s->count++];
+	e->hash = hash;
+	e->xt = xt;
+	memcpy(e->text, str, u + 1);
+	s->used += (size + 1u) & ~1u;
+	return vm_snippet_run(h, xt);
+}
+
 int embed_puts(embed_t *h, const char *s) {
 	assert(h && s);
 	embed_opt_t *o = &(h->o);
@@ -129,17 +998,231 @@ size_t embed_depth(embed_t *h) {
 	return sp - sp0;
 }
 
+/* The stack pointer points at the second item on the stack, the top is in
+ * cell 1, see 'embed_push' and 'embed_pop' for the checks made here */
+int embed_push_n(embed_t *h, const m_t *values, const size_t n) {
+	assert(h && (values || !n));
+	const embed_mmu_read_t  mr = h->o.read;
+	const embed_mmu_write_t mw = h->o.write;
+	assert(mr && mw);
+	m_t rp = mr(h, 2), sp = mr(h, 3), sp0 = mr(h, 3 + SHADOW), t = mr(h, 1);
+	if (sp < 32 || sp < sp0)
+		return -4; /* stack underflow */
+	if (sp > (EMBED_CORE_SIZE - 1) || n > (EMBED_CORE_SIZE - 1) - sp || sp + n > rp)
+		return -3; /* stack overflow */
+	if (mw == embed_mmu_write_cb) {
+		m_t * const core = h->m;
+		for (size_t i = 0; i < n; t = values[i++])
+			core[++sp] = t;
+	} else {
+		for (size_t i = 0; i < n; t = values[i++])
+			mw(h, ++sp, t);
+	}
+	mw(h, 1, t);
+	mw(h, 3, sp);
+	return 0;
+}
+
+int embed_pop_n(embed_t *h, m_t *values, const size_t n) {
+	assert(h && (values || !n));
+	const embed_mmu_read_t  mr = h->o.read;
+	const embed_mmu_write_t mw = h->o.write;
+	assert(mr && mw);
+	m_t rp = mr(h, 2), sp = mr(h, 3), sp0 = mr(h, 3 + SHADOW), t = mr(h, 1);
+	if (sp < 32 || sp < sp0 || n > (size_t)(sp - sp0))
+		return -4; /* stack underflow */
+	if (sp > (EMBED_CORE_SIZE - 1) || sp > rp)
+		return -3; /* stack overflow */
+	if (mr == embed_mmu_read_cb) {
+		const m_t * const core = h->m;
+		for (size_t i = n; i-- > 0; t = core[sp--])
+			values[i] = t;
+	} else {
+		for (size_t i = n; i-- > 0; t = mr(h, sp--))
+			values[i] = t;
+	}
+	mw(h, 1, t);
+	mw(h, 3, sp);
+	return 0;
+}
+
+/* The cell under the deepest item, at 'sp0 + 1', holds whatever was in the
+ * top of stack register when the stack was empty, so the view starts above
+ * it. The top of stack is kept in the cell above the stack pointer, which
+ * is free, while the view is open. */
+int embed_stack_view(embed_t *h, embed_stack_view_t *v) {
+	assert(h && v);
+	const embed_opt_t * const o = &h->o;
+	m_t * const core = h->m;
+	v->cells = NULL, v->depth = 0, v->capacity = 0;
+	if (o->read != embed_mmu_read_cb || o->write != embed_mmu_write_cb)
+		return -1;
+	const m_t rp = core[2], sp = core[3], sp0 = core[3 + SHADOW];
+	if (sp < sp0 || sp0 < 32 || sp + 1u >= rp || rp >= EMBED_CORE_SIZE)
+		return -1;
+	core[sp + 1] = core[1];
+	v->cells = &core[sp0 + 2];
+	v->depth = sp - sp0;
+	v->capacity = rp - sp0 - 2;
+	return 0;
+}
+
+int embed_stack_commit(embed_t *h, const embed_stack_view_t *v) {
+	assert(h && v);
+	m_t * const core = h->m;
+	const m_t sp0 = core[3 + SHADOW];
+	if (!v->cells || v->depth > v->capacity || v->cells != &core[sp0 + 2])
+		return -1;
+	core[3] = sp0 + v->depth;
+	core[1] = core[sp0 + v->depth + 1];
+	return 0;
+}
+
+/* Strings are copied with 'memcpy' when the MMU callbacks are the defaults,
+ * as they are for 'cmove' in 'embed_vm', and byte at a time through the
+ * byte callbacks otherwise. The transient area is at 'pad', a constant in the
+ * eForth image, a call to 'doConst' followed by its value, and the strings
+ * put there must end before the variable stack starts. */
+static int vm_pad(embed_t * const h, const size_t u, m_t * const pad) {
+	const m_t cells = embed_cells(h);
+	cell_t xt = 0;
+	*pad = 0;
+	if (embed_find(h, "pad", &xt) < 0)
+		return -1;
+	if ((h->o.read(h, (xt >> 1) % cells) & 0xE000) != 0x4000)
+		return -1;
+	const m_t a = h->o.read(h, ((xt >> 1) + 1u) % cells);
+	const size_t end = MIN(2u * (size_t)h->o.read(h, 3 + SHADOW), embed_length(h));
+	if (a >= end || u > end - a)
+		return -1;
+	*pad = a;
+	return 0;
+}
+
+static inline int vm_mmu_is_default(embed_t * const h) {
+	const embed_opt_t * const o = &h->o;
+	if (o->read != embed_mmu_read_cb || o->write != embed_mmu_write_cb)
+		return 0;
+	if ((o->read_byte && o->read_byte != embed_mmu_read_byte_cb) || (o->write_byte && o->write_byte != embed_mmu_write_byte_cb))
+		return 0;
+	return embed_cells(h) == EMBED_CORE_SIZE;
+}
+
+int embed_push_string(embed_t *h, const void *buf, const size_t u) {
+	assert(h && (buf || !u));
+	m_t a = 0;
+	if (vm_pad(h, u, &a) < 0)
+		return -1;
+	const m_t cells[2] = { a, u };
+	vm_store(h, vm_mmu_is_default(h), embed_length(h), a, buf, u);
+	return embed_push_n(h, cells, 2);
+}
+
+int embed_pop_string(embed_t *h, char *buf, const size_t size, size_t *u) {
+	assert(h && (buf || !size) && u);
+	m_t cells[2] = { 0, 0 };
+	*u = 0;
+	if (size)
+		buf[0] = '\0';
+	const int r = embed_pop_n(h, cells, 2);
+	if (r < 0)
+		return r;
+	*u = cells[1];
+	if (size) {
+		const m_t length = MIN(cells[1], size - 1u);
+		vm_load(h, vm_mmu_is_default(h), embed_length(h), cells[0], (uint8_t*)buf, length);
+		buf[length] = '\0';
+	}
+	return 0;
+}
+
+int embed_pop_string_view(embed_t *h, const char **s, size_t *u) {
+	assert(h && s && u);
+	m_t cells[2] = { 0, 0 };
+	*s = NULL, *u = 0;
+	if (!vm_mmu_is_default(h))
+		return -1;
+	const int r = embed_pop_n(h, cells, 2);
+	if (r < 0)
+		return r;
+	const uint8_t * const direct = vm_direct(h, 1, embed_length(h), cells[0], cells[1]);
+	if (!direct) {
+		embed_push_n(h, cells, 2);
+		return -1;
+	}
+	*s = (const char*)direct, *u = cells[1];
+	return 0;
+}
+
+int embed_counted_string(embed_t *h, const void *buf, const size_t u, const int dictionary, cell_t *c_addr) {
+	assert(h && (buf || !u) && c_addr);
+	const int fast = vm_mmu_is_default(h);
+	const size_t bytes = embed_length(h);
+	const uint8_t count = u;
+	m_t cp = 0, a = 0;
+	*c_addr = 0;
+	if (u > 0xFF)
+		return -1;
+	if (dictionary) {
+		if (vm_dictionary_pointer(h, &cp) < 0)
+			return -1;
+		a = h->o.read(h, cp);
+		if ((size_t)a + u + 2u > 0x3FFF) /* as '?dictionary' checks */
+			return -8;
+		h->o.write(h, cp, a + ((u + 2u) & ~1u));
+	} else if (vm_pad(h, u + 1u, &a) < 0) {
+		return -1;
+	}
+	vm_store(h, fast, bytes, a, &count, 1);
+	vm_store(h, fast, bytes, (m_t)(a + 1u), buf, u);
+	*c_addr = a;
+	return 0;
+}
+
+/* The word is compiled as 'float.fth' compiles the floating point words, a
+ * literal followed by the instruction, '#ext d-1 alu' ($760B), so that the
+ * index is dropped along with the arguments. The index is written in hex with
+ * a '$' prefix so that it is read the same whatever 'base' is. */
+int embed_register(embed_t *h, const char *name, const embed_extension_t fn, void *param, const m_t in, const m_t out) {
+	assert(h && name && fn);
+	embed_extensions_t * const x = h->extensions;
+	char line[80] = { 0 };
+	if (!x || x->count >= EMBED_EXTENSIONS || in > EMBED_EXTENSION_CELLS || out > EMBED_EXTENSION_CELLS)
+		return -1;
+	const size_t index = x->count;
+	if (snprintf(line, sizeof line, ": %s $%X [ $760B , ] ;\n", name, (unsigned)index) >= (int)sizeof line)
+		return -1;
+	embed_extension_entry_t * const e = &x->entry[index];
+	e->fn = fn, e->param = param, e->in = in, e->out = out, e->calls = 0;
+	x->count++;
+	const int r = embed_eval(h, line);
+	if (r < 0) {
+		x->count--;
+		return r;
+	}
+	return index;
+}
+
 embed_opt_t embed_opt_default(void) {
 	embed_opt_t o = {
 		.get      = embed_ngetc_cb, .put   = embed_nputc_cb, .save = NULL,
 		.in       = NULL,           .out   = NULL,           .name = NULL,
 		.write    = embed_mmu_write_cb,
 		.read     = embed_mmu_read_cb,
+		.write_byte = embed_mmu_write_byte_cb,
+		.read_byte  = embed_mmu_read_byte_cb,
 		.yield    = embed_yield_cb
 	};
 	return o;
 }
 
+/* A return stack delta of -2 is of no use to an ALU instruction, that encoding
+ * selects the extended operations, 32 to 63, which leave the return stack
+ * alone, instead. */
+static inline unsigned vm_operation(const m_t instruction) {
+	return ((instruction >> 8) & 0x1F) | (((instruction & 0xC) == 0x8) << 5);
+}
+
 #ifdef NDEBUG
 #define trace(VM,PC,INSTRUCTION,T,RP,SP)
 #else
@@ -150,12 +1233,12 @@ static int disassemble(m_t instruction, char *output, size_t length) {
 	if ((0x8000 & instruction)) {
 		return snprintf(output, length, "literal %04x", (unsigned)(0x1FFF & instruction));
 	} else if ((0xE000 & instruction) == 0x6000) {
-		const unsigned alu = (instruction >> 8) & 0x1F;
+		const unsigned alu = vm_operation(instruction);
 		const char *ttn    = (instruction & 0x80) ? "t->n  " : "      ";
 		const char *ttr    = (instruction & 0x40) ? "t->r  " : "      ";
 		const char *ntt    = (instruction & 0x20) ? "n->t  " : "      ";
 		const char *rtp    = (instruction & 0x10) ? "r->pc " : "      ";
-		const int rd       = extend((instruction >> 2) & 0x3);
+		const int rd       = alu < 32 ? extend((instruction >> 2) & 0x3) : 0;
 		const int dd       = extend((instruction     ) & 0x3);
 		return snprintf(output, length, "alu     %02x    %s%s%s%s rd(%2d) dd(%2d)", alu, ttn, ttr, ntt, rtp, rd, dd);
 	} else if (0x4000 & instruction) {
@@ -182,86 +1265,525 @@ static inline void trace(embed_t *h, m_t pc, m_t instruction, m_t t, m_t rp, m_t
 }
 #endif
 
+/* USE_COMPUTED_GOTO selects between two instruction dispatch methods in
+ * 'embed_vm'; the portable version decodes an instruction with a series of
+ * tests followed by a 'switch' on the ALU operation, the other jumps through a
+ * table of labels indexed by the top byte of the instruction, which is
+ * possible because GCC and Clang allow the address of a label to be taken. */
+#ifndef USE_COMPUTED_GOTO
+#ifdef __GNUC__
+#define USE_COMPUTED_GOTO (1)
+#else
+#define USE_COMPUTED_GOTO (0)
+#endif
+#endif
+
+/* ALU operations, 'X(OPERATION-NUMBER, CODE)', both instruction dispatch
+ * methods are generated from this list so they cannot diverge. 'n' and 'T'
+ * are set up beforehand, 'T' becomes the new top of stack afterwards.
+ * Operations 30 and 31 are the loop instructions compiled by 'next' and
+ * '+loop', each pushes a flag for the conditional branch back to the start
+ * of the loop that follows it. */
+#define EMBED_ALU(X)\
+	X( 0, T = t;)\
+	X( 1, T = n;)\
+	X( 2, T = MR(rp);)\
+	X( 3, T = MR((t>>1)%l);)\
+	X( 4, MW((t>>1)%l, n); T = MR(--sp);)\
+	X( 5, d = (d_t)t + n; T = d >> 16; MW(sp, d); n = d;)\
+	X( 6, d = (d_t)t * n; T = d >> 16; MW(sp, d); n = d;)\
+	X( 7, T = t&n;)\
+	X( 8, T = t|n;)\
+	X( 9, T = t^n;)\
+	X(10, T = ~t;)\
+	X(11, T = t-1;)\
+	X(12, T = -(t == 0);)\
+	X(13, T = -(t == n);)\
+	X(14, T = -(n < t);)\
+	X(15, T = -((s_t)n < (s_t)t);)\
+	X(16, T = n >> t;)\
+	X(17, T = n << t;)\
+	X(18, T = sp << 1;)\
+	X(19, T = rp << 1;)\
+	X(20, sp = t >> 1;)\
+	X(21, rp = t >> 1; T = n;)\
+	X(22, if (o->save) { T = o->save(h, o->name, n >> 1, ((d_t)t + 1) >> 1); } else { pc = 4; T = 21; })\
+	X(23, if (o->put) { T = o->put(t, o->out); } else { pc = 4; T = 21; })\
+	X(24, if (o->get) { int nd = 0; MW(++sp, t); T = o->get(o->in, &nd); t = T; n = nd; } else { pc = 4; T = 21; })\
+	X(25, if (t) { d = MR(--sp) | ((d_t)n << 16); T = d / t; t = d % t; n = t; } else { pc = 4; T = 10; })\
+	X(26, if (t) { T = (s_t)n / t; t = (s_t)n % t; n = t; } else { pc = 4; T = 10; })\
+	X(27, if (MR(rp)) { MW(rp, 0); sp--; r = t; t = n; goto finished; } T = t;)\
+	X(28, if (o->callback) {\
+			MW(0, pc); MW(1, t); MW(2, rp); MW(3, sp);\
+			r = o->callback(h, o->param);\
+			pc = MR(0); T = MR(1); rp = MR(2); sp = MR(3);\
+			if (r) { pc = 4; T = r; }\
+		} else { pc = 4; T = 21; })\
+	X(29, T = o->options; o->options = t;)\
+	X(30, if ((T = MR(rp))) { MW(rp, T - 1); T = 0; } else { rp++; T = -1; })\
+	X(31, d = (m_t)(MR(rp) - MR((m_t)((rp + 1) % l))); MW(rp, MR(rp) + t); T = -!!((d ^ (d + t)) & (d ^ t) & 0x8000);)
+
+/* Extended ALU operations, 'X(OPERATION-NUMBER, CODE)' as for 'EMBED_ALU',
+ * see 'vm_operation'. They take byte addresses, an even address being the
+ * lower byte of a cell, and are not fused into superinstructions. Unused
+ * operations throw like an unimplemented callback does. Operations 50 to 53
+ * implement local variables, a frame of them is moved from the variable stack
+ * to the return stack and addressed relative to a frame pointer kept in cell
+ * 6 of the image header, which is otherwise unused by the virtual machine.
+ * Operation 54 calls the host function with the index 't' in the table of
+ * 'embed_register', the cells it takes are under the index, too few of them
+ * throws a stack underflow. */
+#define EMBED_ALU_EXT(X)\
+	X(32, T = MRB(t);)\
+	X(33, MWB(t, n); T = MR(--sp);)\
+	X(34, vm_move(h, fast, 2u * l, n, MR((m_t)(sp - 1)), t); sp -= 2; T = MR(sp);)\
+	X(35, vm_fill(h, fast, 2u * l, MR((m_t)(sp - 1)), n, t); sp -= 2; T = MR(sp);)\
+	X(36, const m_t b_ = MR((m_t)(sp - 1)); d = vm_scan(h, fast, 2u * l, b_, n, t, 1); MW((m_t)(sp - 1), b_ + d); T = n - d;)\
+	X(37, const m_t b_ = MR((m_t)(sp - 1)); d = vm_scan(h, fast, 2u * l, b_, n, t, 0); MW((m_t)(sp - 1), b_ + d); T = n - d;)\
+	X(38, T = vm_trailing(h, fast, 2u * l, n, t);)\
+	X(39, T = vm_compare(h, fast, 2u * l, MR((m_t)(sp - 2)), MR((m_t)(sp - 1)), n, t); sp -= 2;)\
+	X(40, const m_t b_ = MR((m_t)(sp - 1)); d = ((d_t)MR((m_t)(sp - 2)) << 16) | MR((m_t)(sp - 3));\
+		const m_t u_ = vm_number(h, fast, 2u * l, b_, n, t, &d);\
+		MW((m_t)(sp - 3), d); MW((m_t)(sp - 2), d >> 16); MW((m_t)(sp - 1), b_ + u_); T = n - u_;)\
+	X(41, if (t > 1) { d = ((d_t)MR((m_t)(sp - 1)) << 16) | MR((m_t)(sp - 2));\
+			T = vm_digits(h, fast, 2u * l, n, &d, t); MW((m_t)(sp - 2), 0); MW((m_t)(sp - 1), 0);\
+		} else { pc = 4; T = t ? 17 : 10; })\
+	X(42, T = vm_crc(h, fast, 2u * l, n, t);)\
+	X(43, d = (((d_t)MR((m_t)(sp - 1)) << 16) | MR((m_t)(sp - 2))) + (((d_t)t << 16) | n); MW((m_t)(sp - 2), d); T = d >> 16;)\
+	X(44, d = (((d_t)MR((m_t)(sp - 1)) << 16) | MR((m_t)(sp - 2))) - (((d_t)t << 16) | n); MW((m_t)(sp - 2), d); T = d >> 16;)\
+	X(45, d = 0u - (((d_t)t << 16) | n); MW(sp, d); T = d >> 16;)\
+	X(46, T = -((sd_t)(((d_t)MR((m_t)(sp - 1)) << 16) | MR((m_t)(sp - 2))) < (sd_t)(((d_t)t << 16) | n)); sp -= 2;)\
+	X(47, d = (sd_t)(s_t)n * (s_t)t; MW(sp, d); T = d >> 16;)\
+	X(48, if (t) { s_t r_ = 0; T = vm_floored(((d_t)n << 16) | MR((m_t)(sp - 1)), t, &r_); MW((m_t)(sp - 1), r_); } else { pc = 4; T = 10; })\
+	X(49, if (h->fpu) { m_t c_[3]; int in_ = 0; int out_ = 0; c_[0] = MR((m_t)(sp - 2)); c_[1] = MR((m_t)(sp - 1)); c_[2] = n;\
+			if ((T = vm_fpu(h, fast, 2u * l, t, c_, &in_, &out_))) { pc = 4; } else {\
+			sp -= in_; for (int i_ = 0; i_ < out_; i_++) { MW(++sp, c_[i_]); } T = MR(sp); }\
+		} else { pc = 4; T = 21; })\
+	X(50, if (t <= sp && t < rp) { MW(--rp, MR(6)); MW(6, rp);\
+			for (m_t i_ = t; i_; i_--) { MW(--rp, MR((m_t)(sp - i_ + 1))); } sp -= t; T = MR(sp);\
+		} else { pc = 4; T = t <= sp ? 5 : 4; })\
+	X(51, rp = MR(6) % l; MW(6, MR(rp)); rp++;)\
+	X(52, T = MR((m_t)(MR(6) - 1 - t) % l);)\
+	X(53, MW((m_t)(MR(6) - 1 - t) % l, n); T = MR(--sp);)\
+	X(54, if (h->extensions && t < h->extensions->count) { embed_extension_entry_t * const e_ = &h->extensions->entry[t];\
+			if (e_->in >= (m_t)(sp - MR(3 + SHADOW))) { pc = 4; T = 4; } else {\
+			m_t c_[EMBED_EXTENSION_CELLS] = { 0 }; for (m_t i_ = 0; i_ < e_->in; i_++) { c_[i_] = MR((m_t)(sp - e_->in + 1u + i_)); }\
+			e_->calls++;\
+			if ((T = e_->fn(h, e_->param, c_))) { pc = 4; } else {\
+			sp -= e_->in; for (m_t i_ = 0; i_ < e_->out; i_++) { MW(++sp, c_[i_]); } T = MR(sp); } }\
+		} else { pc = 4; T = 21; })\
+	X(55, pc = 4; T = 21;) X(56, pc = 4; T = 21;) X(57, pc = 4; T = 21;)\
+	X(58, pc = 4; T = 21;) X(59, pc = 4; T = 21;) X(60, pc = 4; T = 21;) X(61, pc = 4; T = 21;)\
+	X(62, pc = 4; T = 21;) X(63, pc = 4; T = 21;)
+
+static inline void vm_decode_one(decoded_t * const dc, const m_t instruction) {
+	static const int8_t delta[] = { 0, 1, -2, -1 }, rdelta[] = { 0, 1, 0, -1 };
+	if (0x8000 & instruction) {
+		dc->code = VM_LITERAL;
+		dc->arg  = instruction & 0x7FFF;
+		return;
+	}
+	static const uint8_t codes[] = { VM_BRANCH, VM_ZBRANCH, VM_CALL, VM_ALU };
+	dc->code  = codes[instruction >> 13];
+	dc->arg   = instruction & 0x1FFF;
+	if (dc->code != VM_ALU)
+		return;
+	dc->code += vm_operation(instruction);
+	dc->flags = instruction & 0xF0;
+	dc->dd    = delta[ instruction       & 0x3];
+	dc->rd    = rdelta[(instruction >> 2) & 0x3];
+}
+
+/* Superinstructions are only executed by the computed goto version of the
+ * interpreter, the table of pairs to fuse is generated from a profile. */
+#define SUPER_PAIR(FIRST, SECOND) [FIRST][SECOND] = USE_COMPUTED_GOTO,
+static const uint8_t vm_fuse[VM_LIT_ALU][VM_LIT_ALU] = {
+	[VM_UNDECODED][VM_UNDECODED] = 0,
+	EMBED_SUPER(SUPER_PAIR)
+};
+
+/* Decode 'instruction', fusing it with the one that follows it, 'next', if
+ * that pair is in the superinstruction table. */
+static inline void vm_decode(decoded_t * const dc, const m_t instruction, const m_t next) {
+	vm_decode_one(dc, instruction);
+	decoded_t second = { .code = VM_UNDECODED };
+	vm_decode_one(&second, next);
+	if (!vm_fuse[dc->code][second.code])
+		return;
+	if (dc->code == VM_LITERAL && second.code >= VM_ALU && second.code < VM_ALU_EXT) {
+		dc->code  = VM_LIT_ALU + (second.code - VM_ALU);
+		dc->flags = second.flags;
+		dc->dd    = second.dd;
+		dc->rd    = second.rd;
+	} else if (dc->code >= VM_ALU && dc->code < VM_ALU_EXT && second.code < VM_ALU) {
+		static const uint8_t family[] = {
+			[VM_LITERAL] = VM_ALU_LIT,    [VM_BRANCH] = VM_ALU_BRANCH,
+			[VM_ZBRANCH] = VM_ALU_ZBRANCH, [VM_CALL]  = VM_ALU_CALL,
+		};
+		dc->code  = family[second.code] + (dc->code - VM_ALU);
+		dc->arg   = second.arg;
+	} else if (dc->code == VM_LITERAL && second.code == VM_LITERAL) {
+		dc->code  = VM_LIT_LIT;
+		dc->arg2  = second.arg;
+	} else if (dc->code == VM_LITERAL && second.code == VM_CALL) {
+		dc->code  = VM_LIT_CALL;
+		dc->arg2  = second.arg;
+	}
+}
+
+/* Record an executed instruction in a profile, the number of dispatches the
+ * superinstructions in 'vm_fuse' would need to execute the same stream of
+ * instructions is worked out as well. */
+static void vm_profile(embed_profile_t * const p, const m_t pc, const m_t instruction) {
+	decoded_t dc = { .code = VM_UNDECODED };
+	vm_decode_one(&dc, instruction);
+	const unsigned c = dc.code - VM_LITERAL;
+	const int follows = p->instructions && p->pc + 1u == pc;
+	if (follows) {
+		p->bigrams[p->history[0]][c]++;
+		if (p->follows)
+			p->trigrams[p->history[1]][p->history[0]][c]++;
+	}
+	if (follows && p->fusible && vm_fuse[p->history[0] + VM_LITERAL][dc.code]) {
+		p->fusible = 0;
+	} else {
+		p->dispatches++;
+		p->fusible = 1;
+	}
+	p->calls += dc.code == VM_CALL;
+	p->instructions++;
+	p->follows    = follows;
+	p->history[1] = p->history[0];
+	p->history[0] = c;
+	p->pc         = pc;
+}
+
+/* When a decoded instruction cache is in use the fields of an instruction
+ * come from its 'decoded_t' entry 'dc' rather than being extracted from the
+ * raw 'instruction' each time it is executed. */
+#define I_LITERAL (cached ? dc->arg   : (m_t)(instruction & 0x7FFF))
+#define I_SECOND  (dc->arg2)
+#define I_TARGET  (cached ? dc->arg   : (m_t)(instruction & 0x1FFF))
+#define I_FLAGS   (cached ? dc->flags : instruction)
+#define I_DD      (cached ? dc->dd    : delta[ instruction       & 0x3])
+#define I_RD      (cached ? dc->rd    : rdelta[(instruction >> 2) & 0x3])
+
+#define ALU_ENTER do {\
+	n  = MR(sp), T = t;\
+	pc = (I_FLAGS & 0x10) ? (MR(rp) >> 1) : pc; } while (0)
+
+#define ALU_LEAVE do {\
+	sp += I_DD;\
+	rp -= I_RD;\
+	if (I_FLAGS & 0x80)\
+		MW(sp, t);\
+	if (I_FLAGS & 0x40)\
+		MW(rp, t);\
+	t = (I_FLAGS & 0x20) ? n : T; } while (0)
+
+/* The specialized loop has no trace hook, if tracing is turned on by the
+ * 'options' instruction (29) we must continue in the general loop instead. */
+#define ALU_RETRACE(OPERATION) do {\
+	if (fast && (OPERATION) == 29 && (o->options & EMBED_VM_TRACE_ON))\
+		goto retrace; } while (0)
+
+/* The instruction budget of 'embed_run' is decremented as each instruction
+ * is fetched but only checked when control is transferred, on a call,
+ * branch or an ALU instruction with 'r->pc' set. */
+#define ALU_BUDGET() do { if (I_FLAGS & 0x10) { BUDGET(); } } while (0)
+
+#define CRITICAL()     (-!(sp < l && rp < l && pc < l))
+#define MR(ADDR)       (fast ? core[(ADDR)] : mr(h, (ADDR)))
+#define MW(ADDR, VAL)  do { const m_t a_ = (ADDR), v_ = (VAL);\
+	if (fast) { core[a_] = v_; } else { mw(h, a_, v_); }\
+	if (cached || (jitted && cache)) { vm_invalidate(cache, a_); }\
+	if (jitted) { embed_jit_invalidate(jit, a_); } } while (0)
+/* Byte addresses wrap around a core of 'l' cells, the specialized loops do
+ * the shift and mask the default byte callbacks would do inline, a write
+ * invalidates the decoded instruction and compiled code for the whole cell. */
+#define MRB(ADDR)      (fast ? (m_t)((core[(ADDR) >> 1] >> (((ADDR) & 1) << 3)) & 0xFF) : mrb(h, (m_t)((ADDR) % (2u * l))))
+#define MWB(ADDR, VAL) do { const m_t b_ = (m_t)((ADDR) % (2u * l)), a_ = b_ >> 1, s_ = (b_ & 1) << 3;\
+	if (fast) { core[a_] = (core[a_] & ~(0xFFu << s_)) | ((m_t)((VAL) & 0xFF) << s_); } else { mwb(h, b_, (VAL)); }\
+	if (cached || (jitted && cache)) { vm_invalidate(cache, a_); }\
+	if (jitted) { embed_jit_invalidate(jit, a_); } } while (0)
+#define YIELD()        (!fast && yield(yields))
+#define TRACE()        do { if (!fast) { trace(h, pc, instruction, t, rp, sp); } } while (0)
+#define FETCH()        do { left--; if (cached) { dc = &cache[pc++]; } else { instruction = MR(pc++); } } while (0)
+#define PROFILE()      do { if (!fast && profile) { vm_profile(profile, pc - 1, instruction); } } while (0)
+#define BUDGET()       do { if (left <= 0) { goto exhausted; } } while (0)
+/* A call to an address with a native override ('embed_native_add') runs it
+ * instead if its guard holds, 'native' is set if it did */
+#define NATIVE(TARGET) do { native = 0; if (natives && natives->slot[(TARGET)]) { m_t regs_[4] = { pc, t, rp, sp };\
+	if ((native = vm_native(h, fast, 2u * l, natives, (TARGET), regs_)))\
+		pc = regs_[0], t = regs_[1], rp = regs_[2], sp = regs_[3]; } } while (0)
+#define JIT()          do { if (jitted) { m_t regs_[4] = { pc, t, rp, sp };\
+	embed_jit_run(jit, core, regs_);\
+	pc = regs_[0], t = regs_[1], rp = regs_[2], sp = regs_[3]; } } while (0)
+
+#if USE_COMPUTED_GOTO
+#define LABEL(L)    __extension__ &&L
+#define LABELS(L)   LABEL(L), LABEL(L), LABEL(L), LABEL(L), LABEL(L), LABEL(L), LABEL(L), LABEL(L)
+#define LABELS32(L) LABELS(L), LABELS(L), LABELS(L), LABELS(L)
+#define NEXT do {\
+	if (YIELD())\
+		goto finished;\
+	FETCH();\
+	TRACE();\
+	if ((r = CRITICAL())) /* critical error */\
+		goto finished;\
+	PROFILE();\
+	if (cached)\
+		__extension__ ({ goto *decoded[dc->code]; });\
+	__extension__ ({ goto *dispatch[instruction >> 8]; }); } while (0)
+/* Between the two halves of a superinstruction we check that execution has
+ * not left the sequence and that the instructions have not been overwritten,
+ * before doing what fetching the second instruction would have done. */
+#define SUPER_SECOND do {\
+	if (pc != (m_t)(dc - cache) + 1u || dc->code == VM_UNDECODED)\
+		NEXT;\
+	pc++;\
+	left--;\
+	if ((r = CRITICAL())) /* critical error */\
+		goto finished; } while (0)
+#define ALU_LABEL(N, CODE)   LABEL(alu_##N),
+#define ALU_HANDLER(N, CODE) alu_##N: ALU_EXTEND(N); ALU_ENTER; { CODE } ALU_LEAVE; ALU_RETRACE(N); ALU_BUDGET(); NEXT;
+#define ALU_EXT_HANDLER(N, CODE) alu_##N: ALU_ENTER; { CODE } ALU_LEAVE; ALU_BUDGET(); NEXT;
+/* 'dispatch' cannot tell the extended operations apart from the first 32,
+ * the decoded instruction cache can. */
+#define ALU_EXTEND(N) do {\
+	if (!cached && (instruction & 0xC) == 0x8)\
+		__extension__ ({ goto *extended[N]; }); } while (0)
+#define LIT_ALU_LABEL(N, CODE)   LABEL(lit_alu_##N),
+#define LIT_ALU_HANDLER(N, CODE) lit_alu_##N:\
+	MW(++sp, t); t = I_LITERAL; SUPER_SECOND;\
+	ALU_ENTER; { CODE } ALU_LEAVE; ALU_RETRACE(N); ALU_BUDGET(); NEXT;
+#define ALU_ZBRANCH_LABEL(N, CODE)   LABEL(alu_zbranch_##N),
+#define ALU_ZBRANCH_HANDLER(N, CODE) alu_zbranch_##N:\
+	ALU_ENTER; { CODE } ALU_LEAVE; ALU_RETRACE(N); SUPER_SECOND;\
+	pc = !t ? I_TARGET : pc; t = MR(sp--); BUDGET(); NEXT;
+#define ALU_BRANCH_LABEL(N, CODE)   LABEL(alu_branch_##N),
+#define ALU_BRANCH_HANDLER(N, CODE) alu_branch_##N:\
+	ALU_ENTER; { CODE } ALU_LEAVE; ALU_RETRACE(N); SUPER_SECOND;\
+	pc = I_TARGET; BUDGET(); NEXT;
+#define ALU_CALL_LABEL(N, CODE)   LABEL(alu_call_##N),
+#define ALU_CALL_HANDLER(N, CODE) alu_call_##N:\
+	ALU_ENTER; { CODE } ALU_LEAVE; ALU_RETRACE(N); SUPER_SECOND;\
+	NATIVE(I_TARGET); if (!native) { MW(--rp, pc << 1); pc = I_TARGET; } BUDGET(); NEXT;
+#define ALU_LIT_LABEL(N, CODE)   LABEL(alu_lit_##N),
+#define ALU_LIT_HANDLER(N, CODE) alu_lit_##N:\
+	ALU_ENTER; { CODE } ALU_LEAVE; ALU_RETRACE(N); ALU_BUDGET(); SUPER_SECOND;\
+	MW(++sp, t); t = I_LITERAL; NEXT;
+#define VM_LOOP\
+	static const void * const dispatch[] = { /* indexed by top byte of instruction */\
+		LABELS32(branch), LABELS32(zbranch), LABELS32(call),\
+		EMBED_ALU(ALU_LABEL)\
+		LABELS32(literal), LABELS32(literal), LABELS32(literal), LABELS32(literal),\
+	};\
+	static const void * const extended[] = { /* indexed by operation, less 32 */\
+		EMBED_ALU_EXT(ALU_LABEL)\
+	};\
+	static const void * const decoded[] = { /* indexed by 'decoded_t' code */\
+		LABEL(decode), LABEL(literal), LABEL(branch), LABEL(zbranch), LABEL(call),\
+		EMBED_ALU(ALU_LABEL)\
+		EMBED_ALU_EXT(ALU_LABEL)\
+		EMBED_ALU(LIT_ALU_LABEL)\
+		EMBED_ALU(ALU_ZBRANCH_LABEL)\
+		EMBED_ALU(ALU_BRANCH_LABEL)\
+		EMBED_ALU(ALU_CALL_LABEL)\
+		EMBED_ALU(ALU_LIT_LABEL)\
+		LABEL(lit_lit), LABEL(lit_call),\
+	};\
+	BUILD_BUG_ON(sizeof(dispatch)/sizeof(dispatch[0]) != 256);\
+	BUILD_BUG_ON(sizeof(extended)/sizeof(extended[0]) != 32);\
+	BUILD_BUG_ON(sizeof(decoded)/sizeof(decoded[0]) != VM_CODES);\
+	m_t instruction = 0, n = 0, T = 0;\
+	d_t d = 0;\
+	NEXT;\
+decode:\
+	vm_decode(dc, core[pc - 1], core[pc]);\
+	__extension__ ({ goto *decoded[dc->code]; });\
+literal:\
+	MW(++sp, t);\
+	t = I_LITERAL;\
+	NEXT;\
+	EMBED_ALU(ALU_HANDLER)\
+	EMBED_ALU_EXT(ALU_EXT_HANDLER)\
+	EMBED_ALU(LIT_ALU_HANDLER)\
+	EMBED_ALU(ALU_ZBRANCH_HANDLER)\
+	EMBED_ALU(ALU_BRANCH_HANDLER)\
+	EMBED_ALU(ALU_CALL_HANDLER)\
+	EMBED_ALU(ALU_LIT_HANDLER)\
+lit_lit:\
+	MW(++sp, t); t = I_LITERAL; SUPER_SECOND;\
+	MW(++sp, t); t = I_SECOND;\
+	NEXT;\
+lit_call:\
+	MW(++sp, t); t = I_LITERAL; SUPER_SECOND;\
+	NATIVE(I_SECOND); if (!native) { MW(--rp, pc << 1); pc = I_SECOND; }\
+	BUDGET();\
+	NEXT;\
+call:\
+	NATIVE(I_TARGET);\
+	if (!native) {\
+		MW(--rp, pc << 1);\
+		pc = I_TARGET;\
+		JIT();\
+	}\
+	BUDGET();\
+	NEXT;\
+zbranch:\
+	pc = !t ? I_TARGET : pc;\
+	t = MR(sp--);\
+	BUDGET();\
+	NEXT;\
+branch:\
+	pc = I_TARGET;\
+	BUDGET();\
+	NEXT;
+#else
+#define VM_LOOP\
+	for (d_t d; !YIELD(); ) {\
+		m_t instruction = 0;\
+		FETCH();\
+		TRACE();\
+		if ((r = CRITICAL())) /* critical error */\
+			goto finished;\
+		PROFILE();\
+		if (cached && dc->code == VM_UNDECODED)\
+			vm_decode(dc, core[pc - 1], core[pc]);\
+		if (cached ? dc->code == VM_LITERAL : (0x8000 & instruction)) {\
+			MW(++sp, t);\
+			t       = I_LITERAL;\
+		} else if (cached ? dc->code >= VM_ALU : (0xE000 & instruction) == 0x6000) {\
+			const m_t operation = cached ? dc->code - VM_ALU : vm_operation(instruction);\
+			m_t n, T;\
+			ALU_ENTER;\
+			switch (operation) {\
+			EMBED_ALU(ALU_CASE)\
+			EMBED_ALU_EXT(ALU_CASE)\
+			}\
+			ALU_LEAVE;\
+			ALU_RETRACE(operation);\
+			ALU_BUDGET();\
+		} else if (cached ? dc->code == VM_CALL : (0x4000 & instruction)) {\
+			NATIVE(I_TARGET);\
+			if (!native) {\
+				MW(--rp, pc << 1);\
+				pc      = I_TARGET;\
+				JIT();\
+			}\
+			BUDGET();\
+		} else if (cached ? dc->code == VM_ZBRANCH : (0x2000 & instruction)) {\
+			pc = !t ? I_TARGET : pc;\
+			t = MR(sp--);\
+			BUDGET();\
+		} else { /* branch */\
+			pc = I_TARGET;\
+			BUDGET();\
+		}\
+	}
+#define ALU_CASE(N, CODE) case N: { CODE } break;
+#endif
+
+/* 'VM' is expanded into three functions; the general loop, which goes through
+ * the MMU and yield callbacks in the options structure, and two with 'fast'
+ * set, for the default configuration (the default MMU and yield callbacks on
+ * an EMBED_CORE_SIZE core with tracing off), one of which also uses the
+ * decoded instruction cache. The compiler can then index the core directly,
+ * turn the '%' for '@' and '!' into a mask and drop the yield and trace calls
+ * from the specialized loops. A macro is used instead of an inline function
+ * as GCC will not duplicate functions containing label addresses. The cache
+ * is only used with the default MMU as any write to the core could replace
+ * an instruction, and we can only see those that go through it. The same goes
+ * for the JIT compiler, which is handed control at each call. */
+#define VM(FAST, CACHED, JITTED) {\
+	int64_t left = *budget;\
+	const int fast = (FAST), cached = (CACHED), jitted = (JITTED);\
+	assert(h);\
+	BUILD_BUG_ON (sizeof(m_t)    != sizeof(s_t));\
+	BUILD_BUG_ON((sizeof(m_t)*2) != sizeof(d_t));\
+	embed_opt_t *o = &(h->o);\
+	static const m_t delta[] = { 0, 1, -2, -1 }, rdelta[] = { 0, 1, 0, -1 }; /* two bit signed values */\
+	const embed_mmu_read_t  mr    = o->read;\
+	const embed_mmu_write_t mw    = o->write;\
+	const embed_mmu_read_byte_t  mrb = o->read_byte  ? o->read_byte  : embed_mmu_read_byte_cb;\
+	const embed_mmu_write_byte_t mwb = o->write_byte ? o->write_byte : embed_mmu_write_byte_cb;\
+	const embed_yield_t     yield = o->yield;\
+	void  *yields = o->yields;\
+	m_t * const core = h->m;\
+	decoded_t * const cache = h->cache, *dc = cache;\
+	embed_profile_t * const profile = h->profile;\
+	embed_jit_t * const jit = h->jit;\
+	embed_natives_t * const natives = h->natives;\
+	assert(mr && mw && yield);\
+	assert(!cached || cache);\
+	assert(!jitted || (jit && fast));\
+	(void)mr; (void)mw; (void)mrb; (void)mwb; (void)yield; (void)yields; (void)core; (void)dc; (void)profile; (void)jit;\
+	const m_t l = fast ? EMBED_CORE_SIZE : embed_cells(h);\
+	m_t pc = MR(0), t = MR(1), rp = MR(2), sp = MR(3), r = 0;\
+	int native = 0;\
+	(void)native;\
+	VM_LOOP \
+finished: MW(0, pc); MW(1, t); MW(2, rp); MW(3, sp);\
+	*budget = left;\
+	return (s_t)r;\
+exhausted: MW(0, pc); MW(1, t); MW(2, rp); MW(3, sp);\
+	*budget = left;\
+	return EMBED_RUN_BUDGET;\
+retrace:  MW(0, pc); MW(1, t); MW(2, rp); MW(3, sp);\
+	*budget = left;\
+	return vm_general(h, budget);\
+}
+
+static int vm_general(embed_t * const h, int64_t * const budget);
+static int vm_general(embed_t * const h, int64_t * const budget) VM(0, 0, 0)
+static int vm_fast(embed_t * const h, int64_t * const budget)    VM(1, 0, 0)
+static int vm_cached(embed_t * const h, int64_t * const budget)  VM(1, 1, 0)
+static int vm_jit(embed_t * const h, int64_t * const budget)     VM(1, 0, 1)
+
+static inline int vm_is_default(embed_t * const h) {
+	const embed_opt_t * const o = &h->o;
+	if (h->profile)
+		return 0;
+	if (o->read != embed_mmu_read_cb || o->write != embed_mmu_write_cb || o->yield != embed_yield_cb)
+		return 0;
+	if ((o->read_byte && o->read_byte != embed_mmu_read_byte_cb) || (o->write_byte && o->write_byte != embed_mmu_write_byte_cb))
+		return 0;
+#ifndef NDEBUG
+	if (o->options & EMBED_VM_TRACE_ON)
+		return 0;
+#endif
+	return embed_cells(h) == EMBED_CORE_SIZE;
+}
+
+cell_t embed_crc(embed_t * const h, const cell_t start, const cell_t length) {
+	assert(h);
+	return vm_crc(h, vm_is_default(h), 2u * embed_cells(h), start, length);
+}
+
+typedef int (*vm_t)(embed_t * const h, int64_t * const budget);
+
+static vm_t vm_select(embed_t * const h, const int jit) {
+	if (!vm_is_default(h))
+		return vm_general;
+	if (jit && h->jit)
+		return vm_jit;
+	return h->cache ? vm_cached : vm_fast;
+}
+
 int embed_vm(embed_t * const h) {
 	assert(h);
-	BUILD_BUG_ON (sizeof(m_t)    != sizeof(s_t));
-	BUILD_BUG_ON((sizeof(m_t)*2) != sizeof(d_t));
-	embed_opt_t *o = &(h->o);
-	static const m_t delta[] = { 0, 1, -2, -1 }; /* two bit signed value */
-	const embed_mmu_read_t  mr    = o->read;
-	const embed_mmu_write_t mw    = o->write;
-	const embed_yield_t     yield = o->yield;
-	void  *yields = o->yields;
-	assert(mr && mw && yield);
-	const m_t l = embed_cells(h);
-	m_t pc = mr(h, 0), t = mr(h, 1), rp = mr(h, 2), sp = mr(h, 3), r = 0;
-	for (d_t d; !yield(yields); ) {
-		const m_t instruction = mr(h, pc++);
-		trace(h, pc, instruction, t, rp, sp);
-		if ((r = -!(sp < l && rp < l && pc < l))) /* critical error */
-			goto finished;
-		if (0x8000 & instruction) { /* literal */
-			mw(h, ++sp, t);
-			t       = instruction & 0x7FFF;
-		} else if ((0xE000 & instruction) == 0x6000) { /* ALU */
-			m_t n = mr(h, sp), T = t;
-			pc = (instruction & 0x10) ? (mr(h, rp) >> 1) : pc;
-			switch((instruction >> 8u) & 0x1f) {
-			case  0:  T = t;                  break;
-			case  1:  T = n;                  break;
-			case  2:  T = mr(h, rp);          break;
-			case  3:  T = mr(h, (t>>1)%l);    break;
-			case  4:  mw(h, (t>>1)%l, n); T = mr(h, --sp); break;
-			case  5:  d = (d_t)t + n; T = d >> 16; mw(h, sp, d); n = d; break;
-			case  6:  d = (d_t)t * n; T = d >> 16; mw(h, sp, d); n = d; break;
-			case  7:  T = t&n;                break;
-			case  8:  T = t|n;                break;
-			case  9:  T = t^n;                break;
-			case 10:  T = ~t;                 break;
-			case 11:  T = t-1;                break;
-			case 12:  T = -(t == 0);          break;
-			case 13:  T = -(t == n);          break;
-			case 14:  T = -(n < t);           break;
-			case 15:  T = -((s_t)n < (s_t)t); break;
-			case 16:  T = n >> t;             break;
-			case 17:  T = n << t;             break;
-			case 18:  T = sp << 1;            break;
-			case 19:  T = rp << 1;            break;
-			case 20: sp = t >> 1;             break;
-			case 21: rp = t >> 1; T = n;      break;
-			case 22: if (o->save) { T = o->save(h, o->name, n >> 1, ((d_t)t + 1) >> 1); } else { pc = 4; T = 21; } break;
-			case 23: if (o->put) { T = o->put(t, o->out); } else { pc = 4; T = 21; } break;
-			case 24: if (o->get) { int nd = 0; mw(h, ++sp, t); T = o->get(o->in, &nd); t = T; n = nd; } else { pc = 4; T = 21; } break;
-			case 25: if (t) { d = mr(h, --sp) | ((d_t)n << 16); T= d / t; t = d % t; n = t; } else { pc = 4; T=10; } break;
-			case 26: if (t) { T=(s_t)n / t; t=(s_t)n % t; n = t; } else { pc = 4; T = 10; } break;
-			case 27: if (mr(h, rp)) { mw(h, rp, 0); sp--; r = t; t = n; goto finished; }; T = t; break;
-			case 28: if (o->callback) {
-					 mw(h, 0, pc), mw(h, 1, t), mw(h, 2, rp), mw(h, 3, sp);
-					 r = o->callback(h, o->param);
-					 pc = mr(h, 0), T = mr(h, 1), rp = mr(h, 2), sp = mr(h, 3);
-					 if (r) { pc = 4; T = r; }
-				 } else { pc = 4; T = 21; }  break;
-			case 29: T = o->options; o->options = t; break;
-			default: pc = 4; T = 21; /* not implemented */ break;
-			}
-			sp += delta[ instruction       & 0x3];
-			rp -= delta[(instruction >> 2) & 0x3];
-			if (instruction & 0x80)
-				mw(h, sp, t);
-			if (instruction & 0x40)
-				mw(h, rp, t);
-			t = (instruction & 0x20) ? n : T;
-		} else if (0x4000 & instruction) { /* call */
-			mw(h, --rp, pc << 1);
-			pc      = instruction & 0x1FFF;
-		} else if (0x2000 & instruction) { /* 0branch */
-			pc = !t ? instruction & 0x1FFF : pc;
-			t  = mr(h, sp--);
-		} else { /* branch */
-			pc = instruction & 0x1FFF;
-		}
-	}
-finished: mw(h, 0, pc), mw(h, 1, t), mw(h, 2, rp), mw(h, 3, sp);
-	return (s_t)r;
+	int64_t budget = INT64_MAX;
+	return vm_select(h, 1)(h, &budget);
 }
 
+/* Compiled code does not count instructions, so the JIT is not used here */
+int embed_run(embed_t * const h, const uint64_t budget, uint64_t * const executed) {
+	assert(h);
+	int64_t left = MIN(budget, (uint64_t)INT64_MAX);
+	const int64_t start = left;
+	const int r = vm_select(h, 0)(h, &left);
+	if (executed)
+		*executed = start - left;
+	return r;
+}
@@ -84,6 +84,20 @@ typedef cell_t (*embed_mmu_read_t)(embed_t const * const h, cell_t addr);
  * @param value, value to write to 'addr' */
 typedef void (*embed_mmu_write_t)(embed_t * const h, cell_t addr, cell_t value);
 
+/**@brief Function pointer typedef for user supplied callbacks for
+ * reading a byte from the Virtual Machines memory, used by 'c@'
+ * @param  h,    initialized Virtual Machine image
+ * @param  addr, byte address of location to read from
+ * @return byte read */
+typedef uint8_t (*embed_mmu_read_byte_t)(embed_t const * const h, cell_t addr);
+
+/**@brief Function pointer typedef for user supplied callbacks for
+ * writing a byte to the Virtual Machines memory, used by 'c!'
+ * @param h,     initialized Virtual Machine image
+ * @param addr,  byte address of value to write
+ * @param value, byte to write to 'addr' */
+typedef void (*embed_mmu_write_byte_t)(embed_t * const h, cell_t addr, uint8_t value);
+
 /**@brief This function is called by the virtual machine to determine whether
  * the virtual machine should yield or not, it can be used to limit time spent
  * in the virtual machine.
@@ -104,6 +118,8 @@ typedef struct {
 	embed_save_t      save;     /**< callback to save an image */
 	embed_mmu_write_t write;    /**< callback to write location to virtual machine memory */
 	embed_mmu_read_t  read;     /**< callback to read location from virtual machine memory */
+	embed_mmu_write_byte_t write_byte; /**< callback to write a byte, NULL is 'embed_mmu_write_byte_cb' */
+	embed_mmu_read_byte_t  read_byte;  /**< callback to read a byte, NULL is 'embed_mmu_read_byte_cb' */
 	embed_callback_t  callback; /**< arbitrary user supplied callback */
 	embed_yield_t     yield;    /**< callback to force the virtual machine to yield */
 	void	*in,                /**< first argument to 'getc' */
@@ -114,9 +130,147 @@ typedef struct {
 	embed_vm_option_e options;  /**< virtual machine options register */
 } embed_opt_t; /**< Embed VM options structure for customizing behavior */
 
+#define EMBED_PROFILE_CLASSES (68) /**< literal, branch, 0branch, call and 64 ALU operations */
+
+/**@brief An instruction profile, which 'embed_vm' will fill in if a zeroed
+ * one is assigned to the 'profile' field of 'embed_t'. Instructions are
+ * grouped into classes; 0 is a literal, 1 a branch, 2 a conditional branch,
+ * 3 a call and 4 to 67 are the ALU operations. Only sequences of instructions
+ * at consecutive addresses are counted, as only they can be fused into a
+ * superinstruction (see 'super.h'). Profiling slows the virtual machine down
+ * as the specialized interpreter loops cannot be used. */
+typedef struct {
+	uint64_t instructions; /**< number of instructions executed */
+	uint64_t calls;        /**< number of calls executed, roughly the number of Forth words executed */
+	uint64_t dispatches;   /**< number of dispatches with the compiled in superinstructions */
+	uint64_t bigrams[EMBED_PROFILE_CLASSES][EMBED_PROFILE_CLASSES]; /**< pairs of instruction classes */
+	uint64_t trigrams[EMBED_PROFILE_CLASSES][EMBED_PROFILE_CLASSES][EMBED_PROFILE_CLASSES]; /**< triples of instruction classes */
+	/* internal state */
+	cell_t pc;             /**< address of last instruction */
+	uint8_t history[2];    /**< classes of last two instructions */
+	uint8_t follows;       /**< last two instructions were at consecutive addresses */
+	uint8_t fusible;       /**< last instruction could start a superinstruction */
+} embed_profile_t;
+
+typedef struct embed_jit_t embed_jit_t; /**< x86-64 JIT compiler state, see 'embed_jit_new' */
+
+/**@brief Statistics gathered by the JIT compiler */
+typedef struct {
+	uint64_t blocks;       /**< number of blocks compiled */
+	uint64_t instructions; /**< number of instructions compiled */
+	uint64_t entries;      /**< number of times a compiled block was run */
+	uint64_t flushes;      /**< number of times all compiled code was thrown away */
+	double   seconds;      /**< time spent in compiled code */
+} embed_jit_stats_t;
+
+#define EMBED_FPU_DEPTH (32) /**< depth of the floating point stack, see 'embed_fpu_t' */
+
+/**@brief Floating point unit state, used by the floating point instructions
+ * (see 'float.fth') if the 'fpu' field of 'embed_t' points to one, they trap
+ * if it is NULL. Floats are IEEE 754 single precision, which is two cells
+ * in the core. The unit can be reset by zeroing it. */
+typedef struct {
+	float stack[EMBED_FPU_DEPTH]; /**< floating point stack, 'depth' floats are on it */
+	size_t depth;                 /**< number of floats on the stack */
+} embed_fpu_t;
+
+#define EMBED_NATIVES     (16)      /**< maximum number of overrides in an 'embed_natives_t' */
+#define EMBED_NATIVE_PASS (0x10001) /**< 'embed_native_t' result that runs the Forth word instead */
+
+/**@brief A host implementation of a Forth word, run on the virtual machine
+ * stacks, which can be accessed with 'embed_push' and 'embed_pop', in place
+ * of a call to the word. The registers are saved in the core beforehand, as
+ * they are for 'embed_callback_t'.
+ * @param h,     virtual machine the word is called in
+ * @param param, 'param' given to 'embed_native_add'
+ * @return zero on success, EMBED_NATIVE_PASS to run the Forth word instead
+ * (without having touched the stacks), any other value is thrown, negated,
+ * as an instruction that traps does */
+typedef int (*embed_native_t)(embed_t *h, void *param);
+
+/**@brief An override of a Forth word by an 'embed_native_t' function, the
+ * word is identified by the cell address of its code and guarded by the CRC
+ * of its body, the override is only used while the body is unchanged */
+typedef struct {
+	embed_native_t fn;      /**< host implementation of the word */
+	void *param;            /**< second argument to 'fn' */
+	cell_t addr, length;    /**< address of the word and length of its body, in cells */
+	cell_t crc;             /**< CRC of the body when the override was added */
+	uint64_t calls;         /**< number of calls to the word run by 'fn' */
+	uint64_t passes;        /**< number of calls run in Forth, as the guard failed or 'fn' passed */
+} embed_override_t;
+
+/**@brief A table of native overrides of Forth words, used by 'embed_vm' if
+ * the 'natives' field of 'embed_t' points to one, see 'embed_native_add'
+ * and 'embed_native_default'. It should be zeroed before use. */
+typedef struct {
+	embed_override_t entry[EMBED_NATIVES]; /**< overrides, 'count' of them are in use */
+	size_t count;                          /**< number of overrides */
+	uint8_t slot[EMBED_CORE_SIZE];         /**< one more than the index of the override of an address, or zero */
+} embed_natives_t;
+
+#define EMBED_SNIPPETS       (32)   /**< maximum number of snippets 'embed_eval_cached' keeps compiled */
+#define EMBED_SNIPPET_LENGTH (128)  /**< snippets this long or longer are not cached */
+#define EMBED_SNIPPET_AREA   (1024) /**< bytes of the dictionary reserved for compiled snippets */
+
+typedef struct {
+	uint32_t hash;                    /**< hash of 'text' */
+	cell_t xt;                        /**< execution token of the compiled snippet */
+	char text[EMBED_SNIPPET_LENGTH];  /**< the snippet */
+} embed_snippet_t;
+
+/**@brief A cache of compiled snippets for 'embed_eval_cached', it should be
+ * zeroed before use and only used with one virtual machine. */
+typedef struct {
+	embed_snippet_t entry[EMBED_SNIPPETS]; /**< snippets, 'count' of them are in use */
+	size_t count;                          /**< number of snippets */
+	cell_t area;                           /**< byte address of the reserved area in the dictionary, or zero */
+	cell_t used;                           /**< bytes of the area in use */
+	uint32_t generation;                   /**< hash of the search order, 'base' and 'state' the snippets were compiled against */
+	cell_t variables[2];                   /**< cell addresses of 'base' and 'state', found when first used */
+	uint64_t hits, misses, flushes;        /**< statistics */
+} embed_snippets_t;
+
+#define EMBED_EXTENSIONS      (32) /**< maximum number of functions in an 'embed_extensions_t' */
+#define EMBED_EXTENSION_CELLS (8)  /**< maximum number of cells an 'embed_extension_t' takes or returns */
+
+/**@brief A host function registered with 'embed_register', it is given the
+ * cells it takes off the variable stack, deepest first, in 'cells' and
+ * replaces them with those it returns. The registers are not saved in the
+ * core for it, as they are for 'embed_callback_t', so it must not use the
+ * stacks with 'embed_push' and the like, or change the code being run.
+ * @param h,     virtual machine the function is called from
+ * @param param, 'param' given to 'embed_register'
+ * @param cells, EMBED_EXTENSION_CELLS cells, holding the arguments on entry
+ * and the results on exit
+ * @return zero on success, any other value is thrown, negated, as an
+ * instruction that traps does */
+typedef int (*embed_extension_t)(embed_t *h, void *param, cell_t *cells);
+
+typedef struct {
+	embed_extension_t fn; /**< host function */
+	void *param;          /**< second argument to 'fn' */
+	cell_t in, out;       /**< cells taken off the stack and cells put back */
+	uint64_t calls;       /**< number of calls made to 'fn' */
+} embed_extension_entry_t;
+
+/**@brief A table of host functions called by the indexed extension
+ * instruction, used by 'embed_vm' if the 'extensions' field of 'embed_t'
+ * points to one, see 'embed_register'. It should be zeroed before use. */
+typedef struct {
+	embed_extension_entry_t entry[EMBED_EXTENSIONS]; /**< functions, 'count' of them are in use */
+	size_t count;                                    /**< number of functions */
+} embed_extensions_t;
+
 struct embed_t { /**@todo merge with embed_opt_t */
 	embed_opt_t o; /**< options structure for virtual machine */
 	void *m;       /**< virtual machine core memory - @warning you need to set this to something sensible! */
+	void *cache;   /**< optional decoded instruction cache of 'embed_cache_size()' bytes, or NULL */
+	embed_profile_t *profile; /**< optional instruction profile to fill in, or NULL */
+	embed_jit_t *jit;         /**< optional JIT compiler from 'embed_jit_new', or NULL */
+	embed_fpu_t *fpu;         /**< optional floating point unit, or NULL */
+	embed_natives_t *natives; /**< optional native overrides of Forth words, or NULL */
+	embed_extensions_t *extensions; /**< optional host functions for 'embed_register', or NULL */
 }; /**< Embed Forth VM structure */
 
 /**@brief alternative 'embed_fgetc_t' to read data from a string
@@ -158,7 +312,27 @@ cell_t  embed_mmu_read_cb(embed_t const * const h, cell_t addr);
  * @param value, value to write */
 void embed_mmu_write_cb(embed_t * const h, cell_t addr, cell_t value);
 
-/**@brief Load VM image off disk
+/**@brief Default callback for reading a byte from virtual machine memory,
+ * it reads the cell containing it with the 'read' callback, bytes are
+ * stored little endian within a cell, the even address being the lower
+ * byte. The specialized loops in 'embed_vm' index the core directly when
+ * this and the other default MMU callbacks are in use.
+ * @param h,     initialized Virtual Machine image
+ * @param addr, byte address to read
+ * @return read in byte */
+uint8_t embed_mmu_read_byte_cb(embed_t const * const h, cell_t addr);
+
+/**@brief Default callback for writing a byte to virtual machine memory, a
+ * read-modify-write of the cell containing it with the 'read' and 'write'
+ * callbacks.
+ * @param h,     initialized Virtual Machine image
+ * @param addr,  byte address to write to
+ * @param value, byte to write */
+void embed_mmu_write_byte_cb(embed_t * const h, cell_t addr, uint8_t value);
+
+/**@brief Load VM image off disk, if the image header has its check enabled,
+ * as it is in a freshly meta-compiled image, the length and CRC in it are
+ * validated like the Forth word 'bist' does when the image boots.
  * @param h,     uninitialized Virtual Machine image
  * @param name,  name of file to load off disk
  * @return zero on success, negative on failure */
@@ -202,6 +376,33 @@ void embed_buffer_swap(cell_t *b, size_t l);
  * @return zero on success, negative on failure */
 int embed_vm(embed_t *h);
 
+/**@brief Calculate the CRC-16/CCITT (polynomial $1021, initial value $FFFF)
+ * of a range of virtual machine memory, as the Forth word 'crc' does. This
+ * is the checksum stored in the image header, which is calculated with the
+ * CRC field itself set to zero.
+ * @param h,      initialized virtual machine
+ * @param start,  byte address to start at
+ * @param length, number of bytes to check
+ * @return CRC of the bytes */
+cell_t embed_crc(embed_t *h, cell_t start, cell_t length);
+
+#define EMBED_RUN_BUDGET (0x10000) /**< 'embed_run' status for an exhausted budget, outside the range of 'embed_vm' results */
+
+/**@brief Run the virtual machine, as 'embed_vm' does, but only for about
+ * 'budget' instructions. The budget is only checked when control is
+ * transferred (on a call, a branch or an exit) so a few more instructions
+ * than were budgeted for may be executed, the number reported is exact. The
+ * virtual machine can be resumed where it stopped by calling 'embed_run' or
+ * 'embed_vm' again, the registers are saved to the core when it stops. The
+ * eForth image checks its CRC, which covers the registers, the first time it
+ * boots, so that should not be interrupted. Instructions are counted, so
+ * code compiled by a JIT ('embed_jit_new') is not used.
+ * @param h,        initialized virtual machine
+ * @param budget,   number of instructions to run for
+ * @param executed, if not NULL, set to the number of instructions executed
+ * @return EMBED_RUN_BUDGET if the budget ran out, or what 'embed_vm' returns */
+int embed_run(embed_t *h, uint64_t budget, uint64_t *executed);
+
 /**@brief Push value onto the Virtual Machines stack. This can be called from
  * within the 'embed_callback_t' callback and from outside of it.
  * @param h,     initialized Virtual Machine image
@@ -222,6 +423,99 @@ int embed_pop(embed_t *h, cell_t *value);
  * @return The current stack depth in cells */
 size_t embed_depth(embed_t *h);
 
+/**@brief Push an array of values onto the variable stack, 'values[0]'
+ * first, with a single bounds check for all of them.
+ * @param h,      initialized Virtual Machine
+ * @param values, values to push
+ * @param n,      number of values
+ * @return zero on success, negative on failure, when nothing is pushed */
+int embed_push_n(embed_t *h, const cell_t *values, size_t n);
+
+/**@brief Pop 'n' values off the variable stack into an array, the top of
+ * the stack into 'values[n - 1]', so it undoes 'embed_push_n'.
+ * @param h,      initialized Virtual Machine
+ * @param values, array of 'n' values to pop into
+ * @param n,      number of values
+ * @return zero on success, negative on failure, when nothing is popped */
+int embed_pop_n(embed_t *h, cell_t *values, size_t n);
+
+typedef struct {
+	cell_t *cells;   /**< the stack, deepest first, the top of stack is 'cells[depth - 1]' */
+	size_t depth;    /**< number of cells on the stack */
+	size_t capacity; /**< number of cells the stack can grow to */
+} embed_stack_view_t; /**< the variable stack, in place in the core */
+
+/**@brief Get a view of the variable stack in the core, which can be read
+ * and changed in place, for a callback to work on its arguments for
+ * example. The top of the stack is kept in a register, it is written to the
+ * core so that the whole stack is contiguous. Nothing else may change the
+ * stack until the view is finished with 'embed_stack_commit'. This is only
+ * possible with the default MMU callbacks, and the stack should not be
+ * treated as code while the view is open.
+ * @param h, initialized Virtual Machine
+ * @param v, set to the view
+ * @return zero on success, negative if the MMU callbacks are not the
+ * default ones or the stack pointers are out of bounds */
+int embed_stack_view(embed_t *h, embed_stack_view_t *v);
+
+/**@brief Finish with a view from 'embed_stack_view', setting the stack
+ * depth to that of the view, which may have been changed to anything up to
+ * its capacity, and the top of the stack from it.
+ * @param h, initialized Virtual Machine
+ * @param v, view from 'embed_stack_view'
+ * @return zero on success, negative if the depth is beyond the capacity */
+int embed_stack_commit(embed_t *h, const embed_stack_view_t *v);
+
+/**@brief Copy a string into the transient area at 'pad' in the eForth
+ * image and push its address and length, '( -- c-addr u )', for a callback
+ * to return a string. Like the buffer 's"' uses in other Forths, the string
+ * is only good until the next one is pushed. The copy is a single 'memcpy'
+ * with the default MMU callbacks, otherwise it goes through the byte
+ * callbacks. 'pad' is looked up by name, as 'embed_find' does, so this only
+ * works with the eForth image once it has run, and the string has to fit
+ * between it and the start of the variable stack, 1792 bytes in that image,
+ * of which those past the first 512 are also used for the names of local
+ * variables while a word is compiled.
+ * @param h,   initialized Virtual Machine
+ * @param buf, string to copy, it need not be NUL terminated
+ * @param u,   length of 'buf'
+ * @return zero on success, negative on failure or if it does not fit */
+int embed_push_string(embed_t *h, const void *buf, size_t u);
+
+/**@brief Pop a string, '( c-addr u -- )', and copy as much of it as will
+ * fit into 'buf' with a NUL terminator, like 'snprintf' the string was cut
+ * short if '*u' is not less than 'size'.
+ * @param h,    initialized Virtual Machine
+ * @param buf,  buffer to copy the string to
+ * @param size, size of 'buf' in bytes
+ * @param u,    length of the string on the stack
+ * @return zero on success, negative on failure */
+int embed_pop_string(embed_t *h, char *buf, size_t size, size_t *u);
+
+/**@brief Pop a string, '( c-addr u -- )', without copying it, '*s' points
+ * into the core, it is not NUL terminated and is only valid until the
+ * virtual machine runs again. This needs the default MMU callbacks and a
+ * little endian host, and the string must not wrap around the end of the
+ * core, the stack is left as it was if not.
+ * @param h, initialized Virtual Machine
+ * @param s, set to the start of the string
+ * @param u, set to the length of the string
+ * @return zero on success, negative on failure */
+int embed_pop_string_view(embed_t *h, const char **s, size_t *u);
+
+/**@brief Store a counted string, a length byte followed by the string, in
+ * the dictionary, allotting space for it as 'c,' would, or at 'pad' where,
+ * as with 'embed_push_string', it is only good until the next string is put
+ * there. The dictionary pointer and 'pad' are found through the words 'here'
+ * and 'pad', so this only works with the eForth image.
+ * @param h,          initialized Virtual Machine
+ * @param buf,        string to store
+ * @param u,          length of 'buf', up to 255 bytes
+ * @param dictionary, non-zero to store it in the dictionary, zero for 'pad'
+ * @param c_addr,     set to the address of the counted string
+ * @return zero on success, negative on failure, -8 if the dictionary is full */
+int embed_counted_string(embed_t *h, const void *buf, size_t u, int dictionary, cell_t *c_addr);
+
 /**@brief Retrieve a copy of some sensible default options, the default options
  * contain callbacks and file handles that will read data from standard in,
  * write data to standard out and save to disk. You can modify the returned
@@ -250,18 +544,157 @@ int embed_puts(embed_t *h, const char *s);
  * @param h, initialized Virtual Machine image to reset */
 void embed_reset(embed_t *h);
 
-/**@brief get a pointer to VM core
+/**@brief get a pointer to VM core, cells written through it must be passed
+ * to 'embed_core_dirty' before the virtual machine is run again.
  * @warning be careful with this!
  * @param h, initialized Virtual Machine image
  * @return point to core image of embed_length() bytes long */
 cell_t *embed_core_get(embed_t *h);
 
+/**@brief Tell the library that cells have been written to through the
+ * pointer from 'embed_core_get', the decoded instructions and compiled code
+ * for them are thrown away. Use 'embed_cache_flush' if much of the core has
+ * changed.
+ * @param h,     initialized Virtual Machine image
+ * @param addr,  first cell written to
+ * @param cells, number of cells written to */
+void embed_core_dirty(embed_t *h, cell_t addr, size_t cells);
+
+/**@brief Get the size in bytes of the optional decoded instruction cache, a
+ * zeroed buffer of this size can be assigned to the 'cache' field of 'embed_t'.
+ * Instructions are decoded the first time they are executed and the decoded
+ * form is used until the cell containing them is written to. The cache is
+ * only used when the default MMU and yield callbacks are in use.
+ * @return size of the cache in bytes */
+size_t embed_cache_size(void);
+
+/**@brief Invalidate all of the entries in the decoded instruction cache, if
+ * there is one, and throw away any code compiled by the JIT. This must be
+ * called after writing to the core by any means other than the MMU callbacks
+ * and the functions in this library.
+ * @param h, initialized Virtual Machine image */
+void embed_cache_flush(embed_t *h);
+
+/**@brief Create a new JIT compiler, which can be assigned to the 'jit' field
+ * of 'embed_t'. Hot basic blocks are then translated into x86-64 machine code
+ * when the default MMU and yield callbacks are in use. Instructions that do
+ * I/O or call back into the host are always left to the interpreter.
+ * @return a new JIT compiler, or NULL if this platform is not supported or
+ * memory could not be allocated */
+embed_jit_t *embed_jit_new(void);
+
+/**@brief Free a JIT compiler, which must not be in use by any 'embed_t'
+ * @param j, JIT compiler to free, may be NULL */
+void embed_jit_free(embed_jit_t *j);
+
+/**@brief Get the statistics a JIT compiler has gathered
+ * @param j, JIT compiler
+ * @return copy of statistics */
+embed_jit_stats_t embed_jit_stats(const embed_jit_t *j);
+
+/**@brief Add a native override to a table, so that a call to the Forth word
+ * with the execution token 'xt' runs 'fn' instead, while the 'length' bytes
+ * of the body of the word are as they are now. The CRC of the body is
+ * checked on each call, the word is run as usual if it has changed, as it
+ * will if the word is forgotten and the space reused or another image is
+ * loaded. Only calls made by the interpreter are overridden, code compiled by
+ * the JIT calls the Forth word, as does 'execute'.
+ * @param h,      virtual machine whose image contains the word
+ * @param n,      table to add the override to
+ * @param xt,     execution token of the word, a byte address
+ * @param length, length of the body of the word in bytes
+ * @param fn,     host implementation of the word
+ * @param param,  passed to 'fn'
+ * @return zero on success, negative if the table is full or the word is
+ * already overridden */
+int embed_native_add(embed_t *h, embed_natives_t *n, cell_t xt, cell_t length, embed_native_t fn, void *param);
+
+/**@brief Add the default overrides for the image built into the library,
+ * 'embed_default_block', to a table. They are guarded by the CRC of the
+ * words in that image, so they are only used with it, or an image saved from
+ * it. Leave the 'natives' field of 'embed_t' as NULL to run the image without
+ * them, to compare the two for example.
+ * @param n, table to add the overrides to
+ * @return number of overrides added, or negative on failure */
+int embed_native_default(embed_natives_t *n);
+
+/**@brief Add a host function to the table the 'extensions' field of 'embed_t'
+ * points to, and define a Forth word 'name' that calls it, in the current
+ * compilation word list (chosen with 'definitions'). The word is a literal
+ * index into the table and the extension instruction, which takes 'in'
+ * cells off the stack for 'fn' and puts 'out' back without saving the
+ * registers in the core, so it costs less than the 'vm' instruction and
+ * 'embed_callback_t' do. It throws -4 if there are fewer than 'in' cells on
+ * the stack when the word is called, and -21 if the table is removed.
+ * @param h,     virtual machine to define the word in, it must not be running
+ * @param name,  name of the Forth word
+ * @param fn,    host function to call
+ * @param param, passed to 'fn'
+ * @param in,    cells taken off the stack, up to EMBED_EXTENSION_CELLS
+ * @param out,   cells put on the stack, up to EMBED_EXTENSION_CELLS
+ * @return index of the function in the table, or negative on failure */
+int embed_register(embed_t *h, const char *name, embed_extension_t fn, void *param, cell_t in, cell_t out);
+
 /**@brief evaluate a string, each line should be less than 80 chars and end in a newline
  * @param h,   an initialized virtual machine
  * @param str, string to evaluate
  * @return zero on success, negative on failure */
 int embed_eval(embed_t *h, const char *str);
 
+/**@brief Find a word by name in the search order of the eForth image, as
+ * 'find' does, so that it can be called with 'embed_call' without going
+ * through the text interpreter each time. Hidden words are not found. This
+ * only works with the eForth image built by 'embed.fth', or one built from
+ * it, as the search order is read from where that image keeps it, and
+ * that image only sets it up when it first runs, so nothing is found before.
+ * @param h,    an initialized virtual machine
+ * @param name, name of the word, case sensitive
+ * @param xt,   set to the execution token of the word, a byte address
+ * @return zero if found, negative otherwise */
+int embed_find(embed_t *h, const char *name, cell_t *xt);
+
+#define EMBED_CALL_HALTED (0x10002) /**< 'embed_call' status for a word that halted the virtual machine */
+
+/**@brief Call a word directly, the input stream and options are left
+ * alone. The arguments are pushed, 'args[0]' first, the word is executed
+ * within a frame like the one 'catch' makes and returns to a host sentinel,
+ * the last cell in the core, which halts the virtual machine. The results
+ * are popped off, the top of the stack into 'results[nresults - 1]'. The
+ * stacks, and the program counter, are left as they were before the call
+ * whatever the outcome. Any yield callback should not stop the virtual
+ * machine during the call. Like 'embed_find' this requires the eForth image,
+ * whose 'handler' variable the frame is linked into.
+ * @param h,        an initialized virtual machine
+ * @param xt,       execution token of the word, from 'embed_find'
+ * @param args,     arguments to push, may be NULL if 'nargs' is zero
+ * @param nargs,    number of arguments
+ * @param results,  set to the results, may be NULL if 'nresults' is zero
+ * @param nresults, number of results to pop
+ * @return zero on success, the value thrown if the word threw, -4 if it did
+ * not leave 'nresults' results, or EMBED_CALL_HALTED if the virtual machine
+ * halted somewhere else */
+int embed_call(embed_t *h, cell_t xt, const cell_t *args, size_t nargs, cell_t *results, size_t nresults);
+
+/**@brief Evaluate a snippet of Forth, as 'embed_eval' does, compiling it
+ * into an anonymous word the first time it is seen and calling that directly
+ * after that, as 'embed_call' does. The compiled snippets are kept in an
+ * area of the dictionary reserved the first time this is called. They are
+ * all thrown away when a word is defined, or forgotten, in a word list in
+ * the search order, when 'base' or 'state' changes, as the numbers in them
+ * were read in the old base, or when the area or the table is full. As a
+ * snippet is compiled it must not parse the input or define words, ': x ;'
+ * or 'char a' would not do what they would do if interpreted, and immediate
+ * words such as 'if' work in it. A snippet that fails to compile is reported
+ * by the interpreter and leaves the dictionary as it was. If it throws, the
+ * stack is left as it was and the value thrown is returned, it is not
+ * reported by the interpreter. Like 'embed_find' this only works with the
+ * eForth image.
+ * @param h,   an initialized virtual machine
+ * @param s,   cache of snippets for this virtual machine
+ * @param str, snippet to evaluate
+ * @return zero on success, negative on failure, or the value thrown */
+int embed_eval_cached(embed_t *h, embed_snippets_t *s, const char *str);
+
 /**@brief This array contains the default virtual machine image, generated from
  * 'embed-1.blk', which is included in the library. It contains a fully working
  * eForth image */
@@ -3,245 +3,251 @@
 #include <stddef.h>
 
 const uint8_t embed_default_block[] = {
-20,0,0,0,255,127,0,36,77,3,0,128,0,0,20,0,0,0,255,127,0,36,137,70,84,
-72,13,10,26,10,38,21,237,86,1,0,132,25,1,0,72,9,141,98,28,96,141,98,28,99,
-222,16,28,21,0,0,3,112,97,100,23,64,0,65,54,0,4,99,101,108,108,0,23,64,2,0,
-64,0,5,98,47,98,117,102,23,64,0,4,38,21,92,20,232,15,76,0,3,62,105,110,21,
-64,0,0,94,0,5,115,116,97,116,101,21,64,0,0,104,0,3,104,108,100,21,64,0,0,
-116,0,4,98,97,115,101,0,21,64,10,0,126,0,4,115,112,97,110,0,21,64,0,0,138,
-0,3,98,108,107,21,64,0,0,150,0,3,100,112,108,21,64,255,255,160,0,7,99,
-117,114,114,101,110,116,21,64,90,0,0,0,9,60,108,105,116,101,114,97,108,62,
-21,64,2,12,184,0,6,60,98,111,111,116,62,0,21,64,218,18,200,0,4,60,111,107,
-62,0,21,64,0,0,170,0,3,100,117,112,157,96,226,0,4,111,118,101,114,0,157,
-97,234,0,6,105,110,118,101,114,116,0,28,106,214,0,3,117,109,43,28,101,0,1,
-3,117,109,42,28,102,244,0,1,43,63,101,16,1,1,42,63,102,22,1,4,115,119,97,
-112,0,156,97,28,1,3,110,105,112,31,96,38,1,4,100,114,111,112,0,31,97,46,1,
-1,64,28,99,56,1,1,33,31,100,62,1,6,114,115,104,105,102,116,0,31,112,68,1,
-6,108,115,104,105,102,116,0,31,113,80,1,1,61,31,109,92,1,2,117,60,0,31,
-110,98,1,1,60,31,111,106,1,3,97,110,100,31,103,112,1,3,120,111,114,31,105,
-120,1,2,111,114,0,31,104,128,1,2,49,45,0,28,107,136,1,2,48,61,0,28,108,8,1,
-3,114,120,63,189,120,152,1,3,116,120,33,63,119,160,1,6,40,115,97,118,101,
-41,0,31,118,168,1,2,118,109,0,28,124,144,1,6,117,109,47,109,111,100,0,156,
-121,188,1,4,47,109,111,100,0,156,122,200,1,1,47,31,122,210,1,3,109,111,100,
-63,122,216,1,36,101,120,105,116,0,28,96,224,1,34,62,114,0,71,97,234,1,34,
-114,62,0,141,98,242,1,34,114,64,0,129,98,250,1,37,114,100,114,111,112,12,
-96,0,128,28,106,255,255,28,106,3,97,3,97,0,128,28,96,114,128,28,99,1,128,
-31,103,102,128,28,99,136,128,28,99,71,97,0,123,12,96,28,96,0,128,0,125,
-129,96,63,125,33,33,12,96,28,96,28,96,2,2,5,50,100,114,111,112,3,97,31,97,
-68,2,2,49,43,0,1,128,63,101,80,2,6,110,101,103,97,116,101,0,0,107,28,106,
-90,2,1,45,50,65,63,101,129,97,54,1,129,97,63,101,104,2,7,97,108,105,103,
-110,101,100,129,96,16,65,63,101,120,2,3,98,121,101,0,128,6,65,22,1,2,128,
-54,1,136,2,5,99,101,108,108,43,2,128,63,101,152,2,5,99,101,108,108,115,1,
-128,31,113,164,2,5,99,104,97,114,115,1,128,31,112,176,2,4,63,100,117,112,0,
-129,96,101,33,157,96,28,96,188,2,1,62,128,97,31,111,204,2,2,117,62,0,128,
-97,31,110,212,2,2,60,62,0,3,109,28,106,222,2,3,48,60,62,0,108,28,106,232,
-2,2,48,62,0,0,128,104,1,242,2,2,48,60,0,0,128,31,111,252,2,4,50,100,117,
-112,0,129,97,157,97,6,3,4,116,117,99,107,0,128,97,157,97,18,3,2,43,33,0,
-141,65,0,99,35,101,128,97,31,100,0,128,149,1,30,3,3,49,43,33,1,128,128,97,
-146,1,50,3,3,49,45,33,6,65,157,1,62,3,2,50,33,0,141,65,3,100,80,65,31,100,
-72,3,2,50,64,0,129,96,80,65,0,99,128,97,28,99,182,128,28,99,182,128,31,
-100,86,3,2,98,108,0,32,128,28,96,110,3,6,119,105,116,104,105,110,0,56,65,
-71,97,54,65,141,98,31,110,129,96,129,1,120,3,3,97,98,115,198,65,206,33,50,
-1,28,96,144,3,6,115,111,117,114,99,101,0,42,192,174,1,212,65,31,97,158,3,
-9,115,111,117,114,99,101,45,105,100,6,192,28,99,176,3,3,114,111,116,71,
-97,128,97,141,98,156,97,192,3,4,45,114,111,116,0,227,65,227,1,227,65,31,
-97,3,104,28,108,0,106,71,97,0,106,1,128,0,101,141,98,63,101,71,97,128,97,
-71,97,0,101,141,98,35,101,141,98,63,101,206,3,7,101,120,101,99,117,116,
-101,71,97,28,96,0,99,98,65,11,34,5,2,28,96,0,4,2,99,64,0,129,99,128,97,16,
-65,3,128,3,113,3,112,255,128,31,103,24,4,2,99,33,0,141,65,16,65,3,128,3,
-113,68,96,128,97,21,66,128,97,3,113,129,97,0,99,255,128,141,98,8,128,3,105,
-3,113,3,103,3,104,149,1,46,4,4,104,101,114,101,0,88,128,28,99,90,4,5,97,
-108,105,103,110,49,66,65,65,88,128,31,100,102,4,5,97,108,108,111,116,88,
-128,146,1,64,98,128,97,71,97,71,97,28,96,141,98,141,98,128,97,64,98,28,96,
-70,66,98,65,83,34,0,107,71,97,0,99,71,97,28,96,80,65,71,97,28,96,118,4,3,
-109,105,110,129,111,92,34,31,97,31,96,172,4,3,109,97,120,135,65,104,65,90,
-2,186,4,3,107,101,121,16,192,7,66,129,96,110,34,3,96,1,128,6,65,22,65,0,
-108,102,34,129,96,6,65,114,65,30,65,3,97,71,65,102,2,198,4,7,47,115,116,
-114,105,110,103,129,97,89,66,227,65,58,65,235,65,54,1,1,128,124,2,238,4,5,
-99,111,117,110,116,129,96,43,65,128,97,15,2,129,97,15,2,129,97,8,128,3,
-112,3,105,129,96,4,128,3,112,3,105,129,96,5,128,3,113,3,105,129,96,12,128,
-3,113,3,105,128,97,8,128,3,113,31,105,180,1,3,99,114,99,6,65,71,97,98,65,
-176,34,140,66,141,98,128,97,142,66,71,97,130,66,167,2,141,98,31,96,179,65,
-28,99,24,192,7,2,8,5,4,101,109,105,116,0,18,192,7,2,108,5,2,99,114,0,13,
-128,186,66,10,128,186,2,120,5,5,115,112,97,99,101,1,128,32,128,128,97,0,
-128,96,66,71,97,208,2,129,96,186,66,75,66,156,5,31,97,58,128,186,66,199,2,
-129,114,128,97,54,1,134,5,5,100,101,112,116,104,0,200,214,66,74,65,92,1,
-178,5,4,112,105,99,107,0,86,65,214,66,28,99,86,65,214,66,0,116,31,97,129,
-96,127,128,32,128,193,65,243,34,3,97,95,128,28,96,194,5,4,116,121,112,101,
-0,0,128,71,97,129,96,5,35,128,97,136,66,129,98,1,35,236,66,186,66,128,97,
-0,107,250,2,12,96,38,1,136,66,248,2,6,65,249,2,232,5,5,99,109,111,118,
-101,71,97,25,3,71,97,129,96,15,66,129,98,26,66,43,65,141,98,43,65,75,66,34,
-6,38,1,22,6,4,102,105,108,108,0,128,97,71,97,128,97,39,3,135,65,26,66,43,
-65,75,66,72,6,38,1,56,6,5,99,97,116,99,104,129,114,71,97,10,192,0,99,71,
-97,129,115,10,192,3,100,5,66,141,98,10,192,3,100,141,98,11,1,84,6,5,116,
-104,114,111,119,98,65,76,35,10,192,0,99,3,117,141,98,10,192,3,100,64,98,0,
-116,3,97,141,98,28,96,50,65,64,3,1,128,221,66,3,111,30,65,4,128,77,3,120,6,
-7,100,101,99,105,109,97,108,10,128,136,128,31,100,170,6,3,104,101,120,16,
-128,91,3,20,65,129,96,2,128,54,65,35,128,3,110,30,65,90,67,40,128,77,3,186,
-6,4,104,111,108,100,0,124,128,0,99,0,107,129,96,124,128,3,100,26,66,124,
-128,0,99,0,193,128,128,54,65,109,65,30,65,17,128,77,3,68,96,128,121,64,98,
-128,121,141,98,227,1,9,128,129,97,3,111,7,128,3,103,35,101,48,128,63,101,
-216,6,2,35,62,0,38,65,124,128,0,99,0,193,56,1,28,7,1,35,2,128,80,67,0,128,
-20,65,128,67,134,67,112,3,44,7,2,35,115,0,152,67,135,65,239,65,162,35,28,
-96,62,7,2,60,35,0,0,193,124,128,31,100,78,7,4,115,105,103,110,0,129,65,0,
-108,30,65,45,128,112,3,68,96,203,65,0,128,170,67,162,67,141,98,177,67,145,
-3,0,128,170,67,162,67,145,3,90,7,3,117,46,114,71,97,190,67,141,98,56,65,
-200,66,248,2,129,96,199,66,5,128,197,3,132,7,2,117,46,0,190,67,199,66,248,
-2,158,7,1,46,182,67,211,3,2,128,50,65,31,103,68,5,5,112,97,99,107,36,65,
-65,68,96,129,97,129,96,217,67,54,65,58,65,151,65,135,65,26,66,43,65,128,
-97,15,67,141,98,28,96,170,7,7,99,111,109,112,97,114,101,227,65,56,65,98,
-65,252,35,71,97,38,65,141,98,31,96,71,97,8,4,136,66,227,65,136,66,227,65,
-54,65,98,65,8,36,12,96,3,96,31,96,75,66,252,7,10,1,71,97,129,97,129,98,3,
-111,129,96,23,36,8,128,129,96,180,66,32,128,180,66,180,66,141,98,63,101,
-129,96,180,66,129,97,26,66,43,1,129,96,8,128,3,109,128,97,127,128,3,109,3,
-104,28,108,129,96,13,128,3,105,47,36,30,68,46,36,32,128,25,4,11,4,3,97,3,
-96,157,96,129,96,32,128,54,65,149,128,3,110,128,97,127,128,114,65,31,103,
-26,65,2,128,3,103,119,1,222,7,6,97,99,99,101,112,116,0,58,65,129,97,129,
-105,96,36,71,97,65,66,102,66,70,66,227,65,141,98,128,97,129,96,59,68,89,36,
-50,68,86,36,25,68,88,4,22,192,7,66,95,4,10,128,3,105,94,36,25,68,95,4,47,
-68,70,4,3,97,56,1,126,8,6,101,120,112,101,99,116,0,20,192,7,66,148,128,3,
-100,31,97,196,8,5,113,117,101,114,121,214,65,80,128,20,192,7,66,42,192,3,
-100,11,65,102,128,31,100,136,66,31,128,31,103,184,7,3,110,102,97,80,1,248,
-8,3,99,102,97,127,68,129,96,15,66,122,68,35,101,80,65,217,3,127,68,121,
-68,248,66,199,2,127,68,64,128,128,97,0,99,3,103,119,1,127,68,32,128,144,4,
-224,129,12,130,193,1,128,97,71,97,129,96,129,96,178,36,129,96,127,68,136,
-66,159,128,3,103,129,98,136,66,244,67,0,108,175,36,12,96,129,96,142,68,1,
-128,3,104,50,1,3,96,129,99,157,4,12,96,10,1,71,97,26,192,129,99,198,36,129,
-99,0,99,129,98,128,97,154,68,98,65,196,36,71,97,237,65,141,98,12,96,28,96,
-80,65,182,4,11,65,141,98,12,1,216,8,15,115,101,97,114,99,104,45,119,111,
-114,100,108,105,115,116,154,68,237,1,146,9,4,102,105,110,100,0,180,68,237,
-1,71,97,48,128,54,65,9,128,129,97,3,111,231,36,7,128,54,65,129,96,10,128,
-3,111,3,104,129,96,141,98,31,110,168,9,7,62,110,117,109,98,101,114,135,
-65,65,66,3,97,15,66,20,65,218,68,0,108,250,36,3,97,70,66,28,96,128,97,20,
-65,0,102,3,97,227,65,20,65,0,102,248,65,70,66,130,66,129,108,239,36,28,96,
-6,65,168,128,3,100,20,65,71,97,140,66,45,128,3,109,68,96,18,37,130,66,
-140,66,36,128,3,109,24,37,96,67,130,66,65,66,0,128,129,96,70,66,239,68,129,
-96,48,37,140,66,46,128,3,105,41,37,237,65,227,65,141,98,10,65,141,98,91,3,
-0,107,168,128,3,100,43,65,168,128,0,99,28,5,38,65,141,98,52,37,241,65,
-141,98,91,67,6,1,71,97,66,5,32,128,129,97,129,98,35,101,15,66,3,111,66,37,
-141,98,43,1,75,66,114,10,12,1,128,97,71,97,235,65,129,96,88,37,140,66,129,
-98,54,65,129,98,32,128,3,109,4,128,229,66,5,66,86,37,12,96,237,1,130,66,
-72,5,12,96,237,1,92,37,124,1,119,1,90,69,28,106,71,97,129,97,141,98,128,
-97,65,66,129,98,180,138,69,69,135,65,141,98,186,138,69,69,128,97,141,98,
-54,65,71,97,54,65,141,98,43,1,212,9,5,112,97,114,115,101,71,97,214,65,18,
-65,35,101,42,192,0,99,18,65,54,65,129,98,95,69,102,128,146,65,141,98,32,
-128,3,109,135,37,55,69,0,128,96,2,228,10,65,41,28,96,18,11,65,40,41,128,
-118,69,38,1,24,11,2,46,40,0,41,128,118,69,248,2,34,11,65,92,42,192,0,99,
-119,4,129,96,64,128,3,110,30,65,19,128,77,3,46,11,4,119,111,114,100,0,79,
-67,118,69,156,69,49,66,224,3,32,128,166,5,68,11,4,99,104,97,114,0,171,69,
-136,66,3,97,15,2,129,96,255,191,3,110,30,65,8,128,77,3,90,11,1,44,49,66,
-129,96,80,65,181,69,56,66,31,100,118,11,2,99,44,0,49,66,181,69,26,66,88,
-128,156,1,8,65,3,104,189,5,134,11,103,108,105,116,101,114,97,108,129,96,8,
-65,3,103,219,37,0,106,203,69,0,234,189,5,203,5,92,65,0,192,31,104,156,11,
-8,99,111,109,112,105,108,101,44,0,220,69,189,5,129,96,151,68,237,37,131,
-68,0,99,189,5,131,68,229,5,212,65,248,66,13,128,77,3,129,96,148,68,0,108,
-30,65,212,65,248,66,14,128,77,3,0,9,9,40,108,105,116,101,114,97,108,41,14,
-65,0,108,30,65,211,5,190,11,9,105,110,116,101,114,112,114,101,116,216,68,
-98,65,25,38,14,65,21,38,124,65,20,38,131,68,5,2,231,5,3,97,243,69,131,68,
-5,2,68,96,136,66,7,69,43,38,12,96,168,128,0,99,129,65,36,38,3,97,41,6,14,
-65,39,38,128,97,198,128,7,66,198,128,7,2,141,98,239,5,10,12,39,99,111,109,
-112,105,108,101,141,98,129,99,189,69,80,65,71,97,28,96,90,12,9,105,109,109,
-101,100,105,97,116,101,64,128,178,66,127,68,141,65,0,99,3,105,149,1,127,68,
-128,128,128,97,65,6,136,66,63,101,70,66,129,96,73,70,65,65,71,97,128,97,71,
-97,28,96,75,70,28,96,75,70,7,3,112,12,98,36,34,0,50,70,83,70,34,128,166,
-69,73,70,56,2,174,12,98,46,34,0,50,70,85,70,92,6,192,12,5,97,98,111,114,
-116,6,65,6,65,22,1,128,97,114,38,7,67,191,66,106,6,31,97,75,70,109,6,204,
-12,102,97,98,111,114,116,34,0,50,70,115,70,92,6,14,65,30,65,85,70,3,32,
-111,107,191,2,46,192,42,192,80,65,3,100,0,128,119,68,6,192,151,1,4,128,26,
-65,3,103,119,1,246,11,3,105,111,33,131,70,158,129,16,192,3,100,166,129,18,
-192,3,100,139,70,0,108,250,140,3,103,54,129,50,136,59,68,164,38,38,65,116,
-133,76,136,136,136,20,192,3,100,22,192,3,100,24,192,3,100,224,128,31,100,
-17,128,186,2,30,13,4,102,105,108,101,0,90,141,54,129,76,136,164,6,234,12,
-1,93,6,65,114,128,31,100,110,13,65,91,114,128,151,1,0,200,28,116,98,65,0,
-108,30,65,215,67,63,128,186,66,191,66,192,70,131,70,190,6,171,69,129,96,15,
-66,212,38,11,70,0,128,80,67,204,6,3,97,224,128,7,2,120,13,4,113,117,105,
-116,0,202,70,112,68,152,141,46,67,194,70,220,6,28,96,212,65,18,65,222,65,
-224,128,28,99,224,128,3,100,6,192,3,100,119,68,42,192,167,1,174,13,8,101,
-118,97,108,117,97,116,101,0,226,70,65,66,65,66,71,97,0,128,6,65,0,128,231,
-70,152,141,46,67,141,98,70,66,70,66,231,70,64,3,173,171,3,109,30,65,22,
-128,77,3,129,96,179,65,154,68,0,108,30,65,199,66,38,65,2,192,0,99,138,68,
-85,70,9,114,101,100,101,102,105,110,101,100,191,2,129,96,15,66,30,65,10,
-128,77,3,171,69,216,68,30,65,239,5,30,71,131,4,220,13,65,39,34,71,14,65,42,
-39,211,5,28,96,72,14,105,91,99,111,109,112,105,108,101,93,34,71,229,5,86,
-14,102,91,99,104,97,114,93,0,177,69,211,5,102,14,97,59,3,71,28,224,189,69,
-190,70,98,65,68,39,179,65,31,100,28,96,116,14,1,58,55,66,49,66,129,96,2,
-192,3,100,178,66,189,69,171,69,25,71,8,71,73,70,56,66,173,171,185,6,138,14,
-101,98,101,103,105,110,49,2,170,14,101,97,103,97,105,110,92,65,189,5,180,
-14,101,117,110,116,105,108,0,192,3,104,94,7,49,66,12,1,103,71,94,7,192,14,
-98,105,102,0,103,71,100,7,214,14,100,116,104,101,110,0,49,66,92,65,129,97,
-0,99,3,104,149,1,224,14,100,101,108,115,101,0,105,71,128,97,116,7,244,14,
-101,119,104,105,108,101,110,7,2,15,102,114,101,112,101,97,116,0,128,97,94,
-71,116,7,2,192,0,99,131,4,12,15,103,114,101,99,117,114,115,101,142,71,229,
-5,34,15,6,99,114,101,97,116,101,0,71,71,3,97,50,70,21,64,179,65,3,100,
-190,6,48,15,5,62,98,111,100,121,80,1,141,98,92,65,49,66,92,65,142,71,129,
-96,80,65,203,69,3,100,189,5,72,15,101,100,111,101,115,62,50,70,169,71,28,
-96,102,15,8,118,97,114,105,97,98,108,101,0,157,71,0,128,189,5,116,15,8,99,
-111,110,115,116,97,110,116,0,157,71,46,128,220,69,49,66,74,65,177,7,134,15,
-7,58,110,111,110,97,109,101,103,71,173,171,185,6,158,15,99,102,111,114,
-71,225,189,69,49,2,174,15,100,110,101,120,116,0,50,70,75,66,189,5,186,15,
-99,97,102,116,3,97,105,71,89,71,156,97,94,13,4,104,105,100,101,0,30,71,69,
-6,35,125,71,97,28,96,214,15,5,116,114,97,99,101,34,71,26,65,68,96,1,128,
-3,104,241,71,141,98,63,125,0,128,71,97,129,99,129,98,114,65,8,40,80,65,2,
-8,12,96,28,96,200,15,9,103,101,116,45,111,114,100,101,114,26,192,0,72,
-129,96,74,65,128,97,26,192,54,65,92,65,68,96,0,107,198,65,30,40,50,128,77,
-3,71,97,35,8,129,99,128,97,74,65,75,66,64,16,0,99,141,98,28,96,0,0,14,
-102,111,114,116,104,45,119,111,114,100,108,105,115,116,0,90,128,28,96,80,
-16,6,115,121,115,116,101,109,0,92,128,28,96,102,16,9,115,101,116,45,111,
-114,100,101,114,129,96,6,65,3,109,72,40,3,97,50,128,1,128,64,8,129,96,8,
-128,104,65,78,40,49,128,77,3,26,192,128,97,71,97,85,8,141,65,3,100,80,65,
-75,66,164,16,151,1,116,16,5,102,111,114,116,104,50,128,49,72,2,128,64,8,
-127,68,15,66,128,128,3,103,28,108,98,65,110,40,129,96,96,72,108,40,129,96,
-138,68,0,99,101,8,191,2,176,16,5,119,111,114,100,115,16,72,98,65,127,40,
-128,97,129,96,191,66,210,67,211,66,0,99,101,72,0,107,116,8,28,96,20,16,4,
-111,110,108,121,0,6,65,64,8,0,17,11,100,101,102,105,110,105,116,105,111,
-110,115,26,192,0,99,181,1,129,96,158,40,0,107,128,97,71,97,144,72,129,97,
-129,98,3,105,157,40,43,65,141,98,235,1,12,96,28,96,12,17,6,45,111,114,100,
-101,114,0,16,72,144,72,3,96,64,8,62,17,6,43,111,114,100,101,114,0,68,96,
-164,72,16,72,141,98,128,97,43,65,64,8,80,17,6,101,100,105,116,111,114,0,52,
-128,173,8,104,17,6,117,112,100,97,116,101,0,6,65,12,192,31,100,158,128,28,
-99,195,72,63,101,118,17,4,115,97,118,101,0,0,128,49,66,3,118,64,3,142,17,
-5,102,108,117,115,104,12,192,0,99,0,108,30,65,0,128,6,65,205,8,158,17,5,
-98,108,111,99,107,79,67,129,96,63,128,109,65,229,40,35,128,77,3,129,96,
-158,128,3,100,10,128,31,113,6,128,31,113,6,128,31,112,234,72,128,97,222,72,
-35,101,64,128,28,96,238,72,244,6,180,17,4,108,111,97,100,0,0,128,15,128,
-71,97,135,65,65,66,244,72,70,66,43,65,75,66,250,17,38,1,124,128,186,2,3,
-128,200,66,64,128,45,128,201,66,191,2,129,96,2,128,197,3,222,72,31,97,236,
-17,4,108,105,115,116,0,129,96,16,73,191,66,7,73,0,128,129,96,16,128,3,111,
-40,41,135,65,13,73,5,73,238,72,9,67,5,73,191,66,43,65,27,9,7,73,38,1,38,
-128,0,99,16,65,28,108,1,128,38,128,65,6,42,73,52,41,12,1,30,128,0,99,49,66,
-3,105,59,41,2,128,28,96,32,128,0,99,32,128,151,65,0,128,49,66,165,66,3,
-105,70,41,3,128,28,96,46,73,12,1,49,73,98,65,78,41,50,65,129,96,22,1,18,
-128,16,73,146,70,92,72,192,70,1,128,0,106,3,117,212,128,7,2,139,70,30,65,
-96,67,85,70,8,101,70,79,82,84,72,32,118,0,132,153,0,128,197,67,191,66,90,
-67,49,66,215,67,0,192,49,66,54,65,210,67,191,2,88,73,219,6,129,97,131,68,
-114,65,116,41,11,1,127,4,255,159,31,103,86,65,117,73,71,97,129,96,139,41,
-129,99,129,97,129,98,235,65,193,65,137,41,129,99,129,98,111,73,98,65,137,
-41,12,96,31,96,0,99,122,9,12,96,28,96,71,97,16,72,129,96,158,41,128,97,
-129,98,119,73,98,65,156,41,71,97,0,107,232,66,141,98,12,96,28,96,0,107,143,
-9,12,96,28,96,71,97,0,103,141,98,31,109,129,96,117,73,86,65,204,67,199,
-66,141,73,98,65,174,41,121,68,248,66,28,96,8,65,8,65,160,73,184,41,76,128,
-186,66,255,255,3,103,204,3,0,224,0,224,160,73,191,41,65,128,186,66,31,97,0,
-224,0,192,160,73,198,41,67,128,186,66,164,9,0,224,0,160,160,73,205,41,90,
-128,186,66,164,9,66,128,186,66,164,9,71,97,129,96,129,98,3,110,222,41,203,
-67,211,66,129,99,203,67,199,66,175,73,191,66,80,65,209,9,12,96,31,97,36,
-18,3,115,101,101,171,69,180,68,32,71,128,97,129,109,235,41,3,97,49,66,71,
-97,191,66,211,66,129,96,138,68,129,96,191,66,131,68,141,98,208,73,199,66,
-59,128,186,66,129,96,148,68,3,42,85,70,13,32,99,111,109,112,105,108,101,
-45,111,110,108,121,129,96,151,68,11,42,85,70,7,32,105,110,108,105,110,101,
-142,68,20,42,85,70,10,32,105,109,109,101,100,105,97,116,101,0,191,2,192,19,
-2,46,115,0,221,66,98,65,32,42,129,96,229,66,215,67,0,107,25,10,85,70,4,
-32,60,115,112,0,191,2,92,65,71,97,43,10,129,99,204,67,80,65,75,66,80,20,
-28,96,42,20,4,100,117,109,112,0,16,128,35,101,4,128,3,112,71,97,67,10,191,
-66,16,128,135,65,129,97,204,67,211,66,37,74,235,65,2,128,200,66,9,67,75,
-66,112,20,31,97,195,72,222,8,129,96,0,132,236,72,3,110,30,65,24,128,77,3,
-72,74,234,72,70,74,63,101,0,0,1,108,16,9,166,20,1,118,195,72,22,9,172,20,
-1,110,1,128,197,72,85,74,88,10,180,20,1,112,6,65,93,10,192,20,1,122,70,
-74,0,132,32,128,32,3,200,20,1,107,79,74,64,128,104,10,212,20,1,115,192,72,
-211,8,222,20,1,113,52,128,164,8,230,20,1,120,117,74,195,72,250,72,185,8,
-238,20,2,105,97,0,234,72,35,101,70,74,35,101,214,65,18,65,35,101,128,97,
-212,65,3,96,18,65,54,65,15,67,153,5,250,20,1,105,0,128,128,97,128,10,
+20,0,0,0,255,127,0,36,71,3,0,128,0,0,20,0,0,0,255,127,0,36,137,70,84,
+72,13,10,26,10,172,21,47,231,1,0,132,25,1,0,138,9,141,98,28,96,141,98,28,
+99,98,17,162,21,0,0,16,15,0,0,0,0,3,112,97,100,23,64,0,65,60,0,4,99,101,
+108,108,0,23,64,2,0,70,0,5,98,47,98,117,102,23,64,0,4,172,21,224,20,108,16,
+82,0,3,62,105,110,21,64,0,0,100,0,5,115,116,97,116,101,21,64,0,0,110,0,3,
+104,108,100,21,64,0,0,122,0,4,98,97,115,101,0,21,64,10,0,132,0,4,115,112,
+97,110,0,21,64,0,0,144,0,3,98,108,107,21,64,0,0,156,0,3,100,112,108,21,64,
+255,255,166,0,7,99,117,114,114,101,110,116,21,64,96,0,0,0,9,60,108,105,116,
+101,114,97,108,62,21,64,84,11,190,0,6,60,98,111,111,116,62,0,21,64,94,19,
+206,0,4,60,111,107,62,0,21,64,0,0,176,0,3,100,117,112,157,96,232,0,4,111,
+118,101,114,0,157,97,240,0,6,105,110,118,101,114,116,0,28,106,220,0,3,117,
+109,43,28,101,6,1,3,117,109,42,28,102,250,0,1,43,63,101,22,1,1,42,63,102,
+28,1,4,115,119,97,112,0,156,97,34,1,3,110,105,112,31,96,44,1,4,100,114,
+111,112,0,31,97,52,1,1,64,28,99,62,1,1,33,31,100,68,1,6,114,115,104,105,
+102,116,0,31,112,74,1,6,108,115,104,105,102,116,0,31,113,86,1,1,61,31,109,
+98,1,2,117,60,0,31,110,104,1,1,60,31,111,112,1,3,97,110,100,31,103,118,1,
+3,120,111,114,31,105,126,1,2,111,114,0,31,104,134,1,2,49,45,0,28,107,142,
+1,2,48,61,0,28,108,14,1,3,114,120,63,189,120,158,1,3,116,120,33,63,119,
+166,1,6,40,115,97,118,101,41,0,31,118,174,1,2,118,109,0,28,124,150,1,6,117,
+109,47,109,111,100,0,156,121,194,1,4,47,109,111,100,0,156,122,206,1,1,47,
+31,122,216,1,3,109,111,100,63,122,222,1,36,101,120,105,116,0,28,96,230,1,
+34,62,114,0,71,97,240,1,34,114,62,0,141,98,248,1,34,114,64,0,129,98,0,2,
+37,114,100,114,111,112,12,96,0,128,28,106,255,255,28,106,3,97,3,97,0,128,
+28,96,120,128,28,99,1,128,31,103,108,128,28,99,142,128,28,99,71,97,0,123,
+12,96,28,96,0,128,0,125,129,96,63,125,36,33,12,96,28,96,28,96,8,2,5,50,
+100,114,111,112,3,97,31,97,74,2,2,49,43,0,1,128,63,101,86,2,6,110,101,103,
+97,116,101,0,0,107,28,106,96,2,1,45,53,65,63,101,129,97,57,1,129,97,63,
+101,110,2,7,97,108,105,103,110,101,100,129,96,19,65,63,101,126,2,3,98,121,
+101,0,128,9,65,25,1,2,128,57,1,142,2,5,99,101,108,108,43,2,128,63,101,158,
+2,5,99,101,108,108,115,1,128,31,113,170,2,5,99,104,97,114,115,1,128,31,
+112,182,2,4,63,100,117,112,0,129,96,104,33,157,96,28,96,194,2,1,62,128,97,
+31,111,210,2,2,117,62,0,128,97,31,110,218,2,2,60,62,0,3,109,28,106,228,2,
+3,48,60,62,0,108,28,106,238,2,2,48,62,0,0,128,107,1,248,2,2,48,60,0,0,
+128,31,111,2,3,4,50,100,117,112,0,129,97,157,97,12,3,4,116,117,99,107,0,
+128,97,157,97,24,3,2,43,33,0,144,65,0,99,35,101,128,97,31,100,0,128,152,1,
+36,3,3,49,43,33,1,128,128,97,149,1,56,3,3,49,45,33,9,65,160,1,68,3,2,50,
+33,0,144,65,3,100,83,65,31,100,78,3,2,50,64,0,129,96,83,65,0,99,128,97,28,
+99,188,128,28,99,188,128,31,100,92,3,2,98,108,0,32,128,28,96,116,3,6,119,
+105,116,104,105,110,0,59,65,71,97,57,65,141,98,31,110,129,96,132,1,126,3,3,
+97,98,115,201,65,209,33,53,1,28,96,150,3,6,115,111,117,114,99,101,0,42,
+192,177,1,215,65,31,97,164,3,9,115,111,117,114,99,101,45,105,100,6,192,28,
+99,182,3,3,114,111,116,71,97,128,97,141,98,156,97,198,3,4,45,114,111,116,
+0,230,65,230,1,230,65,31,97,3,104,28,108,212,3,7,100,110,101,103,97,116,
+101,8,109,28,96,232,3,2,100,43,0,10,107,28,96,246,3,2,100,45,0,10,108,28,
+96,0,4,2,100,60,0,11,110,28,96,10,4,2,109,42,0,8,111,28,96,20,4,5,109,47,
+109,111,100,11,112,28,96,201,65,24,34,8,109,28,96,132,65,28,34,53,65,28,96,
+30,4,6,115,109,47,114,101,109,0,129,97,71,97,71,97,21,66,129,98,206,65,
+128,121,141,98,129,98,3,105,25,66,128,97,141,98,25,66,156,97,58,4,5,42,47,
+109,111,100,71,97,8,111,141,98,34,2,98,4,2,42,47,0,53,66,31,96,114,4,7,101,
+120,101,99,117,116,101,71,97,28,96,0,99,101,65,73,34,67,2,28,96,124,4,2,99,
+64,0,8,96,28,96,148,4,2,99,33,0,11,97,28,96,158,4,4,104,101,114,101,0,94,
+128,28,99,168,4,5,97,108,105,103,110,88,66,68,65,94,128,31,100,180,4,5,97,
+108,108,111,116,94,128,149,1,64,98,128,97,71,97,71,97,28,96,141,98,141,98,
+128,97,64,98,28,96,196,4,3,109,105,110,129,111,120,34,31,97,31,96,228,4,3,
+109,97,120,138,65,107,65,118,2,242,4,3,107,101,121,16,192,69,66,129,96,138,
+34,3,96,1,128,9,65,25,65,0,108,130,34,129,96,9,65,117,65,33,65,3,97,74,65,
+130,2,254,4,7,47,115,116,114,105,110,103,129,97,117,66,230,65,61,65,238,65,
+57,1,1,128,152,2,38,5,5,99,111,117,110,116,129,96,46,65,128,97,8,96,28,96,
+129,97,8,96,28,96,186,1,3,99,114,99,11,106,28,96,182,65,28,99,24,192,69,2,
+64,5,4,101,109,105,116,0,18,192,69,2,106,5,2,99,114,0,13,128,185,66,10,
+128,185,2,118,5,5,115,112,97,99,101,1,128,32,128,128,97,0,128,124,66,71,97,
+207,2,129,96,185,66,129,126,205,34,31,97,58,128,185,66,198,2,129,114,128,
+97,57,1,132,5,5,100,101,112,116,104,0,200,213,66,77,65,95,1,176,5,4,112,
+105,99,107,0,89,65,213,66,28,99,89,65,213,66,0,116,31,97,129,96,127,128,32,
+128,196,65,242,34,3,97,95,128,28,96,192,5,4,116,121,112,101,0,0,128,71,97,
+129,96,4,35,128,97,164,66,129,98,0,35,235,66,185,66,128,97,0,107,249,2,12,
+96,41,1,164,66,247,2,9,65,248,2,230,5,5,99,109,111,118,101,11,98,28,96,20,
+6,4,102,105,108,108,0,11,99,28,96,32,6,5,101,114,97,115,101,0,128,11,99,
+28,96,44,6,5,99,97,116,99,104,129,114,71,97,10,192,0,99,71,97,12,128,0,99,
+71,97,129,115,10,192,3,100,67,66,12,96,141,98,10,192,3,100,141,98,14,1,58,
+6,5,116,104,114,111,119,101,65,70,35,10,192,0,99,3,117,141,98,12,128,3,
+100,141,98,10,192,3,100,64,98,0,116,3,97,141,98,28,96,53,65,55,3,1,128,220,
+66,3,111,33,65,4,128,71,3,102,6,7,100,101,99,105,109,97,108,10,128,142,
+128,31,100,158,6,3,104,101,120,16,128,85,3,23,65,129,96,2,128,57,65,35,128,
+3,110,33,65,84,67,40,128,71,3,174,6,4,104,111,108,100,0,130,128,0,99,0,
+107,129,96,130,128,3,100,11,97,130,128,0,99,0,193,128,128,57,65,112,65,33,
+65,17,128,71,3,68,96,128,121,64,98,128,121,141,98,230,1,9,128,129,97,3,
+111,7,128,3,103,35,101,48,128,63,101,204,6,2,35,62,0,41,65,130,128,0,99,0,
+193,59,1,16,7,1,35,2,128,74,67,0,128,23,65,122,67,128,67,106,3,32,7,2,35,
+115,0,2,128,74,67,130,128,0,99,23,65,11,105,130,128,3,100,113,3,50,7,2,60,
+35,0,0,193,130,128,31,100,74,7,4,115,105,103,110,0,132,65,0,108,33,65,45,
+128,106,3,68,96,206,65,0,128,168,67,156,67,141,98,175,67,139,3,0,128,168,
+67,156,67,139,3,86,7,3,117,46,114,71,97,188,67,141,98,59,65,199,66,247,2,
+129,96,198,66,5,128,195,3,128,7,2,117,46,0,188,67,198,66,247,2,154,7,1,46,
+180,67,209,3,2,128,53,65,31,103,88,5,5,112,97,99,107,36,68,65,68,96,129,97,
+129,96,215,67,57,65,61,65,154,65,138,65,11,97,46,65,128,97,11,98,141,98,28,
+96,166,7,7,99,111,109,112,97,114,101,11,103,28,96,71,97,129,97,129,98,3,
+111,129,96,0,36,8,128,129,96,179,66,32,128,179,66,179,66,141,98,63,101,129,
+96,179,66,129,97,11,97,46,1,129,96,8,128,3,109,128,97,127,128,3,109,3,104,
+28,108,129,96,13,128,3,105,24,36,7,68,23,36,32,128,2,4,244,3,3,97,3,96,
+157,96,129,96,32,128,57,65,149,128,3,110,128,97,127,128,117,65,31,103,29,
+65,2,128,3,103,122,1,218,7,6,97,99,99,101,112,116,0,61,65,129,97,129,105,
+73,36,71,97,104,66,130,66,109,66,230,65,141,98,128,97,129,96,36,68,66,36,
+27,68,63,36,2,68,65,4,22,192,69,66,72,4,10,128,3,105,71,36,2,68,72,4,24,
+68,47,4,3,97,59,1,80,8,6,101,120,112,101,99,116,0,20,192,69,66,154,128,3,
+100,31,97,150,8,5,113,117,101,114,121,217,65,80,128,20,192,69,66,42,192,3,
+100,14,65,108,128,31,100,164,66,31,128,31,103,180,7,3,110,102,97,83,1,202,
+8,3,99,102,97,104,68,129,96,8,96,99,68,35,101,83,65,215,3,104,68,98,68,
+247,66,198,2,104,68,64,128,128,97,0,99,3,103,122,1,104,68,32,128,121,4,230,
+129,18,130,196,1,128,97,71,97,129,96,129,96,155,36,129,96,104,68,164,66,
+159,128,3,103,129,98,164,66,11,103,0,108,152,36,12,96,129,96,119,68,1,128,
+3,104,53,1,3,96,129,99,134,4,12,96,13,1,129,96,54,128,0,99,131,68,101,65,
+167,36,71,97,240,65,141,98,28,96,71,97,26,192,129,99,185,36,129,99,0,99,
+129,98,128,97,131,68,101,65,183,36,71,97,240,65,141,98,12,96,28,96,83,65,
+169,4,14,65,141,98,15,1,170,8,15,115,101,97,114,99,104,45,119,111,114,100,
+108,105,115,116,131,68,240,1,120,9,4,102,105,110,100,0,157,68,240,1,142,9,
+7,62,110,117,109,98,101,114,23,65,11,104,28,96,9,65,174,128,3,100,23,65,
+71,97,169,66,45,128,3,109,68,96,224,36,158,66,169,66,36,128,3,109,230,36,
+90,67,158,66,104,66,0,128,129,96,109,66,23,65,11,104,129,96,255,36,169,66,
+46,128,3,105,248,36,240,65,230,65,141,98,13,65,141,98,85,3,0,107,174,128,
+3,100,46,65,174,128,0,99,234,4,41,65,141,98,3,37,8,109,141,98,85,67,9,1,
+71,97,129,97,238,65,129,98,11,100,138,65,141,98,11,101,3,97,3,96,68,96,
+129,97,57,65,230,65,141,98,128,97,57,65,46,1,154,9,5,112,97,114,115,101,71,
+97,217,65,21,65,35,101,42,192,0,99,21,65,57,65,0,128,124,66,129,98,6,69,
+108,128,149,65,141,98,32,128,3,109,47,37,8,102,0,128,124,2,48,10,65,41,28,
+96,98,10,65,40,41,128,28,69,41,1,104,10,2,46,40,0,41,128,28,69,247,2,114,
+10,65,92,42,192,0,99,96,4,129,96,64,128,3,110,33,65,19,128,71,3,126,10,4,
+119,111,114,100,0,73,67,28,69,68,69,88,66,222,3,32,128,78,5,148,10,4,99,
+104,97,114,0,83,69,164,66,3,97,8,96,28,96,129,96,255,191,3,110,33,65,8,128,
+71,3,170,10,1,44,88,66,129,96,83,65,94,69,95,66,31,100,200,10,2,99,44,0,
+88,66,94,69,11,97,94,128,159,1,11,65,3,104,102,5,216,10,103,108,105,116,
+101,114,97,108,129,96,11,65,3,103,132,37,0,106,116,69,0,234,102,5,116,5,95,
+65,0,192,31,104,238,10,8,99,111,109,112,105,108,101,44,0,133,69,102,5,129,
+96,128,68,150,37,108,68,0,99,102,5,108,68,142,5,215,65,247,66,13,128,71,3,
+129,96,125,68,0,108,33,65,215,65,247,66,14,128,71,3,210,8,9,40,108,105,116,
+101,114,97,108,41,17,65,0,108,33,65,124,5,16,11,9,105,110,116,101,114,112,
+114,101,116,203,68,101,65,194,37,17,65,190,37,127,65,189,37,108,68,67,2,
+144,5,3,97,156,69,108,68,67,2,68,96,164,66,213,68,212,37,12,96,174,128,0,
+99,132,65,205,37,3,97,210,5,17,65,208,37,128,97,204,128,69,66,204,128,69,
+2,141,98,152,5,92,11,39,99,111,109,112,105,108,101,141,98,129,99,102,69,
+83,65,71,97,28,96,172,11,9,105,109,109,101,100,105,97,116,101,64,128,177,
+66,104,68,144,65,0,99,3,105,152,1,104,68,128,128,128,97,234,5,164,66,63,
+101,109,66,129,96,242,69,68,65,71,97,128,97,71,97,28,96,244,69,28,96,244,
+69,6,3,194,11,98,36,34,0,219,69,252,69,34,128,78,69,242,69,95,2,0,12,98,
+46,34,0,219,69,254,69,5,6,18,12,5,97,98,111,114,116,9,65,9,65,25,1,128,97,
+27,38,6,67,190,66,19,6,31,97,244,69,22,6,30,12,102,97,98,111,114,116,34,0,
+219,69,28,70,5,6,17,65,33,65,254,69,3,32,111,107,190,2,46,192,42,192,83,65,
+3,100,0,128,96,68,6,192,154,1,4,128,29,65,3,103,122,1,72,11,3,105,111,33,
+44,70,164,129,16,192,3,100,172,129,18,192,3,100,52,70,0,108,76,140,3,103,
+60,129,4,136,36,68,77,38,41,65,114,133,30,136,90,136,20,192,3,100,22,192,
+3,100,24,192,3,100,230,128,31,100,17,128,185,2,112,12,4,102,105,108,101,
+0,172,140,60,129,30,136,77,6,60,12,1,93,9,65,120,128,31,100,192,12,65,91,
+120,128,154,1,0,200,28,116,101,65,0,108,33,65,213,67,63,128,185,66,190,66,
+105,70,44,70,54,128,154,65,103,6,83,69,129,96,8,96,127,38,180,69,0,128,74,
+67,119,6,3,97,230,128,69,2,202,12,4,113,117,105,116,0,115,70,89,68,238,
+140,33,67,107,70,135,6,28,96,215,65,21,65,225,65,230,128,28,99,230,128,3,
+100,6,192,3,100,96,68,42,192,170,1,4,13,8,101,118,97,108,117,97,116,101,0,
+141,70,104,66,104,66,71,97,0,128,9,65,0,128,146,70,238,140,33,67,141,98,
+109,66,109,66,146,70,55,3,173,171,3,109,33,65,22,128,71,3,129,96,182,65,
+131,68,0,108,33,65,198,66,41,65,2,192,0,99,115,68,254,69,9,114,101,100,101,
+102,105,110,101,100,190,2,129,96,8,96,33,65,10,128,71,3,83,69,203,68,33,65,
+152,5,201,70,108,4,50,13,65,39,205,70,17,65,213,38,124,5,28,96,158,13,105,
+91,99,111,109,112,105,108,101,93,205,70,142,5,172,13,102,91,99,104,97,114,
+93,0,89,69,124,5,54,128,0,99,0,108,33,65,54,128,154,65,8,243,102,5,188,13,
+97,59,174,70,229,70,28,224,102,69,103,70,101,65,248,38,182,65,31,100,28,
+96,218,13,1,58,94,66,88,66,129,96,2,192,3,100,177,66,102,69,83,69,196,70,
+179,70,242,69,95,66,173,171,98,6,242,13,101,98,101,103,105,110,88,2,18,14,
+101,97,103,97,105,110,95,65,102,5,28,14,101,117,110,116,105,108,0,192,3,
+104,18,7,88,66,15,1,27,71,18,7,40,14,98,105,102,0,27,71,24,7,62,14,100,116,
+104,101,110,0,88,66,95,65,129,97,0,99,3,104,152,1,72,14,100,101,108,115,
+101,0,29,71,128,97,40,7,92,14,101,119,104,105,108,101,34,7,106,14,102,114,
+101,112,101,97,116,0,128,97,18,71,40,7,2,192,0,99,108,4,116,14,103,114,101,
+99,117,114,115,101,66,71,142,5,138,14,6,99,114,101,97,116,101,0,251,70,3,
+97,219,69,21,64,182,65,3,100,103,6,152,14,5,62,98,111,100,121,83,1,141,98,
+133,69,66,71,31,100,3,100,102,5,176,14,101,100,111,101,115,62,219,69,93,71,
+141,226,102,5,198,14,8,118,97,114,105,97,98,108,101,0,81,71,0,128,102,5,
+214,14,8,99,111,110,115,116,97,110,116,0,81,71,46,128,133,69,88,66,77,65,
+97,7,232,14,7,58,110,111,110,97,109,101,27,71,173,171,98,6,0,0,100,101,
+120,105,116,0,8,243,102,69,28,224,102,5,124,69,8,244,102,5,164,66,230,65,
+164,66,11,103,28,108,58,128,0,99,129,96,0,195,192,128,35,101,112,65,162,39,
+8,128,71,3,54,128,0,99,129,97,3,100,83,65,88,66,128,97,95,66,83,69,196,
+70,128,97,95,2,129,96,252,69,2,45,45,0,147,71,0,108,33,65,3,97,152,71,129,
+96,252,69,2,58,125,0,147,71,181,39,28,96,129,96,77,65,54,128,3,100,129,96,
+242,69,68,65,64,128,230,65,234,69,129,97,255,255,0,106,3,104,129,97,3,100,
+83,65,32,143,95,65,129,97,3,100,83,65,58,128,3,100,46,1,35,102,51,69,0,15,
+98,123,58,0,56,128,0,99,54,128,3,100,0,195,58,128,3,100,0,128,0,128,152,
+71,174,71,129,96,252,69,2,58,125,0,147,71,0,108,255,39,129,96,252,69,1,
+124,147,71,246,39,41,65,9,65,254,7,129,97,250,39,0,128,124,69,230,65,128,
+97,190,71,128,97,229,7,41,65,124,69,11,242,102,5,178,15,98,116,111,0,83,
+69,54,128,0,99,131,68,203,70,3,96,129,96,0,195,3,110,18,40,32,128,71,3,
+108,68,0,99,255,255,3,103,124,69,11,245,102,5,6,16,99,102,111,114,71,225,
+102,69,88,2,50,16,100,110,101,120,116,0,129,254,102,69,24,7,62,16,99,97,
+102,116,3,97,29,71,13,71,156,97,176,12,4,104,105,100,101,0,201,70,238,5,35,
+125,71,97,28,96,90,16,5,116,114,97,99,101,205,70,29,65,68,96,1,128,3,104,
+51,72,141,98,63,125,0,128,71,97,129,99,129,98,117,65,74,40,83,65,68,8,12,
+96,28,96,76,16,9,103,101,116,45,111,114,100,101,114,26,192,66,72,129,96,
+77,65,128,97,26,192,57,65,95,65,68,96,0,107,201,65,96,40,50,128,71,3,71,
+97,101,8,129,99,128,97,77,65,129,126,98,40,0,99,141,98,28,96,0,0,14,102,
+111,114,116,104,45,119,111,114,100,108,105,115,116,0,96,128,28,96,212,16,6,
+115,121,115,116,101,109,0,98,128,28,96,234,16,9,115,101,116,45,111,114,100,
+101,114,129,96,9,65,3,109,138,40,3,97,50,128,1,128,130,8,129,96,8,128,107,
+65,144,40,49,128,71,3,26,192,128,97,71,97,151,8,144,65,3,100,83,65,129,
+126,148,40,154,1,248,16,5,102,111,114,116,104,50,128,115,72,2,128,130,8,
+104,68,8,96,128,128,3,103,28,108,101,65,176,40,129,96,162,72,174,40,129,96,
+115,68,0,99,167,8,190,2,52,17,5,119,111,114,100,115,82,72,101,65,193,40,
+128,97,129,96,190,66,208,67,210,66,0,99,167,72,0,107,182,8,28,96,152,16,4,
+111,110,108,121,0,9,65,130,8,132,17,11,100,101,102,105,110,105,116,105,111,
+110,115,26,192,0,99,184,1,129,96,224,40,0,107,128,97,71,97,210,72,129,97,
+129,98,3,105,223,40,46,65,141,98,238,1,12,96,28,96,144,17,6,45,111,114,100,
+101,114,0,82,72,210,72,3,96,130,8,194,17,6,43,111,114,100,101,114,0,68,96,
+230,72,82,72,141,98,128,97,46,65,130,8,212,17,6,101,100,105,116,111,114,0,
+52,128,239,8,236,17,6,117,112,100,97,116,101,0,9,65,12,192,31,100,164,128,
+28,99,5,73,63,101,250,17,4,115,97,118,101,0,0,128,88,66,3,118,55,3,18,18,
+5,102,108,117,115,104,12,192,0,99,0,108,33,65,0,128,9,65,15,9,34,18,5,98,
+108,111,99,107,73,67,129,96,63,128,112,65,39,41,35,128,71,3,129,96,164,128,
+3,100,10,128,31,113,6,128,31,113,6,128,31,112,44,73,128,97,32,73,35,101,
+64,128,28,96,48,73,159,6,56,18,4,108,111,97,100,0,0,128,15,128,71,97,138,
+65,104,66,54,73,109,66,46,65,129,126,63,41,41,1,124,128,185,2,3,128,199,
+66,64,128,45,128,200,66,190,2,129,96,2,128,195,3,32,73,31,97,112,18,4,108,
+105,115,116,0,129,96,82,73,190,66,73,73,0,128,129,96,16,128,3,111,106,41,
+138,65,79,73,71,73,48,73,8,67,71,73,190,66,46,65,93,9,73,73,41,1,38,128,0,
+99,19,65,28,108,1,128,38,128,234,5,108,73,118,41,15,1,30,128,0,99,88,66,3,
+105,125,41,2,128,28,96,32,128,0,99,32,128,154,65,0,128,88,66,11,106,3,105,
+136,41,3,128,28,96,112,73,15,1,115,73,101,65,144,41,53,65,129,96,25,1,18,
+128,82,73,59,70,158,72,105,70,1,128,0,106,3,117,218,128,69,2,52,70,33,65,
+90,67,254,69,8,101,70,79,82,84,72,32,118,0,132,153,0,128,195,67,190,66,84,
+67,88,66,213,67,0,192,88,66,57,65,208,67,190,2,154,73,134,6,129,97,108,68,
+117,65,182,41,14,1,104,4,255,159,31,103,89,65,183,73,71,97,129,96,205,41,
+129,99,129,97,129,98,238,65,196,65,203,41,129,99,129,98,177,73,101,65,203,
+41,12,96,31,96,0,99,188,9,12,96,28,96,71,97,82,72,129,96,224,41,128,97,
+129,98,185,73,101,65,222,41,71,97,0,107,231,66,141,98,12,96,28,96,0,107,
+209,9,12,96,28,96,71,97,0,103,141,98,31,109,129,96,183,73,89,65,202,67,198,
+66,207,73,101,65,240,41,98,68,247,66,28,96,11,65,11,65,226,73,250,41,76,
+128,185,66,255,255,3,103,202,3,0,224,0,224,226,73,1,42,65,128,185,66,31,97,
+0,224,0,192,226,73,8,42,67,128,185,66,230,9,0,224,0,160,226,73,15,42,90,
+128,185,66,230,9,66,128,185,66,230,9,71,97,129,96,129,98,3,110,32,42,201,
+67,210,66,129,99,201,67,198,66,241,73,190,66,83,65,19,10,12,96,31,97,168,
+18,3,115,101,101,83,69,157,68,203,70,128,97,129,109,45,42,3,97,88,66,71,
+97,190,66,210,66,129,96,115,68,129,96,190,66,108,68,141,98,18,74,198,66,
+59,128,185,66,129,96,125,68,69,42,254,69,13,32,99,111,109,112,105,108,101,
+45,111,110,108,121,129,96,128,68,77,42,254,69,7,32,105,110,108,105,110,
+101,119,68,86,42,254,69,10,32,105,109,109,101,100,105,97,116,101,0,190,2,
+68,20,2,46,115,0,220,66,101,65,98,42,129,96,228,66,213,67,0,107,91,10,254,
+69,4,32,60,115,112,0,190,2,95,65,71,97,109,10,129,99,202,67,83,65,129,126,
+106,42,28,96,174,20,4,100,117,109,112,0,16,128,35,101,4,128,3,112,71,97,
+133,10,190,66,16,128,138,65,129,97,202,67,210,66,103,74,238,65,2,128,199,
+66,8,67,129,126,122,42,31,97,5,73,32,9,129,96,0,132,46,73,3,110,33,65,24,
+128,71,3,138,74,44,73,136,74,63,101,0,0,1,108,82,9,42,21,1,118,5,73,88,9,
+48,21,1,110,1,128,7,73,151,74,154,10,56,21,1,112,9,65,159,10,68,21,1,122,
+136,74,0,132,32,128,11,99,28,96,76,21,1,107,145,74,64,128,170,10,90,21,1,
+115,2,73,21,9,100,21,1,113,52,128,230,8,108,21,1,120,184,74,5,73,60,73,251,
+8,116,21,2,105,97,0,44,73,35,101,136,74,35,101,217,65,21,65,35,101,128,
+97,215,65,3,96,21,65,57,65,11,98,65,5,128,21,1,105,0,128,128,97,195,10,
 
 };
 
-const size_t embed_default_block_size =  5414;
+const size_t embed_default_block_size =  5548;
 
@@ -0,0 +1,469 @@
+/* Embed Forth Virtual Machine, x86-64 JIT compiler, Richard James Howe, MIT License
+ *
+ * Addresses that are jumped to often enough ('THRESHOLD' times) have the
+ * code starting at them translated into x86-64 machine code. A block follows
+ * branches and calls, and exits ('r->pc') from calls it has followed, for up
+ * to 'MAX_BLOCK' instructions. A conditional branch leaves the block only when
+ * it is taken, and an exit only if it does not return to where the call it
+ * was followed from would have. Instructions that do I/O, call
+ * back into the host, can throw or write to arbitrary memory are not
+ * translated, the block returns to the interpreter before them instead. The
+ * same is done if a stack pointer check fails so that the interpreter
+ * reports the error. Any write made by the interpreter or the host to a cell
+ * that is part of a compiled block throws away all compiled code, compiled
+ * code only writes to the stacks, which are assumed not to overlap it.
+ *
+ * Within a block the top of stack, return and variable stack pointers are
+ * kept in 'r8d', 'r10d' and 'r11d' and the program counter in 'r9d', always
+ * as zero extended 16-bit values. A block is called as a System V function
+ * with the registers in memory pointed to by 'rdi' and the core in 'rsi'. */
+#define _DEFAULT_SOURCE
+#include "jit.h"
+#include <assert.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__x86_64__) && (defined(__unix__) || defined(__APPLE__))
+
+#include <sys/mman.h>
+#include <time.h>
+
+#define THRESHOLD  (32u)          /**< jumps to an address before it is compiled */
+#define NEVER      (UINT16_MAX)   /**< 'count' of an address that cannot be compiled */
+#define MAX_BLOCK  (64u)          /**< maximum instructions in a block */
+#define MAX_CALLS  (16u)          /**< maximum depth of calls followed in a block */
+#define MAX_CODE   (MAX_BLOCK * 256u) /**< upper bound on machine code for one block */
+#define CODE_SIZE  (4uL << 20)    /**< size of code buffer */
+
+enum { EAX = 0, ECX = 1, EDX = 2, ESI = 6, EDI = 7, T = 8, PC = 9, RP = 10, SP = 11 };
+
+static inline uint64_t ticks(void) {
+	uint32_t lo = 0, hi = 0;
+	__asm__ __volatile__ ("rdtsc" : "=a"(lo), "=d"(hi));
+	return ((uint64_t)hi << 32) | lo;
+}
+
+static inline double seconds(void) {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+/* seconds per time stamp counter tick, measured the first time it is needed */
+static double tick_seconds(void) {
+	static double tick = 0.0;
+	if (tick == 0.0) {
+		const double s = seconds();
+		const uint64_t t = ticks();
+		while (seconds() - s < 0.005)
+			;
+		tick = (seconds() - s) / (double)(ticks() - t);
+	}
+	return tick;
+}
+
+static void emit(embed_jit_t *j, const uint8_t b) { assert(j->used < j->size); j->code[j->used++] = b; }
+
+static void emit32(embed_jit_t *j, const uint32_t v) {
+	for (unsigned i = 0; i < 32; i += 8)
+		emit(j, v >> i);
+}
+
+static void rex(embed_jit_t *j, const unsigned reg, const unsigned index, const unsigned base) {
+	const uint8_t r = 0x40 | ((reg > 7) << 2) | ((index > 7) << 1) | (base > 7);
+	if (r != 0x40)
+		emit(j, r);
+}
+
+/* 'op r/m32, reg32' or, with a 0x0F prefix, 'op reg32, r/m32' */
+static void rr(embed_jit_t *j, const uint8_t op, const unsigned reg, const unsigned rm) {
+	rex(j, reg, 0, rm);
+	emit(j, op);
+	emit(j, 0xC0 | (reg & 7) << 3 | (rm & 7));
+}
+
+static void rr2(embed_jit_t *j, const uint8_t op, const unsigned reg, const unsigned rm) {
+	rex(j, reg, 0, rm);
+	emit(j, 0x0F);
+	emit(j, op);
+	emit(j, 0xC0 | (reg & 7) << 3 | (rm & 7));
+}
+
+static void mov(embed_jit_t *j, const unsigned dst, const unsigned src) { rr(j, 0x89, src, dst); }
+
+static void mov_imm(embed_jit_t *j, const unsigned dst, const uint32_t imm) {
+	rex(j, 0, 0, dst);
+	emit(j, 0xB8 | (dst & 7));
+	emit32(j, imm);
+}
+
+static void mask(embed_jit_t *j, const unsigned reg) { rr2(j, 0xB7, reg, reg); } /* movzx reg32, reg16 */
+
+/* 'unary' group, 'F7 /n' for 'not' (2) and 'neg' (3), 'FF /n' for 'inc' (0) and 'dec' (1) */
+static void group(embed_jit_t *j, const uint8_t op, const unsigned n, const unsigned reg) {
+	rex(j, 0, 0, reg);
+	emit(j, op);
+	emit(j, 0xC0 | n << 3 | (reg & 7));
+}
+
+static void shift1(embed_jit_t *j, const unsigned n, const unsigned reg) { group(j, 0xD1, n, reg); } /* shl (4) or shr (5) by one */
+
+/* movzx dst, word [rsi + index*2] */
+static void load(embed_jit_t *j, const unsigned dst, const unsigned index) {
+	rex(j, dst, index, ESI);
+	emit(j, 0x0F);
+	emit(j, 0xB7);
+	emit(j, 0x04 | (dst & 7) << 3);
+	emit(j, 0x40 | (index & 7) << 3 | ESI);
+}
+
+/* mov word [rsi + index*2], src */
+static void store(embed_jit_t *j, const unsigned index, const unsigned src) {
+	emit(j, 0x66);
+	rex(j, src, index, ESI);
+	emit(j, 0x89);
+	emit(j, 0x04 | (src & 7) << 3);
+	emit(j, 0x40 | (index & 7) << 3 | ESI);
+}
+
+/* 'dst' = -(condition), 'cc' is the condition code for 'setcc', flags must be set */
+static void set(embed_jit_t *j, const unsigned dst, const uint8_t cc) {
+	mov_imm(j, dst, 0); /* does not change the flags, unlike 'xor' */
+	rex(j, 0, 0, dst);
+	emit(j, 0x0F);
+	emit(j, 0x90 | cc);
+	emit(j, 0xC0 | (dst & 7));
+	group(j, 0xF7, 3, dst);
+	mask(j, dst);
+}
+
+/* store the registers back and return 'bail' from the block, if 'pc' is
+ * negative the program counter is in register 'PC' */
+static void leave(embed_jit_t *j, const long pc, const int bail) {
+	if (pc < 0) { /* mov [rdi], r9d */
+		rex(j, PC, 0, EDI);
+		emit(j, 0x89);
+		emit(j, (PC & 7) << 3 | EDI);
+	} else {
+		emit(j, 0xC7); /* mov dword [rdi], imm32 */
+		emit(j, 0x07);
+		emit32(j, pc);
+	}
+	static const unsigned regs[] = { T, RP, SP };
+	for (unsigned i = 0; i < 3; i++) { /* mov [rdi + 4*(i+1)], reg */
+		rex(j, regs[i], 0, EDI);
+		emit(j, 0x89);
+		emit(j, 0x40 | (regs[i] & 7) << 3 | EDI);
+		emit(j, 4 * (i + 1));
+	}
+	mov_imm(j, EAX, bail);
+	emit(j, 0xC3); /* ret */
+}
+
+/* Return to the interpreter, before the instruction at 'pc', if either stack
+ * pointer is out of bounds, the interpreter will then raise the error. */
+static void check(embed_jit_t *j, const cell_t pc) {
+	mov(j, EAX, SP);
+	rr(j, 0x09, RP, EAX); /* or eax, r10d */
+	emit(j, 0xA9); /* test eax, imm32 */
+	emit32(j, 0x8000);
+	emit(j, 0x74); /* jz rel8 */
+	const size_t patch = j->used;
+	emit(j, 0);
+	leave(j, pc, 1);
+	j->code[patch] = j->used - patch - 1;
+}
+
+/* see 'vm_operation' in 'embed.c', a return stack delta of -2 selects
+ * operations 32 to 63 */
+static unsigned operation(const cell_t instruction) {
+	return ((instruction >> 8) & 0x1F) | (((instruction & 0xC) == 0x8) << 5);
+}
+
+static int compilable(const cell_t instruction) {
+	if ((instruction & 0xE000) != 0x6000)
+		return 1;
+	const unsigned op = operation(instruction);
+	return (op <= 21 && op != 4) || op == 30 || op == 31 || op == 32;
+}
+
+/* forward jump with an 8-bit displacement, 'op' is 'jcc' or 'jmp', patched by 'here' */
+static size_t forward(embed_jit_t *j, const uint8_t op) {
+	emit(j, op);
+	emit(j, 0);
+	return j->used - 1;
+}
+
+static void here(embed_jit_t *j, const size_t patch) {
+	assert(j->used - patch - 1 < 0x80);
+	j->code[patch] = j->used - patch - 1;
+}
+
+static void alu(embed_jit_t *j, const cell_t instruction) {
+	static const int delta[] = { 0, 1, -2, -1 }, rdelta[] = { 0, 1, 0, -1 };
+	const unsigned op = operation(instruction);
+	load(j, ECX, SP); /* n */
+	if (instruction & 0x10) { /* r->pc */
+		load(j, PC, RP);
+		shift1(j, 5, PC);
+	}
+	switch (op) { /* T into 'edx' */
+	case  0: mov(j, EDX, T); break;
+	case  1: mov(j, EDX, ECX); break;
+	case  2: load(j, EDX, RP); break;
+	case  3: mov(j, EAX, T); shift1(j, 5, EAX); load(j, EDX, EAX); break;
+	case  5: /* fall through */
+	case  6:
+		mov(j, EAX, T);
+		if (op == 5)
+			rr(j, 0x01, ECX, EAX); /* add eax, ecx */
+		else
+			rr2(j, 0xAF, EAX, ECX); /* imul eax, ecx */
+		mov(j, EDX, EAX);
+		emit(j, 0xC1); emit(j, 0xEA); emit(j, 16); /* shr edx, 16 */
+		store(j, SP, EAX);
+		mov(j, ECX, EAX);
+		mask(j, ECX);
+		break;
+	case  7: mov(j, EDX, T); rr(j, 0x21, ECX, EDX); break; /* and */
+	case  8: mov(j, EDX, T); rr(j, 0x09, ECX, EDX); break; /* or */
+	case  9: mov(j, EDX, T); rr(j, 0x31, ECX, EDX); break; /* xor */
+	case 10: mov(j, EDX, T); group(j, 0xF7, 2, EDX); mask(j, EDX); break; /* not */
+	case 11: mov(j, EDX, T); group(j, 0xFF, 1, EDX); mask(j, EDX); break; /* dec */
+	case 12: rr(j, 0x85, T, T); set(j, EDX, 0x4); break; /* test, sete */
+	case 13: rr(j, 0x39, T, ECX); set(j, EDX, 0x4); break; /* cmp ecx, r8d; sete */
+	case 14: rr(j, 0x39, T, ECX); set(j, EDX, 0x2); break; /* cmp ecx, r8d; setb */
+	case 15: emit(j, 0x66); rr(j, 0x39, T, ECX); set(j, EDX, 0xC); break; /* cmp cx, r8w; setl */
+	case 16: /* fall through */
+	case 17: /* the shift count is masked to 5 bits, as it is for the interpreter */
+		mov(j, EDX, ECX);
+		mov(j, ECX, T);
+		group(j, 0xD3, op == 16 ? 5 : 4, EDX); /* shr/shl edx, cl */
+		mask(j, EDX);
+		load(j, ECX, SP);
+		break;
+	case 18: mov(j, EDX, SP); shift1(j, 4, EDX); mask(j, EDX); break;
+	case 19: mov(j, EDX, RP); shift1(j, 4, EDX); mask(j, EDX); break;
+	case 20: mov(j, SP, T); shift1(j, 5, SP); mov(j, EDX, T); break;
+	case 21: mov(j, RP, T); shift1(j, 5, RP); mov(j, EDX, ECX); break;
+	case 30: { /* next: decrement the loop counter, or drop it if it is zero */
+		load(j, EAX, RP);
+		rr(j, 0x85, EAX, EAX); /* test eax, eax */
+		const size_t zero = forward(j, 0x74); /* jz */
+		group(j, 0xFF, 1, EAX);
+		store(j, RP, EAX);
+		mov_imm(j, EDX, 0);
+		const size_t end = forward(j, 0xEB); /* jmp */
+		here(j, zero);
+		group(j, 0xFF, 0, RP);
+		mask(j, RP);
+		mov_imm(j, EDX, 0xFFFF);
+		here(j, end);
+		break;
+	}
+	case 31: /* +loop: 'eax' is the index minus the limit, 'edx' the index */
+		mov(j, EAX, RP);
+		group(j, 0xFF, 0, EAX);
+		emit(j, 0x25); emit32(j, EMBED_CORE_SIZE - 1); /* and eax, imm32 */
+		load(j, EAX, EAX);
+		load(j, EDX, RP);
+		rr(j, 0x29, EAX, EDX); /* sub edx, eax */
+		mov(j, EAX, EDX);
+		load(j, EDX, RP);
+		rr(j, 0x01, T, EDX); /* add edx, r8d */
+		store(j, RP, EDX);
+		mov(j, EDX, EAX);
+		rr(j, 0x01, T, EDX);   /* edx = d + t */
+		rr(j, 0x31, EAX, EDX); /* edx = d ^ (d + t) */
+		rr(j, 0x31, T, EAX);   /* eax = d ^ t */
+		rr(j, 0x21, EAX, EDX);
+		emit(j, 0xF7); emit(j, 0xC2); emit32(j, 0x8000); /* test edx, 0x8000 */
+		set(j, EDX, 0x5); /* setnz */
+		break;
+	case 32: /* c@, the core is little endian and a byte address indexes it directly */
+		mov(j, EAX, T);
+		emit(j, 0x0F); emit(j, 0xB6); emit(j, 0x04 | EDX << 3); emit(j, EAX << 3 | ESI); /* movzx edx, byte [rsi + rax] */
+		break;
+	default: assert(0);
+	}
+	const int dd = delta[instruction & 3], rd = rdelta[(instruction >> 2) & 3];
+	if (dd) {
+		group(j, 0xFF, dd > 0 ? 0 : 1, SP);
+		if (dd == -2)
+			group(j, 0xFF, 1, SP);
+		mask(j, SP);
+	}
+	if (rd) {
+		group(j, 0xFF, rd > 0 ? 1 : 0, RP);
+		mask(j, RP);
+	}
+	if (instruction & 0x80)
+		store(j, SP, T);
+	if (instruction & 0x40)
+		store(j, RP, T);
+	mov(j, T, (instruction & 0x20) ? ECX : EDX);
+}
+
+static jit_block_t compile(embed_jit_t *j, const cell_t *core, const cell_t start) {
+	if (!compilable(core[start]))
+		return NULL;
+	if (j->size - j->used < MAX_CODE)
+		embed_jit_flush(j);
+	jit_block_t block = (jit_block_t)(uintptr_t)(j->code + j->used);
+	for (unsigned i = 0; i < 3; i++) { /* mov reg, [rdi + 4*(i+1)] */
+		static const unsigned regs[] = { T, RP, SP };
+		rex(j, regs[i], 0, EDI);
+		emit(j, 0x8B);
+		emit(j, 0x40 | (regs[i] & 7) << 3 | EDI);
+		emit(j, 4 * (i + 1));
+	}
+	static const int rdelta[] = { 0, 1, 0, -1 };
+	struct { cell_t pc; int rdepth; } calls[MAX_CALLS]; /* calls followed, and return stack depth after them */
+	cell_t pc = start;
+	int rdepth = 0;
+	for (unsigned n = 0, depth = 0; ; n++) {
+		const cell_t instruction = core[pc];
+		if (n == MAX_BLOCK || pc >= (EMBED_CORE_SIZE - 1) || !compilable(instruction)) {
+			leave(j, pc, 1);
+			break;
+		}
+		j->covered[pc] = 1;
+		j->stats.instructions++;
+		check(j, pc);
+		if (instruction & 0x8000) { /* literal */
+			group(j, 0xFF, 0, SP);
+			mask(j, SP);
+			store(j, SP, T);
+			mov_imm(j, T, instruction & 0x7FFF);
+			pc++;
+		} else if ((instruction & 0xE000) == 0x6000) { /* ALU */
+			alu(j, instruction);
+			const int returns = depth && calls[depth - 1].rdepth == rdepth;
+			rdepth += rdelta[(instruction >> 2) & 3];
+			if (operation(instruction) == 21) /* rp!, return addresses are unknown */
+				depth = 0;
+			if (operation(instruction) == 30) /* next, the counter is dropped if the loop is left */
+				rdepth--;
+			if (!(instruction & 0x10)) {
+				pc++;
+				continue;
+			}
+			if (!returns) {
+				leave(j, -1, 0);
+				break;
+			}
+			pc = calls[--depth].pc; /* leave unless returning to the call followed */
+			rex(j, 0, 0, PC);
+			emit(j, 0x81); /* cmp r9d, imm32 */
+			emit(j, 0xF8 | (PC & 7));
+			emit32(j, pc);
+			emit(j, 0x74); /* jz rel8 */
+			const size_t patch = j->used;
+			emit(j, 0);
+			leave(j, -1, 0);
+			j->code[patch] = j->used - patch - 1;
+		} else if (instruction & 0x4000) { /* call */
+			group(j, 0xFF, 1, RP);
+			mask(j, RP);
+			mov_imm(j, EAX, (cell_t)(pc + 1) << 1);
+			store(j, RP, EAX);
+			if (depth == MAX_CALLS) {
+				leave(j, instruction & 0x1FFF, 0);
+				break;
+			}
+			calls[depth].pc = pc + 1;
+			calls[depth++].rdepth = ++rdepth;
+			pc = instruction & 0x1FFF;
+		} else if (instruction & 0x2000) { /* 0branch, leave the block if taken */
+			mov(j, EAX, T);
+			load(j, T, SP);
+			group(j, 0xFF, 1, SP);
+			mask(j, SP);
+			rr(j, 0x85, EAX, EAX); /* test eax, eax */
+			emit(j, 0x75); /* jnz rel8 */
+			const size_t patch = j->used;
+			emit(j, 0);
+			leave(j, instruction & 0x1FFF, 0);
+			j->code[patch] = j->used - patch - 1;
+			pc++;
+		} else { /* branch */
+			pc = instruction & 0x1FFF;
+		}
+	}
+	j->stats.blocks++;
+	return j->entry[start] = block;
+}
+
+void embed_jit_run(embed_jit_t *j, cell_t *core, cell_t regs[4]) {
+	assert(j && core && regs);
+	uint32_t r[4] = { regs[0], regs[1], regs[2], regs[3] };
+	uint64_t start = 0;
+	for (;;) {
+		const cell_t pc = r[0] % EMBED_CORE_SIZE;
+		jit_block_t block = j->entry[pc];
+		if (!block) {
+			if (j->count[pc] == NEVER || ++j->count[pc] < THRESHOLD)
+				break;
+			if (!(block = compile(j, core, pc))) {
+				j->count[pc] = NEVER;
+				break;
+			}
+		}
+		j->stats.entries++;
+		if (!start)
+			start = ticks();
+		if (block(r, core))
+			break;
+	}
+	if (start)
+		j->ticks += ticks() - start;
+	regs[0] = r[0], regs[1] = r[1], regs[2] = r[2], regs[3] = r[3];
+}
+
+void embed_jit_flush(embed_jit_t *j) {
+	assert(j);
+	memset(j->entry,   0, sizeof(j->entry));
+	memset(j->count,   0, sizeof(j->count));
+	memset(j->covered, 0, sizeof(j->covered));
+	j->used = 0;
+	j->stats.flushes++;
+}
+
+embed_jit_t *embed_jit_new(void) {
+	embed_jit_t *j = calloc(1, sizeof(*j));
+	if (!j)
+		return NULL;
+	void *code = mmap(NULL, CODE_SIZE, PROT_READ | PROT_WRITE | PROT_EXEC, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if (code == MAP_FAILED) {
+		free(j);
+		return NULL;
+	}
+	j->code = code;
+	j->size = CODE_SIZE;
+	return j;
+}
+
+void embed_jit_free(embed_jit_t *j) {
+	if (!j)
+		return;
+	munmap(j->code, j->size);
+	free(j);
+}
+
+embed_jit_stats_t embed_jit_stats(const embed_jit_t *j) {
+	assert(j);
+	embed_jit_stats_t s = j->stats;
+	s.seconds = j->ticks ? j->ticks * tick_seconds() : 0.0;
+	return s;
+}
+
+#else /* no JIT on this platform */
+
+void embed_jit_run(embed_jit_t *j, cell_t *core, cell_t regs[4]) { (void)j; (void)core; (void)regs; }
+void embed_jit_flush(embed_jit_t *j)                              { (void)j; }
+embed_jit_t *embed_jit_new(void)                                  { return NULL; }
+void embed_jit_free(embed_jit_t *j)                               { (void)j; }
+embed_jit_stats_t embed_jit_stats(const embed_jit_t *j)           { assert(j); return j->stats; }
+
+#endif
@@ -0,0 +1,52 @@
+/** @file      jit.h
+ *  @brief     Embed Virtual Machine x86-64 JIT compiler, internal interface
+ *  @copyright Richard James Howe (2017,2018)
+ *  @license   MIT
+ *
+ * This header is shared between 'embed.c' and 'jit.c' and is not part of
+ * the library interface, see 'embed_jit_new' in 'embed.h' for that. */
+#ifndef JIT_H
+#define JIT_H
+
+#include "embed.h"
+#include <stdint.h>
+
+/**@brief compiled basic block, 'regs' contains the program counter, top of
+ * stack, return and variable stack pointers, in that order, the block
+ * returns non-zero if the interpreter must execute the next instruction */
+typedef int (*jit_block_t)(uint32_t *regs, cell_t *core);
+
+struct embed_jit_t {
+	jit_block_t entry[EMBED_CORE_SIZE];   /**< compiled block starting at an address, or NULL */
+	uint16_t    count[EMBED_CORE_SIZE];   /**< number of times an address has been jumped to */
+	uint8_t     covered[EMBED_CORE_SIZE]; /**< cell is part of a compiled block */
+	uint8_t    *code;                     /**< executable code buffer */
+	size_t      size, used;               /**< size of, and bytes used in, 'code' */
+	uint64_t    ticks;                    /**< time stamp counter ticks spent in compiled code */
+	embed_jit_stats_t stats;              /**< statistics, see 'embed_jit_stats' */
+};
+
+/**@brief Run compiled code starting at 'regs[0]', compiling it first if it
+ * has become hot enough, following compiled blocks into each other until
+ * one of them exits to the interpreter or there is no compiled code for the
+ * next address.
+ * @param j,    JIT state
+ * @param core, virtual machine memory, EMBED_CORE_SIZE cells long
+ * @param regs, program counter, top of stack, return and variable stack
+ * pointers, in that order, which are updated */
+void embed_jit_run(embed_jit_t *j, cell_t *core, cell_t regs[4]);
+
+/**@brief Throw away all compiled code
+ * @param j, JIT state */
+void embed_jit_flush(embed_jit_t *j);
+
+/**@brief Throw away compiled code if 'addr' is part of it, this must be
+ * called whenever the core is written to.
+ * @param j,    JIT state
+ * @param addr, address written to */
+static inline void embed_jit_invalidate(embed_jit_t *j, const cell_t addr) {
+	if (j->covered[addr % EMBED_CORE_SIZE])
+		embed_jit_flush(j);
+}
+
+#endif
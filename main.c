@@ -39,7 +39,7 @@ static int run_file(embed_t *h, embed_vm_option_e opt, bool load, char *in_file,
 }
 
 static const char *help ="\
-usage: ./embed [-hqtTa-] -i in.blk -o out.blk file.fth...\n\n\
+usage: ./embed [-hqtTjna-] -i in.blk -o out.blk file.fth...\n\n\
 Program: Embed Virtual Machine and eForth Image\n\
 Author:  Richard James Howe\n\
 License: MIT\n\
@@ -53,6 +53,8 @@ Options:\n\
 \t-I file.fth set input file\n\
 \t-O file.txt set output file\n\
 \t-T          run built in self tests\n\
+\t-j          compile hot code to machine code, if supported\n\
+\t-n          run some words of the built in image in C, not in Forth\n\
 \t-a          read from stdin/file specified by '-I' after files\n\
 \t--          stop processing command arguments\n\
 \tfile.fth    read from 'file.fth'\n\n\
@@ -73,11 +75,13 @@ int main(int argc, char **argv) {
 	binary(stderr);
 
 	static cell_t m[EMBED_CORE_SIZE] = { 0 };
-	static embed_t h = { .m = m };
+	static embed_fpu_t fpu = { .depth = 0 };
+	static embed_natives_t natives = { .count = 0 };
+	static embed_t h = { .m = m, .fpu = &fpu };
 	if (embed_default_hosted(&h) < 0)
 		embed_fatal("embed: load failed\n");
 
-	while ((ch = embed_getopt(&go, argc, argv, "hqtTi:o:I:O:a")) != -1) {
+	while ((ch = embed_getopt(&go, argc, argv, "hqtTjni:o:I:O:a")) != -1) {
 		switch (ch) {
 		case 'h': fputs(help, stdout); return 0;
 		case 'i': iblk = go.arg; break;
@@ -87,11 +91,16 @@ int main(int argc, char **argv) {
 		case 'O': if (out != stdout) { fclose(out); } out = embed_fopen_or_die(go.arg, "wb"); break;
 		case 'I': if (in  != stdin)  { fclose(in); }  in  = embed_fopen_or_die(go.arg, "rb"); break;
 		case 'T': return embed_tests();
+		case 'j': if (!h.jit && !(h.jit = embed_jit_new())) { embed_error("embed: JIT not supported"); } break;
+		case 'n': h.natives = &natives; break;
 		case 'a': terminal = true; break;
 		default: fputs(help, stdout); return 1;
 		}
 	}
 
+	if (h.natives && embed_native_default(h.natives) < 0)
+		embed_fatal("embed: native overrides not found in built in image");
+
 	for (int i = go.index; i < argc; i++) {
 		if ((r = run_file(&h, option | EMBED_VM_QUITE_ON, !ran, argv[i], out, iblk, oblk)) < 0)
 			break;
@@ -102,6 +111,7 @@ int main(int argc, char **argv) {
 		r = run(&h, option, !ran, in, out, iblk, oblk);
 	fclose(in);
 	fclose(out);
+	embed_jit_free(h.jit);
 	return r;
 }
 
@@ -0,0 +1,41 @@
+/* Superinstructions: pairs of instructions at consecutive addresses that are
+ * fused into a single instruction when they are decoded into the instruction
+ * cache, 'X(FIRST, SECOND)'. This file is generated from an instruction
+ * profile of the meta-compiler and unit tests with 'make super', do not edit
+ * it by hand. */
+#ifndef EMBED_SUPER
+#define EMBED_SUPER(X)\
+	X(VM_ALU + 0 , VM_CALL    ) /* t call                6352082 */\
+	X(VM_LITERAL , VM_ALU + 5 ) /* literal t+n           6077784 */\
+	X(VM_ALU + 0 , VM_ZBRANCH ) /* t 0branch             4465174 */\
+	X(VM_ALU + 1 , VM_BRANCH  ) /* n branch              2113662 */\
+	X(VM_ALU + 1 , VM_CALL    ) /* n call                2024302 */\
+	X(VM_LITERAL , VM_ALU + 7 ) /* literal t&n           1978035 */\
+	X(VM_ALU + 12, VM_ZBRANCH ) /* t==0 0branch          1945357 */\
+	X(VM_ALU + 2 , VM_CALL    ) /* r call                1920169 */\
+	X(VM_ALU + 3 , VM_BRANCH  ) /* [t] branch            1737321 */\
+	X(VM_LITERAL , VM_CALL    ) /* literal call           458185 */\
+	X(VM_ALU + 3 , VM_CALL    ) /* [t] call               414744 */\
+	X(VM_ALU + 9 , VM_ZBRANCH ) /* t^n 0branch            393664 */\
+	X(VM_ALU + 30, VM_ZBRANCH ) /* next 0branch           307885 */\
+	X(VM_ALU + 7 , VM_BRANCH  ) /* t&n branch             212421 */\
+	X(VM_LITERAL , VM_ALU + 10) /* literal ~t             202940 */\
+	X(VM_LITERAL , VM_ALU + 9 ) /* literal t^n            194301 */\
+	X(VM_LITERAL , VM_ALU + 29) /* literal cpu            194280 */\
+	X(VM_ALU + 2 , VM_LITERAL ) /* r literal              155082 */\
+	X(VM_LITERAL , VM_ALU + 17) /* literal n<<t           145180 */\
+	X(VM_LITERAL , VM_ALU + 3 ) /* literal [t]            119120 */\
+	X(VM_LITERAL , VM_ALU + 13) /* literal t==n           117088 */\
+	X(VM_ALU + 15, VM_ZBRANCH ) /* n<t 0branch            104007 */\
+	X(VM_ALU + 13, VM_LITERAL ) /* t==n literal            96294 */\
+	X(VM_ALU + 1 , VM_LITERAL ) /* n literal               83859 */\
+	X(VM_ALU + 0 , VM_LITERAL ) /* t literal               73121 */\
+	X(VM_LITERAL , VM_ALU + 16) /* literal n>>t            64368 */\
+	X(VM_ALU + 0 , VM_BRANCH  ) /* t branch                44643 */\
+	X(VM_LITERAL , VM_ALU + 0 ) /* literal t               38123 */\
+	X(VM_ALU + 2 , VM_BRANCH  ) /* r branch                37811 */\
+	X(VM_LITERAL , VM_ALU + 4 ) /* literal n->[t]          30061 */\
+	X(VM_ALU + 15, VM_CALL    ) /* n<t call                28592 */\
+	X(VM_LITERAL , VM_ALU + 1 ) /* literal n               27260 */\
+
+#endif
@@ -0,0 +1,307 @@
+/**@brief Embed ahead of time image to C translator
+ * @license MIT
+ * @author Richard James Howe
+ * @file aot.c
+ *
+ * See <https://github.com/howerj/embed> for more information.
+ *
+ * Where 'b2c.fth' turns an image into a C byte array for the library to
+ * interpret, this program turns the code in an image into C that executes
+ * it directly, as a function with the same interface as 'embed_vm':
+ *
+ *	./aot embed-1.blk aot.gen.c
+ *
+ * generates 'int embed_aot_vm(embed_t *h)', see 't/aotrun.c' for a program
+ * that uses it. Every cell reachable from the entry points of the image is
+ * given a label and the C code for the instruction in it, the entry points
+ * being the program counter, the trap handler and every cell an execution
+ * token or return address in the image could point to. Branches and calls
+ * become a 'goto' and anything that sets the program counter from the stacks
+ * ('exit', '>r' tricks, 'execute') goes through a 'switch' on it.
+ *
+ * Each translated instruction checks it is still the instruction it was
+ * translated from, and that the stack pointers are in bounds, before it is
+ * run. If it is not, if the program counter is not a translated cell (such
+ * as code the dictionary compiles at run time), if the instruction does
+ * I/O or calls back into the host, or if it would throw, a single
+ * instruction is run by the interpreter instead and the translated code is
+ * entered again afterwards. The decoded instruction cache and the JIT are
+ * only flushed before that if the translated code has stored to memory, as
+ * with the JIT the stacks are assumed not to overlap code. The translated
+ * code is only used with the default MMU and yield callbacks, without
+ * tracing, like the specialized loops in 'embed.c'. */
+
+#include "embed.h"
+#include "util.h"
+#include <assert.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+static cell_t core[EMBED_CORE_SIZE];
+static bool reachable[EMBED_CORE_SIZE];
+
+static size_t image(const char *name) {
+	FILE *in = embed_fopen_or_die(name, "rb");
+	size_t cells = 0;
+	for (int lo = 0, hi = 0; cells < EMBED_CORE_SIZE && (lo = fgetc(in)) != EOF && (hi = fgetc(in)) != EOF; cells++)
+		core[cells] = lo | (hi << 8);
+	fclose(in);
+	return cells;
+}
+
+static void reach(cell_t *work, size_t *n, size_t cells, size_t addr) {
+	if (addr < cells && addr < (EMBED_CORE_SIZE - 1) && !reachable[addr]) {
+		reachable[addr] = true;
+		work[(*n)++] = addr;
+	}
+}
+
+static size_t reachability(size_t cells) {
+	static cell_t work[EMBED_CORE_SIZE];
+	size_t n = 0, translated = 0;
+	reach(work, &n, cells, core[0]);
+	reach(work, &n, cells, core[7]); /* shadow program counter, used by 'embed_reset' */
+	reach(work, &n, cells, 4);       /* trap handler */
+	for (size_t i = 0; i < cells; i++)
+		if (!(core[i] & 1))
+			reach(work, &n, cells, core[i] >> 1);
+	while (n) {
+		const cell_t addr = work[--n], instruction = core[addr];
+		translated++;
+		if (instruction & 0x8000) {
+			reach(work, &n, cells, addr + 1);
+		} else if ((instruction & 0xE000) == 0x6000) {
+			if (!(instruction & 0x10))
+				reach(work, &n, cells, addr + 1);
+		} else if (instruction & 0x4000) {
+			reach(work, &n, cells, instruction & 0x1FFF);
+			reach(work, &n, cells, addr + 1);
+		} else if (instruction & 0x2000) {
+			reach(work, &n, cells, instruction & 0x1FFF);
+			reach(work, &n, cells, addr + 1);
+		} else {
+			reach(work, &n, cells, instruction & 0x1FFF);
+		}
+	}
+	return translated;
+}
+
+static void jump(FILE *out, unsigned target) {
+	if (target < EMBED_CORE_SIZE && reachable[target])
+		fprintf(out, " goto L%04X;", target);
+	else
+		fprintf(out, " pc = 0x%04X; goto dispatch;", target);
+}
+
+static const char *alu(unsigned operation) {
+	static const char *codes[] = {
+		"T = t;",
+		"T = n;",
+		"T = core[rp];",
+		"T = core[(t>>1)%L];",
+		"core[(t>>1)%L] = n; T = core[--sp]; dirty = 1;",
+		"d = (d_t)t + n; T = d >> 16; core[sp] = d; n = d;",
+		"d = (d_t)t * n; T = d >> 16; core[sp] = d; n = d;",
+		"T = t&n;",
+		"T = t|n;",
+		"T = t^n;",
+		"T = ~t;",
+		"T = t-1;",
+		"T = -(t == 0);",
+		"T = -(t == n);",
+		"T = -(n < t);",
+		"T = -((s_t)n < (s_t)t);",
+		"T = n >> t;",
+		"T = n << t;",
+		"T = sp << 1;",
+		"T = rp << 1;",
+		"sp = t >> 1;",
+		"rp = t >> 1; T = n;",
+		NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, /* I/O, calls to host, ... */
+		"if ((T = core[rp])) { core[rp] = T - 1; T = 0; } else { rp++; T = -1; }",
+		"d = (m_t)(core[rp] - core[(rp + 1) % L]); core[rp] += t; T = -!!((d ^ (d + t)) & (d ^ t) & 0x8000);",
+		"T = (core[t >> 1] >> ((t & 1) << 3)) & 0xFF;",
+		"core[t >> 1] = (core[t >> 1] & (0xFF00 >> ((t & 1) << 3))) | ((n & 0xFF) << ((t & 1) << 3)); T = core[--sp]; dirty = 1;",
+		NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, /* bulk memory, strings and numbers */
+		"T = embed_crc(h, n, t);",
+		"d = (((d_t)S(1) << 16) | S(2)) + (((d_t)t << 16) | n); S(2) = d; T = d >> 16;",
+		"d = (((d_t)S(1) << 16) | S(2)) - (((d_t)t << 16) | n); S(2) = d; T = d >> 16;",
+		"d = 0u - (((d_t)t << 16) | n); core[sp] = d; T = d >> 16;",
+		"T = -((sd_t)(((d_t)S(1) << 16) | S(2)) < (sd_t)(((d_t)t << 16) | n)); sp -= 2;",
+		"d = (sd_t)(s_t)n * (s_t)t; core[sp] = d; T = d >> 16;",
+		"{ s_t r_ = 0; T = aot_floored(((d_t)n << 16) | S(1), t, &r_); S(1) = r_; }",
+		NULL, /* floating point unit */
+		"core[--rp] = core[6]; core[6] = rp; for (m_t i_ = t; i_; i_--) { core[--rp] = S(i_ - 1); } sp -= t; T = core[sp];",
+		"rp = core[6] % L; core[6] = core[rp]; rp++;",
+		"T = core[(m_t)(core[6] - 1 - t) % L];",
+		"core[(m_t)(core[6] - 1 - t) % L] = n; T = core[--sp];",
+	};
+	assert(operation < 64);
+	return operation < (sizeof(codes) / sizeof(codes[0])) ? codes[operation] : NULL;
+}
+
+/* Conditions under which an operation from 'alu' does not throw, when they
+ * do not hold the interpreter runs it instead so that it throws */
+static const char *precondition(unsigned operation) {
+	switch (operation) {
+	case 48: return "t";                 /* division by zero */
+	case 50: return "t <= sp && t < rp"; /* frame larger than the stacks */
+	}
+	return NULL;
+}
+
+static void translate(FILE *out, unsigned addr) {
+	static const char *deltas[] = { "", " sp++;", " sp -= 2;", " sp--;" }, *rdeltas[] = { "", " rp--;", "", " rp++;" };
+	const cell_t instruction = core[addr];
+	const unsigned operation = ((instruction >> 8) & 0x1F) | (((instruction & 0xC) == 0x8) << 5); /* 'r-2' selects 32-63 */
+	const char *code = alu(operation), *condition = precondition(operation);
+	bool next = false;
+	fprintf(out, "L%04X: ", addr);
+	if ((instruction & 0xE000) == 0x6000 && !code) { /* I/O, calls to host, ... */
+		fprintf(out, "pc = 0x%04X; goto fallback;\n", addr);
+		return;
+	}
+	fprintf(out, "GUARD(0x%04X, 0x%04X);", addr, instruction);
+	if ((instruction & 0xE000) == 0x6000 && condition)
+		fprintf(out, " if (!(%s)) { pc = 0x%04X; goto fallback; }", condition, addr);
+	if (instruction & 0x8000) {
+		fprintf(out, " core[++sp] = t; t = 0x%04X;", instruction & 0x7FFF);
+		next = true;
+	} else if ((instruction & 0xE000) == 0x6000) {
+		fprintf(out, " n = core[sp];");
+		if (instruction & 0x10)
+			fprintf(out, " pc = core[rp] >> 1;");
+		fprintf(out, " %s%s%s", code, deltas[instruction & 3], rdeltas[(instruction >> 2) & 3]);
+		if (instruction & 0x80)
+			fprintf(out, " core[sp] = t;");
+		if (instruction & 0x40)
+			fprintf(out, " core[rp] = t;");
+		fprintf(out, " t = %s;", (instruction & 0x20) ? "n" : "T");
+		if (instruction & 0x10)
+			fprintf(out, " goto dispatch;");
+		next = !(instruction & 0x10);
+	} else if (instruction & 0x4000) {
+		fprintf(out, " core[--rp] = 0x%04X;", (addr + 1) << 1);
+		jump(out, instruction & 0x1FFF);
+	} else if (instruction & 0x2000) {
+		fprintf(out, " n = t; t = core[sp--]; if (!n)");
+		jump(out, instruction & 0x1FFF);
+		next = true;
+	} else {
+		jump(out, instruction & 0x1FFF);
+	}
+	if (next && !reachable[addr + 1]) /* falls off the end of the translated code */
+		jump(out, addr + 1);
+	fputc('\n', out);
+}
+
+static const char *preamble = "\
+#include \"embed.h\"\n\
+#include <stdint.h>\n\
+\n\
+#define L (EMBED_CORE_SIZE)\n\
+#define GUARD(ADDR, INSTRUCTION)\\\n\
+	if (core[(ADDR)] != (INSTRUCTION) || !(sp < L && rp < L)) { pc = (ADDR); goto fallback; }\n\
+#define S(N) core[(m_t)(sp - (N)) % L]\n\
+\n\
+typedef uint16_t m_t;\n\
+typedef int16_t  s_t;\n\
+typedef uint32_t d_t;\n\
+typedef int32_t  sd_t;\n\
+\n\
+int embed_aot_vm(embed_t *h);\n\
+\n\
+static sd_t aot_floored(const sd_t d, const s_t n, s_t * const remainder) {\n\
+	if (n == -1) {\n\
+		*remainder = 0;\n\
+		return (sd_t)(0u - (d_t)d);\n\
+	}\n\
+	sd_t q = d / n, r = d % n;\n\
+	if (r && ((r < 0) != (n < 0))) {\n\
+		q--;\n\
+		r += n;\n\
+	}\n\
+	*remainder = r;\n\
+	return q;\n\
+}\n\
+\n\
+static int aot_step_cb(void *param) { return ++*(int*)param > 1; }\n\
+\n\
+static int aot_is_default(embed_t *h) {\n\
+	const embed_opt_t * const o = embed_opt_get(h);\n\
+	return !h->profile && o->read == embed_mmu_read_cb && o->write == embed_mmu_write_cb\n\
+		&& (!o->read_byte || o->read_byte == embed_mmu_read_byte_cb)\n\
+		&& (!o->write_byte || o->write_byte == embed_mmu_write_byte_cb)\n\
+		&& o->yield == embed_yield_cb && !(o->options & EMBED_VM_TRACE_ON)\n\
+		&& embed_cells(h) == EMBED_CORE_SIZE;\n\
+}\n\
+\n\
+/* Run a single instruction in the interpreter, using a yield callback that\n\
+ * stops it before the next one, returns non-zero if the virtual machine\n\
+ * halted with '*r' as its return value. */\n\
+static int aot_step(embed_t *h, int *r) {\n\
+	embed_opt_t * const o = embed_opt_get(h);\n\
+	const embed_yield_t yield = o->yield;\n\
+	void *yields = o->yields;\n\
+	int calls = 0;\n\
+	o->yield = aot_step_cb, o->yields = &calls;\n\
+	*r = embed_vm(h);\n\
+	o->yield = yield, o->yields = yields;\n\
+	return calls < 2;\n\
+}\n\
+\n\
+int embed_aot_vm(embed_t *h) {\n\
+	if (!aot_is_default(h))\n\
+		return embed_vm(h);\n\
+	m_t * const core = embed_core_get(h);\n\
+	m_t pc = core[0], t = core[1], rp = core[2], sp = core[3], n = 0, T = 0;\n\
+	d_t d = 0;\n\
+	int r = 0, dirty = 0;\n\
+	(void)d;\n\
+dispatch:\n\
+	switch (pc) {\n";
+
+static const char *fallback = "\
+	default: goto fallback;\n\
+	}\n\
+fallback:\n\
+	core[0] = pc, core[1] = t, core[2] = rp, core[3] = sp;\n\
+	if (dirty && (h->cache || h->jit))\n\
+		embed_cache_flush(h);\n\
+	dirty = 0;\n\
+	if (aot_step(h, &r))\n\
+		return r;\n\
+	if (!aot_is_default(h))\n\
+		return embed_vm(h);\n\
+	pc = core[0], t = core[1], rp = core[2], sp = core[3];\n\
+	goto dispatch;\n";
+
+static const char *help ="\
+usage: ./aot in.blk out.c\n\n\
+Translate the code in a virtual machine image to C, as the function\n\
+'int embed_aot_vm(embed_t *h)', which can be used instead of 'embed_vm'.\n\n";
+
+int main(int argc, char **argv) {
+	if (argc != 3) {
+		fputs(help, stderr);
+		return 1;
+	}
+	const size_t cells = image(argv[1]);
+	if (cells < 64)
+		embed_fatal("aot: image %s too small (%u cells)", argv[1], (unsigned)cells);
+	const size_t translated = reachability(cells);
+	FILE *out = embed_fopen_or_die(argv[2], "wb");
+	fprintf(out, "/* Generated by 'aot' from '%s', %u of %u cells translated, do not edit.\n"
+		" * See 't/aot.c' for more information. */\n", argv[1], (unsigned)translated, (unsigned)cells);
+	fputs(preamble, out);
+	for (size_t i = 0; i < cells; i++)
+		if (reachable[i])
+			fprintf(out, "\tcase 0x%04X: goto L%04X;\n", (unsigned)i, (unsigned)i);
+	fputs(fallback, out);
+	for (size_t i = 0; i < cells; i++)
+		if (reachable[i])
+			translate(out, i);
+	fputs("}\n", out);
+	return fclose(out) < 0 ? 1 : 0;
+}
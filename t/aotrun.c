@@ -0,0 +1,68 @@
+/**@brief Embed library ahead of time translation test program
+ * @license MIT
+ * @author Richard James Howe
+ * @file aotrun.c
+ *
+ * See <https://github.com/howerj/embed> for more information.
+ *
+ * This program is linked against the output of 't/aot.c', 'aot.gen.c', and
+ * runs Forth programs like the main 'embed' program does, but with the
+ * translated code instead of 'embed_vm':
+ *
+ *	./aotrun -i embed-1.blk -o unit.blk t/unit.fth
+ *
+ * The image loaded should be the one that was translated, any code that
+ * differs from it is run by the interpreter. */
+
+#include "embed.h"
+#include "util.h"
+#include <assert.h>
+#include <stdio.h>
+
+int embed_aot_vm(embed_t *h); /* generated by 'aot' */
+
+static int run(embed_t *h, const char *iblk, const char *oblk, const char *file, int load) {
+	assert(h && file);
+	FILE *in = embed_fopen_or_die(file, "rb");
+	embed_opt_t o = embed_opt_default_hosted();
+	o.in      = in;
+	o.out     = stdout;
+	o.name    = oblk;
+	o.options = EMBED_VM_QUITE_ON;
+	embed_opt_set(h, &o);
+	if (load && (iblk ? embed_load(h, iblk) : embed_load_buffer(h, embed_default_block, embed_default_block_size)) < 0)
+		embed_fatal("aotrun: load failed (input = %s)", iblk ? iblk : "(null)");
+	embed_reset(h);
+	const int r = embed_aot_vm(h);
+	fclose(in);
+	return r;
+}
+
+static const char *help ="\
+usage: ./aotrun [-h] -i in.blk -o out.blk file.fth...\n\n\
+Run each Forth file using the ahead of time translated image.\n\n";
+
+int main(int argc, char **argv) {
+	embed_getopt_t go = { .init = 0, .error = 1 };
+	const char *iblk = NULL, *oblk = NULL;
+	int ch = 0, r = 0;
+	while ((ch = embed_getopt(&go, argc, argv, "hi:o:")) != -1) {
+		switch (ch) {
+		case 'i': iblk = go.arg; break;
+		case 'o': oblk = go.arg; break;
+		case 'h': fputs(help, stdout); return 0;
+		default:  fputs(help, stderr); return 1;
+		}
+	}
+	if (go.index >= argc) {
+		fputs(help, stderr);
+		return 1;
+	}
+
+	static cell_t m[EMBED_CORE_SIZE] = { 0 };
+	static embed_t h = { .m = m };
+	for (int i = go.index; i < argc; i++)
+		if ((r = run(&h, iblk, oblk, argv[i], i == go.index)) < 0)
+			break;
+	return r;
+}
@@ -0,0 +1,361 @@
+/**@brief Embed library benchmark program
+ * @license MIT
+ * @author Richard James Howe
+ * @file bench.c
+ *
+ * See <https://github.com/howerj/embed> for more information.
+ *
+ * This program runs Forth programs against a virtual machine image (the
+ * built in eForth image by default) and reports the number of instructions
+ * executed, the time taken and the rate at which instructions were executed
+ * in Millions of Instructions Per Second (MIPS). It is used to measure
+ * changes to the virtual machine, for example:
+ *
+ *	./bench -o bench.blk embed.fth
+ *	./bench -i embed-1.blk -o bench.blk t/unit.fth
+ *
+ * Each file is run once with a yield callback that counts the instructions
+ * executed, and then 'repeat' times with the default options, the fastest of
+ * the timed runs is reported. Output produced by the virtual machine is
+ * discarded. The '-c' option turns on the decoded instruction cache, '-g'
+ * times the general interpreter loop, used with custom callbacks, instead of
+ * the specialized ones and '-j' turns on the JIT compiler, with '-j' the
+ * number of blocks compiled and the time spent running compiled code during
+ * the timed runs is reported as well.
+ *
+ * With '-p super.h' each file is run once with profiling turned on instead,
+ * a report of the most common instruction sequences is printed and the pairs
+ * of instructions most worth fusing into superinstructions are written out
+ * as a new 'super.h' (the library must be rebuilt for it to take effect):
+ *
+ *	./bench -p super.h -o bench.blk embed.fth t/unit.fth */
+
+#include "embed.h"
+#include "util.h"
+#include <assert.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <time.h>
+
+typedef unsigned long long counter_t;
+
+#define SUPER_MAX (32) /**< maximum number of superinstructions to generate, each must be more than 0.01% of instructions */
+#define REPORT    (12) /**< number of bigrams and trigrams to report */
+
+typedef struct {
+	unsigned classes[3];
+	counter_t count;
+} sequence_t;
+
+static int count_yield_cb(void *param) {
+	assert(param);
+	(*(counter_t*)param)++;
+	return 0;
+}
+
+static int nop_yield_cb(void *param) { (void)param; return 0; }
+
+static int run(embed_t *h, const char *iblk, const char *oblk, const char *file, embed_vm_option_e options, embed_yield_t yield, void *yields) {
+	assert(h && file);
+	FILE *in = embed_fopen_or_die(file, "rb");
+	embed_opt_t o = embed_opt_default_hosted();
+	o.put     = embed_nputc_cb;
+	o.out     = NULL;
+	o.in      = in;
+	o.name    = oblk;
+	o.options = EMBED_VM_QUITE_ON | options;
+	o.yield   = yield ? yield : embed_yield_cb;
+	o.yields  = yields;
+	embed_opt_set(h, &o);
+	if ((iblk ? embed_load(h, iblk) : embed_load_buffer(h, embed_default_block, embed_default_block_size)) < 0)
+		embed_fatal("bench: load failed (input = %s)", iblk ? iblk : "(null)");
+	embed_reset(h);
+	const int r = embed_vm(h);
+	fclose(in);
+	return r;
+}
+
+static int latency_callback(embed_t *h, void *param) {
+	cell_t a = 0, b = 0;
+	(void)param;
+	if (embed_pop(h, &a) < 0 || embed_pop(h, &b) < 0 || embed_push(h, a + b) < 0)
+		return 4;
+	return 0;
+}
+
+static int latency_extension(embed_t *h, void *param, cell_t *cells) {
+	(void)h, (void)param;
+	cells[0] += cells[1];
+	return 0;
+}
+
+/* time 'loops' runs of 'line', a loop making 10001 calls to the host */
+static double latency_loop(embed_t *h, const char *line, long loops) {
+	cell_t v = 0;
+	const clock_t start = clock();
+	for (long i = 0; i < loops; i++)
+		if (embed_eval(h, line) < 0 || embed_pop(h, &v) < 0 || v != 10001)
+			embed_fatal("bench: %s failed", line);
+	return (double)(clock() - start) / CLOCKS_PER_SEC;
+}
+
+static int latency(const char *iblk, long calls, int cache) {
+	embed_t *h = embed_new();
+	cell_t sq = 0, v = 0, sum = 0;
+	const cell_t seven = 7;
+	if (!h)
+		embed_fatal("bench: allocation failed");
+	if (!cache)
+		free(h->cache), h->cache = NULL;
+	if (iblk && embed_load(h, iblk) < 0)
+		embed_fatal("bench: load failed (input = %s)", iblk);
+	static embed_extensions_t extensions;
+	embed_opt_t o = *embed_opt_get(h);
+	o.put = embed_nputc_cb, o.out = NULL;
+	o.callback = latency_callback, o.param = NULL;
+	embed_opt_set(h, &o);
+	h->extensions = &extensions;
+	if (embed_eval(h, ": sq dup * ;\n") < 0 || embed_find(h, "sq", &sq) < 0)
+		embed_fatal("bench: could not define 'sq'");
+	if (embed_register(h, "x+", latency_extension, NULL, 2, 1) < 0
+		|| embed_eval(h, "system +order : c+ vm ; : c-loop 0 10000 for 1 c+ next ; : x-loop 0 10000 for 1 x+ next ;\n") < 0)
+		embed_fatal("bench: could not define host calls");
+	clock_t start = clock();
+	for (long i = 0; i < calls; i++)
+		if (embed_eval(h, "7 sq\n") < 0 || embed_pop(h, &v) < 0 || v != 49)
+			embed_fatal("bench: embed_eval failed");
+	const double eval = (double)(clock() - start) / CLOCKS_PER_SEC;
+	static embed_snippets_t snippets;
+	start = clock();
+	for (long i = 0; i < calls; i++)
+		if (embed_eval_cached(h, &snippets, "7 sq\n") < 0 || embed_pop(h, &v) < 0 || v != 49)
+			embed_fatal("bench: embed_eval_cached failed");
+	const double cached = (double)(clock() - start) / CLOCKS_PER_SEC;
+	start = clock();
+	for (long i = 0; i < calls; i++)
+		if (embed_call(h, sq, &seven, 1, &v, 1) < 0 || v != 49)
+			embed_fatal("bench: embed_call failed");
+		else
+			sum += v;
+	const double call = (double)(clock() - start) / CLOCKS_PER_SEC;
+	const long loops = (calls + 10000) / 10001, made = loops * 10001;
+	const double callback = latency_loop(h, "c-loop\n", loops), extension = latency_loop(h, "x-loop\n", loops);
+	printf("%-17s %10ld calls %10.3f us per call\n", "embed_eval", calls, 1e6 * eval / calls);
+	printf("%-17s %10ld calls %10.3f us per call %8.2fx\n", "embed_eval_cached", calls, 1e6 * cached / calls, cached > 0.0 ? eval / cached : 0.0);
+	printf("%-17s %10ld calls %10.3f us per call %8.2fx\n", "embed_call", calls, 1e6 * call / calls, call > 0.0 ? eval / call : 0.0);
+	printf("%-17s %10ld calls %10.3f us per call\n", "vm callback", made, 1e6 * callback / made);
+	printf("%-17s %10ld calls %10.3f us per call %8.2fx\n", "embed_register", made, 1e6 * extension / made, extension > 0.0 ? callback / extension : 0.0);
+	embed_free(h);
+	return sum == (cell_t)(49 * calls) ? 0 : -1;
+}
+
+/* count the instructions taken by 'iterations' runs of each number
+ * conversion, through the yield callback of the general loop */
+static int conversions(const char *iblk, long iterations) {
+	static const struct { const char *name, *word; } tests[] = {
+		{ "0 0 $\" 12345\" count >number", ": conversion for 0 0 $\" 12345\" count >number 2drop 2drop next ;\n" },
+		{ "$\" -4321\" count evaluate",      ": conversion for $\" -4321\" count evaluate drop next ;\n" },
+		{ "u and -1. through <# #s #>",      ": conversion for r@ 0 <# #s #> 2drop -1 -1 <# #s #> 2drop next ;\n" },
+		{ "<# # # # #>",                     ": conversion for r@ 0 <# # # # #> 2drop next ;\n" },
+	};
+	embed_t *h = embed_new();
+	counter_t count = 0;
+	char line[64];
+	int r = 0;
+	if (!h)
+		embed_fatal("bench: allocation failed");
+	if (iblk && embed_load(h, iblk) < 0)
+		embed_fatal("bench: load failed (input = %s)", iblk);
+	embed_opt_t o = *embed_opt_get(h);
+	o.put = embed_nputc_cb, o.out = NULL;
+	o.yield = count_yield_cb, o.yields = &count;
+	embed_opt_set(h, &o);
+	snprintf(line, sizeof(line), "%ld conversion\n", iterations - 1);
+	printf("%-32s %14s\n", "conversion", "instructions");
+	for (size_t i = 0; i < sizeof(tests)/sizeof(tests[0]); i++) {
+		if (embed_eval(h, tests[i].word) < 0)
+			embed_fatal("bench: could not define '%s'", tests[i].name);
+		count = 0;
+		if (embed_eval(h, line) < 0 || embed_depth(h)) {
+			embed_error("bench: '%s' failed", tests[i].name);
+			r = -1;
+		}
+		printf("%-32s %14llu\n", tests[i].name, count);
+	}
+	embed_free(h);
+	return r;
+}
+
+static const char *class_name(unsigned c) {
+	static const char *names[EMBED_PROFILE_CLASSES] = {
+		"literal", "branch", "0branch", "call",
+		"t", "n", "r", "[t]", "n->[t]", "t+n", "t*n", "t&n",
+		"t|n", "t^n", "~t", "t-1", "t==0", "t==n", "nu<t", "n<t",
+		"n>>t", "n<<t", "sp@", "rp@", "sp!", "rp!", "save", "tx",
+		"rx", "um/mod", "/mod", "bye", "vm", "cpu", "next", "+loop",
+		"c@", "c!", "cmove", "fill", "skip", "scan", "-trailing", "compare",
+		"digits>", ">digits", "crc", "d+", "d-", "dnegate", "d<", "m*",
+		"m/mod", "fpu", "frame", "unframe", "local@", "local!", "ext",
+	};
+	assert(c < EMBED_PROFILE_CLASSES);
+	return names[c] ? names[c] : "unused";
+}
+
+static int super_supported(unsigned first, unsigned second) { /* see 'vm_decode' in 'embed.c' */
+	const unsigned literal = 0, call = 3, alu = 4, extended = alu + 32;
+	if (first == literal)
+		return second == literal || second == call || (second >= alu && second < extended);
+	return first >= alu && first < extended && second < alu;
+}
+
+static void class_enum(char *buf, size_t length, unsigned c) {
+	static const char *names[] = { "VM_LITERAL", "VM_BRANCH", "VM_ZBRANCH", "VM_CALL" };
+	if (c < 4)
+		snprintf(buf, length, "%s", names[c]);
+	else
+		snprintf(buf, length, "VM_ALU + %u", c - 4);
+}
+
+static int sequence_compare(const void *a, const void *b) {
+	const counter_t ca = ((const sequence_t*)a)->count, cb = ((const sequence_t*)b)->count;
+	return ca < cb ? 1 : ca > cb ? -1 : 0;
+}
+
+static void sequence_print(const sequence_t *s, size_t n, size_t length, counter_t total) {
+	for (size_t i = 0; i < n && s[i].count; i++) {
+		char buf[64] = { 0 };
+		size_t used = 0;
+		for (size_t j = 0; j < length; j++)
+			used += snprintf(buf + used, sizeof(buf) - used, "%s%s", j ? " " : "", class_name(s[i].classes[j]));
+		printf("  %-28s %14llu %6.2f%%\n", buf, s[i].count, 100.0 * s[i].count / total);
+	}
+}
+
+static int profile_report(const embed_profile_t *p, const char *super) {
+	const size_t C = EMBED_PROFILE_CLASSES;
+	static sequence_t bigrams[EMBED_PROFILE_CLASSES * EMBED_PROFILE_CLASSES];
+	static sequence_t trigrams[EMBED_PROFILE_CLASSES * EMBED_PROFILE_CLASSES * EMBED_PROFILE_CLASSES];
+	for (size_t i = 0; i < C; i++)
+		for (size_t j = 0; j < C; j++) {
+			bigrams[i*C + j] = (sequence_t){ .classes = { i, j }, .count = p->bigrams[i][j] };
+			for (size_t k = 0; k < C; k++)
+				trigrams[(i*C + j)*C + k] = (sequence_t){ .classes = { i, j, k }, .count = p->trigrams[i][j][k] };
+		}
+	qsort(bigrams,  C*C,   sizeof(bigrams[0]),  sequence_compare);
+	qsort(trigrams, C*C*C, sizeof(trigrams[0]), sequence_compare);
+	const counter_t calls = p->calls ? p->calls : 1;
+	printf("instructions   %14llu (%.2f per call)\n", (counter_t)p->instructions, (double)p->instructions / calls);
+	printf("calls          %14llu\n", (counter_t)p->calls);
+	printf("dispatches     %14llu (%.2f per call, with the superinstructions compiled in)\n", (counter_t)p->dispatches, (double)p->dispatches / calls);
+	printf("bigrams:\n");
+	sequence_print(bigrams, REPORT, 2, p->instructions);
+	printf("trigrams:\n");
+	sequence_print(trigrams, REPORT, 3, p->instructions);
+
+	FILE *out = embed_fopen_or_die(super, "wb");
+	fprintf(out, "/* Superinstructions: pairs of instructions at consecutive addresses that are\n"
+		" * fused into a single instruction when they are decoded into the instruction\n"
+		" * cache, 'X(FIRST, SECOND)'. This file is generated from an instruction\n"
+		" * profile of the meta-compiler and unit tests with 'make super', do not edit\n"
+		" * it by hand. */\n"
+		"#ifndef EMBED_SUPER\n"
+		"#define EMBED_SUPER(X)\\\n");
+	for (size_t i = 0, n = 0; i < C*C && n < SUPER_MAX && bigrams[i].count >= p->instructions / 10000; i++) {
+		if (!super_supported(bigrams[i].classes[0], bigrams[i].classes[1]))
+			continue;
+		char first[32] = { 0 }, second[32] = { 0 }, comment[64] = { 0 };
+		class_enum(first,  sizeof(first),  bigrams[i].classes[0]);
+		class_enum(second, sizeof(second), bigrams[i].classes[1]);
+		snprintf(comment, sizeof(comment), "%s %s", class_name(bigrams[i].classes[0]), class_name(bigrams[i].classes[1]));
+		fprintf(out, "\tX(%-11s, %-11s) /* %-16s %12llu */\\\n", first, second, comment, bigrams[i].count);
+		n++;
+	}
+	fprintf(out, "\n#endif\n");
+	return fclose(out) < 0 ? -1 : 0;
+}
+
+static const char *help ="\
+usage: ./bench [-h] [-c] [-g] [-j] [-l calls] [-n iterations] [-p super.h] [-r repeat] -i in.blk -o out.blk file.fth...\n\n\
+Run each Forth file against an image and report the instructions\n\
+executed, the time taken and the instruction rate in MIPS.\n\n\
+	-c\tuse the decoded instruction cache\n\
+	-g\ttime the general loop, with a yield callback\n\
+	-j\tuse the JIT compiler and report on it\n\
+	-l calls\tmeasure the latency of calling a word from the host\n\
+	-n iterations\tcount the instructions the number conversions take\n\
+	-p file\tprofile instead and write superinstruction table to file\n\n";
+
+int main(int argc, char **argv) {
+	embed_getopt_t go = { .init = 0, .error = 1 };
+	const char *iblk = NULL, *oblk = NULL, *super = NULL;
+	long repeat = 3, calls = 0, iterations = 0;
+	int ch = 0, r = 0, cache = 0, jit = 0, general = 0;
+	while ((ch = embed_getopt(&go, argc, argv, "hcgjl:n:i:o:p:r:")) != -1) {
+		switch (ch) {
+		case 'c': cache = 1; break;
+		case 'g': general = 1; break;
+		case 'j': jit = 1; break;
+		case 'l': calls = strtol(go.arg, NULL, 0); break;
+		case 'n': iterations = strtol(go.arg, NULL, 0); break;
+		case 'p': super = go.arg; break;
+		case 'i': iblk = go.arg; break;
+		case 'o': oblk = go.arg; break;
+		case 'r': repeat = strtol(go.arg, NULL, 0); break;
+		case 'h': fputs(help, stdout); return 0;
+		default:  fputs(help, stderr); return 1;
+		}
+	}
+	if (calls > 0)
+		return latency(iblk, calls, cache) < 0 ? 1 : 0;
+	if (iterations > 0)
+		return conversions(iblk, iterations) < 0 ? 1 : 0;
+	if (go.index >= argc || repeat < 1) {
+		fputs(help, stderr);
+		return 1;
+	}
+
+	static cell_t m[EMBED_CORE_SIZE] = { 0 };
+	static embed_fpu_t fpu = { .depth = 0 };
+	static embed_t h = { .m = m, .fpu = &fpu };
+	if (cache && !(h.cache = embed_alloc(embed_cache_size())))
+		embed_fatal("bench: cache allocation failed");
+	if (jit && !(h.jit = embed_jit_new()))
+		embed_fatal("bench: JIT not supported");
+	if (super) {
+		static embed_profile_t profile;
+		h.profile = &profile;
+		for (int i = go.index; i < argc; i++)
+			if ((r = run(&h, iblk, oblk, argv[i], 0, NULL, NULL)) < 0)
+				embed_error("bench: %s returned %d", argv[i], r);
+		if (profile_report(&profile, super) < 0)
+			embed_fatal("bench: could not write %s", super);
+		free(h.cache);
+		embed_jit_free(h.jit);
+		return r < 0 ? 1 : 0;
+	}
+	printf("%-16s %14s %10s %10s\n", "file", "instructions", "seconds", "MIPS");
+	for (int i = go.index; i < argc; i++) {
+		counter_t count = 0;
+		if ((r = run(&h, iblk, oblk, argv[i], 0, count_yield_cb, &count)) < 0)
+			embed_error("bench: %s returned %d", argv[i], r);
+		double best = -1.0;
+		const embed_jit_stats_t before = h.jit ? embed_jit_stats(h.jit) : (embed_jit_stats_t){ 0 };
+		for (long j = 0; j < repeat; j++) {
+			const clock_t start = clock();
+			run(&h, iblk, oblk, argv[i], 0, general ? nop_yield_cb : NULL, NULL);
+			const double taken = (double)(clock() - start) / CLOCKS_PER_SEC;
+			best = best < 0.0 || taken < best ? taken : best;
+		}
+		printf("%-16s %14llu %10.3f %10.2f\n", argv[i], count, best, best > 0.0 ? (count / best) / 1e6 : 0.0);
+		if (h.jit) {
+			const embed_jit_stats_t s = embed_jit_stats(h.jit);
+			printf("  jit: %llu blocks (%llu instructions) compiled, %llu entries, %llu flushes, %.3f of %ld runs in compiled code\n",
+				(counter_t)(s.blocks - before.blocks), (counter_t)(s.instructions - before.instructions),
+				(counter_t)(s.entries - before.entries), (counter_t)(s.flushes - before.flushes),
+				s.seconds - before.seconds, repeat);
+		}
+	}
+	free(h.cache);
+	embed_jit_free(h.jit);
+	return r < 0 ? 1 : 0;
+}
@@ -24,9 +24,9 @@
  * be checked each time, a table of function pointers and strings is used
  * to define new words, and other minor things.
  *
- * Only numbers are passed to and from the eForth interpreter, it is in
- * principle possible to pass strings but requires a more intimate knowledge
- * of the internals.
+ * Strings are passed as an address and length pair, the library functions
+ * 'embed_pop_string' and 'embed_push_string' copy them to and from the
+ * host, see '>float' and 'f>string'.
  *
  * Examples:
  *
@@ -42,7 +42,15 @@
  *    fget
  *    3.443   ( <- must be on a new line 'fget 3.443' does not work )
  *    f.
- *    3.443000e+00 */
+ *    3.443000e+00
+ *
+ * Or from a string, with '>float':
+ *
+ *    char " parse 3.443" >float f.
+ *    3.443000e+00
+ *
+ *    2 s>f fsqrt f>string type
+ *    1.414214e+00 */
 
 #include "embed.h"
 #include "util.h"
@@ -114,6 +122,8 @@ struct vm_extension_t {
 	X("fexp",     cb_fexp,       true)\
 	X("fsqrt",    cb_fsqrt,      true)\
 	X("fget",     cb_fget,       true)\
+	X(">float",   cb_to_float,   true)\
+	X("f>string", cb_flt_string, true)\
 	X("floor",    cb_floor,      true)\
 	X("fceil",    cb_fceil,      true)\
 	X("fround",   cb_fround,     true)\
@@ -177,15 +187,24 @@ static inline void push(vm_extension_t * const v, const cell_t value) {
 }
 
 static inline void udpush(vm_extension_t * const v, const double_cell_t value) {
-	push(v, value);
-	push(v, value >> 16);
+	assert(v);
+	if (eget(v))
+		return;
+	const cell_t cells[2] = { value, value >> 16 };
+	int e = 0;
+	if ((e = embed_push_n(v->h, cells, 2)) < 0)
+		eset(v, e);
 }
 
 static inline double_cell_t udpop(vm_extension_t * const v) {
-	const double_cell_t hi = pop(v);
-	const double_cell_t lo = pop(v);
-	const double_cell_t d  = (hi << 16) | lo;
-	return d;
+	assert(v);
+	if (eget(v))
+		return 0;
+	cell_t cells[2] = { 0 };
+	int e = 0;
+	if ((e = embed_pop_n(v->h, cells, 2)) < 0)
+		eset(v, e);
+	return ((double_cell_t)cells[1] << 16) | cells[0];
 }
 
 static inline sdc_t dpop(vm_extension_t * const v)                     { return udpop(v); }
@@ -336,12 +355,16 @@ static int cb_fdup(vm_extension_t * const v) {
 	return eclr(v);
 }
 
-static int cb_fswap(vm_extension_t * const v) {
-	const vm_float_t f1 = fpop(v);
-	const vm_float_t f2 = fpop(v);
-	fpush(v, f1);
-	fpush(v, f2);
-	return eclr(v);
+static int cb_fswap(vm_extension_t * const v) { /* swapped in place, the default MMU is used */
+	embed_stack_view_t s = { .cells = NULL };
+	if (embed_stack_view(v->h, &s) < 0)
+		return -1;
+	if (s.depth >= 4) {
+		cell_t * const c = &s.cells[s.depth - 4];
+		const cell_t lo = c[0], hi = c[1];
+		c[0] = c[2], c[1] = c[3], c[2] = lo, c[3] = hi;
+	}
+	return embed_stack_commit(v->h, &s) < 0 || s.depth < 4 ? -4 /* stack underflow */ : 0;
 }
 
 static int cb_fdrop(vm_extension_t * const v) {
@@ -486,6 +509,33 @@ static int cb_fget(vm_extension_t * const v) {
 	return eclr(v);
 }
 
+static int cb_to_float(vm_extension_t * const v) {
+	char buf[64] = { 0 }, *end = NULL;
+	size_t u = 0;
+	int e = 0;
+	if ((e = embed_pop_string(v->h, buf, sizeof buf, &u)) < 0) {
+		eset(v, e);
+		return eclr(v);
+	}
+	const vm_float_t f = strtof(buf, &end);
+	if (!u || u >= sizeof buf || *end)
+		return 13;
+	fpush(v, f);
+	return eclr(v);
+}
+
+static int cb_flt_string(vm_extension_t * const v) {
+	char buf[32] = { 0 };
+	const vm_float_t f = fpop(v);
+	if (eget(v))
+		return eclr(v);
+	const int u = snprintf(buf, sizeof buf, "%e", f);
+	int e = 0;
+	if ((e = embed_push_string(v->h, buf, u)) < 0)
+		eset(v, e);
+	return eclr(v);
+}
+
 static int cb_fround(vm_extension_t * const v) {
 	fpush(v, roundf(fpop(v)));
 	return eclr(v);
@@ -10,6 +10,7 @@
 typedef uint16_t m_t;
 typedef  int16_t s_t;
 typedef uint32_t d_t;
+typedef  int32_t sd_t;
 typedef struct forth_t { m_t m[32768]; } forth_t;
 
 static inline size_t embed_cells(forth_t const * const h) { assert(h); return h->m[5]; } /* count in cells, not bytes */
@@ -71,6 +72,12 @@ static int embed_load(forth_t *h, const char *name) {
 	return r < 64 ? -70 /* read-file IOR */ : 0; /* minimum size checks, 128 bytes */
 }
 
+static m_t get8(const m_t *m, m_t l, m_t b) { return (m[(b>>1)%l] >> ((b&1)*8)) & 0xFF; }
+static void set8(m_t *m, m_t l, m_t b, m_t c) { m[(b>>1)%l] = (m[(b>>1)%l] & (0xFF00 >> ((b&1)*8))) | ((c & 0xFF) << ((b&1)*8)); }
+static int delimiter(m_t ch, m_t c) { return c == 32 ? ch <= 32 : ch == c; }
+static m_t digit(m_t ch) { ch -= 48; return ch > 9 ? (ch - 7 < 10 ? 0xFFFF : ch - 7) : ch; }
+static m_t ccitt(m_t crc, m_t c) { m_t x = (crc >> 8) ^ c; x ^= x >> 4; x ^= x << 5; x ^= x << 12; return (crc << 8) ^ x; }
+
 static inline void trace(FILE *out, m_t opt, m_t *m, m_t pc, m_t instruction, m_t t, m_t rp, m_t sp) {
 	if (!(opt & 1))
 		return;
@@ -79,7 +86,7 @@ static inline void trace(FILE *out, m_t opt, m_t *m, m_t pc, m_t instruction, m_
 
 static int embed_forth(forth_t *h, FILE *in, FILE *out, const char *block) {
 	assert(h && in && out);
-	static const m_t delta[] = { 0, 1, -2, -1 };
+	static const m_t delta[] = { 0, 1, -2, -1 }, rdelta[] = { 0, 1, 0, -1 };
 	const m_t l = embed_cells(h);
 	m_t * const m = h->m;
 	m_t pc = m[0], t = m[1], rp = m[2], sp = m[3], r = 0, opt = 0;
@@ -94,7 +101,7 @@ static int embed_forth(forth_t *h, FILE *in, FILE *out, const char *block) {
 		} else if ((0xE000 & instruction) == 0x6000) { /* ALU */
 			m_t n = m[sp], T = t;
 			pc = (instruction & 0x10) ? m[rp] >> 1 : pc;
-			switch ((instruction >> 8u) & 0x1f) {
+			switch (((instruction >> 8u) & 0x1f) | (((instruction & 0xC) == 0x8) << 5)) { /* r-2 selects 32-63 */
 			case  0:                           break;
 			case  1: T = n;                    break;
 			case  2: T = m[rp];                break;
@@ -125,10 +132,33 @@ static int embed_forth(forth_t *h, FILE *in, FILE *out, const char *block) {
 			case 27: if (m[rp]) { m[rp] = 0; sp--; r = t; t = n; goto finished; }; T = t; break;
 			/* 28 is virtual machine callback mechanism, not implemented here */
 			case 29: T = opt; opt = t; break;
+			case 30: if ((T = m[rp])) { m[rp] = T - 1; T = 0; } else { rp++; T = -1; } break;
+			case 31: d = (m_t)(m[rp] - m[(rp + 1) % l]); m[rp] += t; T = -!!((d ^ (d + t)) & (d ^ t) & 0x8000); break;
+		case 32: T = get8(m, l, t);           break;
+		case 33: set8(m, l, t, n); T = m[--sp]; break;
+		case 34: for (d = 0; d < t; d++) { const m_t o = n > m[sp-1] ? t-d-1 : d; set8(m, l, n+o, get8(m, l, m[sp-1]+o)); } sp -= 2; T = m[sp]; break;
+		case 35: for (d = 0; d < n; d++) set8(m, l, m[sp-1]+d, t); sp -= 2; T = m[sp]; break;
+		case 36: for (d = 0; d < n &&  delimiter(get8(m, l, m[sp-1]+d), t); d++); m[sp-1] += d; T = n - d; break;
+		case 37: for (d = 0; d < n && !delimiter(get8(m, l, m[sp-1]+d), t); d++); m[sp-1] += d; T = n - d; break;
+		case 38: for (T = t; T && get8(m, l, n+T-1) <= 32; T--); break;
+		case 39: T = m[sp-1] - t; for (d = 0; !T && d < t; d++) T = get8(m, l, m[sp-2]+d) - get8(m, l, n+d); sp -= 2; break;
+		case 40: d = m[sp-3]|((d_t)m[sp-2]<<16); for (T = 0; T < n && digit(get8(m, l, m[sp-1]+T)) < t; T++) d = d*t + digit(get8(m, l, m[sp-1]+T)); m[sp-3] = d; m[sp-2] = d >> 16; m[sp-1] += T; T = n - T; break;
+		case 41: if (t > 1) { d = m[sp-2]|((d_t)m[sp-1]<<16); T = n; do { set8(m, l, --T, d%t + (d%t > 9 ? 55 : 48)); d /= t; } while (d); m[sp-2] = m[sp-1] = 0; } else { pc=4; T = t ? 17 : 10; } break;
+		case 42: for (T = 0xFFFF, d = 0; d < t; d++) T = ccitt(T, get8(m, l, n+d)); break;
+		case 43: d = (m[sp-2]|((d_t)m[sp-1]<<16)) + (n|((d_t)t<<16)); m[sp-2] = d; T = d >> 16; break;
+		case 44: d = (m[sp-2]|((d_t)m[sp-1]<<16)) - (n|((d_t)t<<16)); m[sp-2] = d; T = d >> 16; break;
+		case 45: d = 0u - (n|((d_t)t<<16)); m[sp] = d; T = d >> 16; break;
+		case 46: T = -((sd_t)(m[sp-2]|((d_t)m[sp-1]<<16)) < (sd_t)(n|((d_t)t<<16))); sp -= 2; break;
+		case 47: d = (sd_t)(s_t)n * (s_t)t; m[sp] = d; T = d >> 16; break;
+		case 48: if (t) { const sd_t v = m[sp-1]|((d_t)n<<16), w = (s_t)t; sd_t q = w == -1 ? (sd_t)(0u - (d_t)v) : v / w, r = w == -1 ? 0 : v % w; if (r && (r < 0) != (w < 0)) { q--; r += w; } m[sp-1] = r; T = q; } else { pc=4; T=10; } break;
+		case 50: if (t <= sp && t < rp) { m[--rp] = m[6]; m[6] = rp; for (d = t; d; d--) m[--rp] = m[sp-d+1]; sp -= t; T = m[sp]; } else { pc=4; T = t <= sp ? 5 : 4; } break;
+		case 51: rp = m[6] % l; m[6] = m[rp++]; break;
+		case 52: T = m[(m_t)(m[6]-1-t)%l]; break;
+		case 53: m[(m_t)(m[6]-1-t)%l] = n; T = m[--sp]; break;
 			default: pc=4; T=21; break;
 			}
 			sp += delta[ instruction       & 0x3];
-			rp -= delta[(instruction >> 2) & 0x3];
+			rp -= rdelta[(instruction >> 2) & 0x3];
 			if (instruction & 0x80)
 				m[sp] = t;
 			if (instruction & 0x40)
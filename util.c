@@ -59,6 +59,12 @@ embed_t *embed_new(void) {
 	h->m = calloc(EMBED_CORE_SIZE * sizeof(cell_t), 1);
 	if (!(h->m))
 		goto fail;
+	h->cache = calloc(embed_cache_size(), 1);
+	if (!(h->cache))
+		goto fail;
+	h->fpu = calloc(sizeof(embed_fpu_t), 1);
+	if (!(h->fpu))
+		goto fail;
 	if (embed_default_hosted(h) < 0)
 		goto fail;
 	h->o = embed_opt_default();
@@ -71,8 +77,11 @@ fail:
 void embed_free(embed_t *h)  {
 	if (!h)
 		return;
-	memset(h, 0, sizeof(*h));
 	free(h->m);
+	free(h->cache);
+	free(h->fpu);
+	embed_jit_free(h->jit);
+	memset(h, 0, sizeof(*h));
 	free(h);
 }
 
@@ -144,11 +153,33 @@ static void embed_normalize(embed_t *h, size_t l)  {
 		embed_buffer_swap(h->m, l);
 }
 
+/* The checks 'bist' makes when the image boots, made on the image as it was
+ * loaded into the core, if it has an eForth header with checking enabled */
+static int embed_load_check(embed_t *h, const size_t length) {
+	static const cell_t magic[] = { 0x4689, 0x4854, 0x0A0D, 0x0A1A };
+	cell_t * const m = h->m;
+	for (size_t i = 0; i < sizeof(magic)/sizeof(magic[0]); i++)
+		if (m[11 + i] != magic[i])
+			return 0;
+	if (!(m[19] & 1))
+		return 0;
+	if (m[15] > length)
+		return -70; /* read-file IOR */
+	if (h->o.read != embed_mmu_read_cb || (h->o.read_byte && h->o.read_byte != embed_mmu_read_byte_cb))
+		return 0;
+	const cell_t crc = m[16];
+	m[16] = 0;
+	const cell_t actual = embed_crc(h, 0, m[15]);
+	m[16] = crc;
+	return actual == crc ? 0 : -70;
+}
+
 int embed_load_file(embed_t *h, FILE *input) {
 	assert(h && input);
 	const size_t r = fread(h->m, 1, EMBED_CORE_SIZE * sizeof(cell_t), input);
 	embed_normalize(h, r / 2);
-	return r < 128 ? -70 /* read-file IOR */ : 0; /* minimum size checks, 128 bytes */
+	embed_cache_flush(h);
+	return r < 128 ? -70 /* read-file IOR */ : embed_load_check(h, r); /* minimum size checks, 128 bytes */
 }
 
 int embed_forth_opt(embed_t *h, embed_vm_option_e opt, FILE *in, FILE *out, const char *block) {
@@ -302,6 +333,40 @@ static inline int test_embed_stack(void) {
 	return unit_test_finish(&t);
 }
 
+static inline int test_embed_stack_n(void) {
+	unit_test_t t = unit_test_start();
+	embed_t *h = NULL;
+	embed_stack_view_t view = { .cells = NULL };
+	const cell_t in[] = { 1, 2, 3 };
+	cell_t out[4] = { 0 }, v = 0;
+	unit_test_verify(&t, (h = embed_new()) != NULL);
+
+	unit_test(&t, embed_push_n(h, in, 3) == 0);
+	unit_test(&t, embed_depth(h) == 3);
+	unit_test(&t, embed_pop(h, &v) == 0 && v == 3);
+	unit_test(&t, embed_push(h, v) == 0);
+	unit_test(&t, embed_pop_n(h, out, 4) == -4);
+	unit_test(&t, embed_depth(h) == 3);
+
+	unit_test(&t, embed_stack_view(h, &view) == 0);
+	unit_test(&t, view.depth == 3 && view.capacity > 3);
+	unit_test(&t, view.cells[0] == 1 && view.cells[1] == 2 && view.cells[2] == 3);
+	unit_test_statement(&t, view.cells[0] = 10);
+	unit_test_statement(&t, view.cells[view.depth++] = 4);
+	unit_test(&t, embed_stack_commit(h, &view) == 0);
+	unit_test(&t, embed_depth(h) == 4);
+	unit_test(&t, embed_pop_n(h, out, 4) == 0);
+	unit_test(&t, out[0] == 10 && out[1] == 2 && out[2] == 3 && out[3] == 4);
+	unit_test(&t, embed_depth(h) == 0);
+
+	unit_test(&t, embed_eval(h, "5 6 7 \n") == 0);
+	unit_test(&t, embed_pop_n(h, out, 3) == 0);
+	unit_test(&t, out[0] == 5 && out[1] == 6 && out[2] == 7);
+
+	unit_test_statement(&t, embed_free(h));
+	return unit_test_finish(&t);
+}
+
 static inline int test_embed_eval(void) {
 	unit_test_t t = unit_test_start();
 	embed_t *h = NULL;
@@ -317,6 +382,121 @@ static inline int test_embed_eval(void) {
 	return unit_test_finish(&t);
 }
 
+static inline int test_embed_cache(void) {
+	unit_test_t t = unit_test_start();
+	embed_t *h = NULL;
+	unit_test_verify(&t, (h = embed_new()) != NULL);
+	unit_test_verify(&t, h->cache != NULL);
+
+	cell_t v = 0, xt = 0;
+	unit_test(&t, embed_eval(h, ": cached 1 ; cached ' cached \n") == 0);
+	unit_test(&t, embed_pop(h, &xt) == 0);
+	unit_test(&t, embed_pop(h, &v) == 0);
+	unit_test(&t, v == 1);
+	unit_test(&t, embed_eval(h, "$8005 ' cached ! cached \n") == 0);
+	unit_test(&t, embed_pop(h, &v) == 0);
+	unit_test(&t, v == 5);
+	unit_test_statement(&t, embed_core_get(h)[xt >> 1] = 0x8007);
+	unit_test_statement(&t, embed_core_dirty(h, xt >> 1, 1));
+	unit_test(&t, embed_eval(h, "cached \n") == 0);
+	unit_test(&t, embed_pop(h, &v) == 0);
+	unit_test(&t, v == 7);
+	unit_test(&t, embed_eval(h, "$800B pad ! pad ' cached 2 cmove cached ' cached 2 $80 fill cached \n") == 0);
+	unit_test(&t, embed_pop(h, &v) == 0);
+	unit_test(&t, v == 0x80);
+	unit_test(&t, embed_pop(h, &v) == 0);
+	unit_test(&t, v == 11);
+	/* '3 and' compiles to the literal 3 and a call to 'and', a pair that is
+	 * decoded as one superinstruction, overwriting the call with the
+	 * literal 9 must also drop the superinstruction decoded at the 3 */
+	unit_test(&t, embed_eval(h, ": fused 6 3 and ; fused \n") == 0);
+	unit_test(&t, embed_pop(h, &v) == 0);
+	unit_test(&t, v == 2);
+	unit_test(&t, embed_eval(h, "$8009 ' fused 4 + ! fused \n") == 0);
+	unit_test(&t, embed_pop(h, &v) == 0);
+	unit_test(&t, v == 9);
+	unit_test(&t, embed_depth(h) == 2); /* the 6 and 3 */
+
+	unit_test_statement(&t, embed_free(h));
+	return unit_test_finish(&t);
+}
+
+static inline int test_embed_jit(void) {
+	unit_test_t t = unit_test_start();
+	embed_t *h = NULL;
+	unit_test_verify(&t, (h = embed_new()) != NULL);
+	if (!(h->jit = embed_jit_new())) /* not supported on this platform */
+		goto end;
+
+	cell_t v = 0;
+	unit_test(&t, embed_eval(h, ": jitted 1 ; : many 0 99 for jitted + next ; many \n") == 0);
+	unit_test(&t, embed_pop(h, &v) == 0);
+	unit_test(&t, v == 100);
+	unit_test(&t, embed_jit_stats(h->jit).blocks > 0);
+	unit_test(&t, embed_eval(h, "$8002 ' jitted ! many \n") == 0);
+	unit_test(&t, embed_pop(h, &v) == 0);
+	unit_test(&t, v == 200);
+	unit_test(&t, embed_jit_stats(h->jit).flushes > 0);
+	unit_test(&t, embed_eval(h, "1 2 3 many \n") == 0);
+	unit_test(&t, embed_depth(h) == 4);
+	unit_test(&t, embed_pop(h, &v) == 0);
+	unit_test(&t, v == 200);
+	unit_test(&t, embed_pop(h, &v) == 0);
+	unit_test(&t, v == 3);
+end:
+	unit_test_statement(&t, embed_free(h));
+	return unit_test_finish(&t);
+}
+
+/* run 'program' in time slices of 'slice' instructions, returning the total executed */
+static int test_run_slices(embed_t *h, const char *program, uint64_t slice, uint64_t *total, unsigned *slices) {
+	embed_opt_t o_old = *embed_opt_get(h), o_new = o_old;
+	o_new.get = embed_sgetc_cb;
+	o_new.in = &program;
+	o_new.options = EMBED_VM_QUITE_ON;
+	embed_opt_set(h, &o_new);
+	uint64_t executed = 0;
+	int r = 0;
+	*total = 0, *slices = 0;
+	do {
+		r = embed_run(h, slice, &executed);
+		*total += executed;
+		*slices += 1;
+	} while (r == EMBED_RUN_BUDGET && executed >= slice);
+	embed_opt_set(h, &o_old);
+	return r;
+}
+
+static inline int test_embed_run(void) {
+	unit_test_t t = unit_test_start();
+	embed_t *h = NULL, *g = NULL;
+	unit_test_verify(&t, (h = embed_new()) != NULL);
+	unit_test_verify(&t, (g = embed_new()) != NULL);
+	static const char *program = ": spin 0 begin 1+ dup 1000 = until ; spin \n";
+	/* the image checks its own CRC, which covers the registers, when it is
+	 * first booted, so that must not be interrupted */
+	unit_test(&t, embed_eval(h, "\n") == 0);
+	unit_test(&t, embed_eval(g, "\n") == 0);
+
+	uint64_t all = 0, total = 0;
+	unsigned slices = 0, one = 0;
+	cell_t v = 0;
+	unit_test(&t, test_run_slices(h, program, UINT64_MAX, &all, &one) == 0);
+	unit_test(&t, one == 1);
+	unit_test(&t, embed_pop(h, &v) == 0);
+	unit_test(&t, v == 1000);
+	unit_test(&t, test_run_slices(g, program, 100, &total, &slices) == 0);
+	unit_test(&t, slices > 10);
+	unit_test(&t, total == all);
+	unit_test(&t, embed_pop(g, &v) == 0);
+	unit_test(&t, v == 1000);
+	unit_test(&t, embed_depth(g) == 0);
+
+	unit_test_statement(&t, embed_free(h));
+	unit_test_statement(&t, embed_free(g));
+	return unit_test_finish(&t);
+}
+
 static inline int test_embed_reset(void) {
 	unit_test_t t = unit_test_start();
 	embed_t *h = NULL;
@@ -374,6 +554,197 @@ static inline int test_embed_callbacks(void) {
 	return unit_test_finish(&t);
 }
 
+static unsigned long test_reads = 0;
+
+static cell_t test_read_cb(embed_t const * const h, cell_t addr) {
+	test_reads++;
+	return embed_mmu_read_cb(h, addr);
+}
+
+static inline int test_embed_strings(void) {
+	unit_test_t t = unit_test_start();
+	embed_t *h = NULL;
+	unit_test_verify(&t, (h = embed_new()) != NULL);
+
+	char buf[8] = { 0 }, line[64] = { 0 };
+	const char *s = NULL;
+	size_t u = 0;
+	cell_t here = 0, a = 0, v = 0;
+	unit_test(&t, embed_push_string(h, "hello", 5) < 0); /* not booted, 'pad' is not found */
+	unit_test(&t, embed_eval(h, "\n") == 0);
+	unit_test(&t, embed_push_string(h, "hello", 5) == 0);
+	unit_test(&t, embed_depth(h) == 2);
+	unit_test(&t, embed_pop_string_view(h, &s, &u) == 0);
+	unit_test(&t, u == 5 && s && !memcmp(s, "hello", 5));
+	unit_test(&t, embed_depth(h) == 0);
+	unit_test(&t, embed_push_string(h, "hello, world", 12) == 0);
+	unit_test(&t, embed_pop_string(h, buf, sizeof buf, &u) == 0);
+	unit_test(&t, u == 12 && !strcmp(buf, "hello, "));
+	unit_test(&t, embed_pop_string(h, buf, sizeof buf, &u) < 0);
+
+	/* strings at 'pad' have to end before the variable stack, 1792 bytes on */
+	static char big[0x701];
+	unit_test(&t, embed_push_string(h, big, sizeof big) < 0);
+	unit_test(&t, embed_depth(h) == 0);
+	unit_test(&t, embed_push_string(h, big, sizeof big - 1u) == 0);
+	unit_test(&t, embed_pop_string(h, buf, sizeof buf, &u) == 0 && u == sizeof big - 1u);
+
+	unit_test(&t, embed_eval(h, "here \n") == 0);
+	unit_test(&t, embed_pop(h, &here) == 0);
+	unit_test(&t, embed_counted_string(h, "abc", 3, 1, &a) == 0);
+	unit_test(&t, a == here);
+	unit_test(&t, embed_counted_string(h, "pad", 3, 0, &v) == 0);
+	unit_test(&t, v != a);
+	unit_test_statement(&t, snprintf(line, sizeof line, "$%X count here $%X - \n", (unsigned)a, (unsigned)here));
+	unit_test(&t, embed_eval(h, line) == 0);
+	unit_test(&t, embed_pop(h, &v) == 0 && v == 4);
+	unit_test(&t, embed_depth(h) == 2);
+
+	embed_opt_t o_old = *embed_opt_get(h), o_new = o_old;
+	o_new.read = test_read_cb;
+	unit_test_statement(&t, embed_opt_set(h, &o_new));
+	unit_test(&t, embed_pop_string_view(h, &s, &u) < 0);
+	unit_test(&t, embed_depth(h) == 2);
+	unit_test_statement(&t, test_reads = 0);
+	unit_test(&t, embed_pop_string(h, buf, sizeof buf, &u) == 0);
+	unit_test(&t, u == 3 && !strcmp(buf, "abc") && test_reads > 0);
+	unit_test(&t, embed_push_string(h, "xyz", 3) == 0);
+	unit_test(&t, embed_pop_string(h, buf, sizeof buf, &u) == 0);
+	unit_test(&t, u == 3 && !strcmp(buf, "xyz"));
+	unit_test_statement(&t, embed_opt_set(h, &o_old));
+
+	unit_test_statement(&t, embed_free(h));
+	return unit_test_finish(&t);
+}
+
+static int test_extension_add(embed_t *h, void *param, cell_t *cells) {
+	(void)h, (void)param;
+	cells[0] += cells[1];
+	return 0;
+}
+
+static int test_extension_divmod(embed_t *h, void *param, cell_t *cells) {
+	(void)h, (void)param;
+	if (!cells[1])
+		return 10; /* division by zero */
+	const cell_t u = cells[0], v = cells[1];
+	cells[0] = u % v, cells[1] = u / v;
+	return 0;
+}
+
+static inline int test_embed_register(void) {
+	unit_test_t t = unit_test_start();
+	embed_t *h = NULL;
+	static embed_extensions_t x;
+	unit_test_verify(&t, (h = embed_new()) != NULL);
+
+	cell_t v = 0;
+	unit_test(&t, embed_register(h, "h+", test_extension_add, NULL, 2, 1) < 0);
+	unit_test_statement(&t, h->extensions = &x);
+	unit_test(&t, embed_register(h, "h+", test_extension_add, NULL, 2, 1) == 0);
+	unit_test(&t, embed_register(h, "h/mod", test_extension_divmod, NULL, 2, 2) == 1);
+	unit_test(&t, embed_register(h, "hbig", test_extension_add, NULL, EMBED_EXTENSION_CELLS + 1, 1) < 0);
+	unit_test(&t, x.count == 2);
+	unit_test(&t, embed_eval(h, "3 4 h+ 17 5 h/mod \n") == 0);
+	unit_test(&t, embed_depth(h) == 3);
+	unit_test(&t, embed_pop(h, &v) == 0 && v == 3);
+	unit_test(&t, embed_pop(h, &v) == 0 && v == 2);
+	unit_test(&t, embed_pop(h, &v) == 0 && v == 7);
+	unit_test(&t, x.entry[0].calls == 1 && x.entry[1].calls == 1);
+	unit_test(&t, embed_eval(h, ": sum 0 9 for r@ 1 h+ h+ next ; sum 1 0 ' h/mod catch \n") == 0);
+	unit_test(&t, embed_pop(h, &v) == 0 && v == (cell_t)-10);
+	unit_test(&t, embed_depth(h) == 3);
+	unit_test(&t, embed_pop(h, &v) == 0);
+	unit_test(&t, embed_pop(h, &v) == 0);
+	unit_test(&t, embed_pop(h, &v) == 0 && v == 55);
+	unit_test(&t, x.entry[0].calls == 21);
+	unit_test(&t, embed_eval(h, "1 ' h+ catch \n") == 0);
+	unit_test(&t, embed_pop(h, &v) == 0 && v == (cell_t)-4);
+	unit_test(&t, x.entry[0].calls == 21);
+	unit_test(&t, embed_eval(h, "hex \n") == 0);
+	for (int i = 0; i < 10; i++) /* the last index, 11, is read as $B */
+		unit_test(&t, embed_register(h, i < 9 ? "hdrop" : "hlast", test_extension_add, NULL, 2, 1) == i + 2);
+	unit_test(&t, embed_eval(h, "decimal 5 6 hlast \n") == 0);
+	unit_test(&t, embed_pop(h, &v) == 0 && v == 11);
+	unit_test(&t, x.entry[11].calls == 1);
+
+	unit_test_statement(&t, embed_free(h));
+	return unit_test_finish(&t);
+}
+
+static unsigned long test_bytes = 0;
+
+static uint8_t test_read_byte_cb(embed_t const * const h, cell_t addr) {
+	test_bytes++;
+	return embed_mmu_read_byte_cb(h, addr);
+}
+
+static void test_write_byte_cb(embed_t * const h, cell_t addr, uint8_t value) {
+	test_bytes++;
+	embed_mmu_write_byte_cb(h, addr, value);
+}
+
+static inline int test_embed_bytes(void) {
+	unit_test_t t = unit_test_start();
+	embed_t *h = NULL, *g = NULL;
+	unit_test_verify(&t, (h = embed_new()) != NULL);
+	unit_test_verify(&t, (g = embed_new()) != NULL);
+
+	embed_opt_t o = *embed_opt_get(h);
+	unit_test_statement(&t, o.read_byte  = test_read_byte_cb);
+	unit_test_statement(&t, o.write_byte = test_write_byte_cb);
+	unit_test_statement(&t, embed_opt_set(h, &o));
+	static const char *program = "here $1234 , $AB over 1+ c! dup @ swap dup c@ swap 1+ c@ \n";
+	test_bytes = 0;
+	unit_test(&t, embed_eval(h, program) == 0);
+	unit_test(&t, test_bytes >= 3);
+	unit_test(&t, embed_eval(g, program) == 0); /* default callbacks, core indexed directly */
+	cell_t v = 0, w = 0;
+	static const cell_t expected[] = { 0xAB, 0x34, 0xAB34 };
+	for (size_t i = 0; i < sizeof(expected)/sizeof(expected[0]); i++) {
+		unit_test(&t, embed_pop(h, &v) == 0);
+		unit_test(&t, embed_pop(g, &w) == 0);
+		unit_test(&t, v == expected[i]);
+		unit_test(&t, w == expected[i]);
+	}
+	static const char *bulk = "here $1234 , $5678 , dup dup 1+ 3 cmove dup @ swap cell+ dup 1+ 1 $AA fill @ \n";
+	const unsigned long bytes = test_bytes;
+	unit_test(&t, embed_eval(h, bulk) == 0);
+	unit_test(&t, test_bytes >= bytes + 7);
+	unit_test(&t, embed_eval(g, bulk) == 0);
+	static const cell_t moved[] = { 0xAA12, 0x3434 };
+	for (size_t i = 0; i < sizeof(moved)/sizeof(moved[0]); i++) {
+		unit_test(&t, embed_pop(h, &v) == 0);
+		unit_test(&t, embed_pop(g, &w) == 0);
+		unit_test(&t, v == moved[i]);
+		unit_test(&t, w == moved[i]);
+	}
+	static const char *strings = "here $6261 , 2 here $6361 , 2 compare \n";
+	unit_test(&t, embed_eval(h, strings) == 0);
+	unit_test(&t, embed_eval(g, strings) == 0);
+	unit_test(&t, embed_pop(h, &v) == 0 && v == 0xFFFF);
+	unit_test(&t, embed_pop(g, &w) == 0 && w == 0xFFFF);
+	static const char *blanks = "bl parse \t \xC3\xA9\xC3\xA9\xC3\xA9\xC3\xA9\xC3\xA9\x7F\xC3\xA9 nip \n";
+	unit_test(&t, embed_eval(h, blanks) == 0);
+	unit_test(&t, embed_eval(g, blanks) == 0);
+	unit_test(&t, embed_pop(h, &v) == 0 && v == 13);
+	unit_test(&t, embed_pop(g, &w) == 0 && w == 13);
+	static const char *numbers = "0 0 here $3231 , 2 >number 2drop drop $1234 0 <# #s #> drop @ \n";
+	unit_test(&t, embed_eval(h, numbers) == 0);
+	unit_test(&t, embed_eval(g, numbers) == 0);
+	static const cell_t converted[] = { 0x3634, 12 };
+	for (size_t i = 0; i < sizeof(converted)/sizeof(converted[0]); i++) {
+		unit_test(&t, embed_pop(h, &v) == 0);
+		unit_test(&t, embed_pop(g, &w) == 0);
+		unit_test(&t, v == converted[i]);
+		unit_test(&t, w == converted[i]);
+	}
+
+	unit_test_statement(&t, embed_free(h));
+	unit_test_statement(&t, embed_free(g));
+	return unit_test_finish(&t);
+}
+
 static int test_yield(void *param) {
 	(void)param;
 	static unsigned i = 0;
@@ -421,6 +792,208 @@ static inline int test_embed_file(void) {
 	return unit_test_finish(&t);
 }
 
+static inline int test_embed_crc(void) {
+	unit_test_t t = unit_test_start();
+	embed_t *h = NULL;
+	unit_test_verify(&t, (h = embed_new()) != NULL);
+	static const char check[] = "123456789";
+	for (size_t i = 0; i < sizeof(check) - 1; i++)
+		unit_test_statement(&t, embed_mmu_write_byte_cb(h, 0x8000 + i, check[i]));
+	unit_test(&t, embed_crc(h, 0x8000, sizeof(check) - 1) == 0x29B1);
+	unit_test(&t, embed_crc(h, 0x8000, 0) == 0xFFFF);
+
+	cell_t * const m = embed_core_get(h);
+	const cell_t crc = m[16];
+	unit_test_statement(&t, m[16] = 0);
+	unit_test(&t, embed_crc(h, 0, m[15]) == crc);
+
+	static const char test_file[] = "test_image.log";
+	static uint8_t image[0x4000];
+	unit_test_verify(&t, embed_default_block_size <= sizeof(image));
+	unit_test_statement(&t, memcpy(image, embed_default_block, embed_default_block_size));
+	FILE *out = NULL;
+	unit_test_verify(&t, (out = fopen(test_file, "wb")) != NULL);
+	unit_test(&t, fwrite(image, 1, embed_default_block_size, out) == embed_default_block_size);
+	unit_test(&t, fclose(out) == 0);
+	unit_test(&t, embed_load(h, test_file) == 0);
+	unit_test_statement(&t, image[0x100] ^= 0x80);
+	unit_test_verify(&t, (out = fopen(test_file, "wb")) != NULL);
+	unit_test(&t, fwrite(image, 1, embed_default_block_size, out) == embed_default_block_size);
+	unit_test(&t, fclose(out) == 0);
+	unit_test(&t, embed_load(h, test_file) < 0);
+	unit_test(&t, remove(test_file) == 0);
+
+	unit_test_statement(&t, embed_free(h));
+	return unit_test_finish(&t);
+}
+
+static inline int test_embed_fpu(void) {
+	unit_test_t t = unit_test_start();
+	embed_t *h = NULL;
+	unit_test_verify(&t, (h = embed_new()) != NULL);
+	unit_test_verify(&t, h->fpu != NULL);
+
+	/* 'fpu' runs the floating point unit instruction, see 'float.fth' */
+	static const char *program = ": fpu [ $710B , ] ; 7 $13 fpu 2 $13 fpu 9 fpu $15 fpu 0 fpu \n";
+	unit_test(&t, embed_eval(h, program) == 0);
+	cell_t v = 0;
+	unit_test(&t, embed_pop(h, &v) == 0 && v == 0); /* 'fdepth' */
+	unit_test(&t, embed_pop(h, &v) == 0 && v == 3); /* 7 / 2, truncated by 'f>s' */
+	static const char *strings = "here $2E31 , $35 , 3 $1B fpu 2 fpu pad 2 $1C fpu pad c@ $1A fpu \n";
+	unit_test(&t, embed_eval(h, strings) == 0);
+	static const cell_t expected[] = { 0x3FC0, 0, '1', 0xFFFF, 0, 1, 0xFFFF }; /* 1.5 */
+	for (size_t i = 0; i < sizeof(expected)/sizeof(expected[0]); i++)
+		unit_test(&t, embed_pop(h, &v) == 0 && v == expected[i]);
+
+	unit_test_statement(&t, free(h->fpu));
+	unit_test_statement(&t, h->fpu = NULL);
+	unit_test(&t, embed_eval(h, "1 $13 ' fpu catch \n") == 0);
+	unit_test(&t, embed_pop(h, &v) == 0 && v == (cell_t)-21);
+
+	unit_test_statement(&t, embed_free(h));
+	return unit_test_finish(&t);
+}
+
+static int test_native_triple(embed_t *h, void *param) {
+	cell_t v = 0;
+	*(int*)param += 1;
+	return embed_pop(h, &v) || embed_push(h, v * 3) ? 4 : 0;
+}
+
+static inline int test_embed_natives(void) {
+	unit_test_t t = unit_test_start();
+	embed_t *h = NULL, *g = NULL;
+	static embed_natives_t n;
+	unit_test_verify(&t, (h = embed_new()) != NULL);
+	unit_test_verify(&t, (g = embed_new()) != NULL);
+	unit_test(&t, h->natives == NULL);
+	unit_test_verify(&t, embed_native_default(&n) == 2);
+	unit_test_statement(&t, h->natives = &n);
+
+	static const char *program = ": sq dup * ; 7 sq ' sq ' words here \n";
+	unit_test(&t, embed_eval(h, program) == 0);
+	unit_test(&t, embed_eval(g, program) == 0);
+	unit_test(&t, h->natives->entry[0].calls > 0);
+	unit_test(&t, h->natives->entry[0].passes == 0);
+	for (size_t i = 0; i < 4; i++) {
+		cell_t v = 0, w = 0;
+		unit_test(&t, embed_pop(h, &v) == 0);
+		unit_test(&t, embed_pop(g, &w) == 0);
+		unit_test(&t, v == w);
+	}
+
+	/* the override runs while the body of 'twice' is unchanged, the
+	 * interpreter uses 'execute' so the calls are from 'ten' */
+	int calls = 0;
+	cell_t xt = 0, v = 0, *m = NULL;
+	unit_test(&t, embed_eval(h, ": twice dup + ; : ten 5 twice ; ' twice \n") == 0);
+	unit_test(&t, embed_pop(h, &xt) == 0);
+	unit_test_verify(&t, (m = embed_core_get(h)) != NULL);
+	const cell_t first = m[xt >> 1];
+	unit_test(&t, embed_native_add(h, h->natives, xt, 4, test_native_triple, &calls) == 0);
+	unit_test(&t, embed_native_add(h, h->natives, xt, 4, test_native_triple, &calls) < 0);
+	unit_test(&t, embed_eval(h, "ten \n") == 0);
+	unit_test(&t, embed_pop(h, &v) == 0 && v == 15 && calls == 1);
+	unit_test(&t, embed_eval(h, "$8009 ' twice ! ten \n") == 0);
+	unit_test(&t, embed_pop(h, &v) == 0 && v == 14 && calls == 1);
+	unit_test(&t, h->natives->entry[2].passes == 1);
+	unit_test_statement(&t, embed_core_get(h)[xt >> 1] = first);
+	unit_test_statement(&t, embed_core_dirty(h, xt >> 1, 1));
+	unit_test(&t, embed_eval(h, "ten \n") == 0);
+	unit_test(&t, embed_pop(h, &v) == 0 && v == 15 && calls == 2);
+	unit_test(&t, embed_depth(h) == 0);
+
+	unit_test_statement(&t, embed_free(h));
+	unit_test_statement(&t, embed_free(g));
+	return unit_test_finish(&t);
+}
+
+static inline int test_embed_call(void) {
+	unit_test_t t = unit_test_start();
+	embed_t *h = NULL;
+	cell_t sq = 0, two = 0, boom = 0, xt = 0, v = 0, results[2] = { 0 };
+	const cell_t seven = 7;
+	unit_test_verify(&t, (h = embed_new()) != NULL);
+	unit_test(&t, embed_eval(h, ": sq dup * ; : two 1 2 ; : boom 1 0 / ; 99 \n") == 0);
+	const size_t depth = embed_depth(h);
+
+	unit_test(&t, embed_find(h, "sq", &sq) == 0);
+	unit_test(&t, embed_find(h, "two", &two) == 0);
+	unit_test(&t, embed_find(h, "boom", &boom) == 0);
+	unit_test(&t, embed_find(h, "no-such-word", &xt) < 0 && xt == 0);
+	unit_test(&t, embed_call(h, sq, &seven, 1, results, 1) == 0 && results[0] == 49);
+	unit_test(&t, embed_call(h, two, NULL, 0, results, 2) == 0 && results[0] == 1 && results[1] == 2);
+	unit_test(&t, embed_call(h, boom, NULL, 0, NULL, 0) == -10); /* division by zero */
+	unit_test(&t, embed_call(h, sq, &seven, 1, results, 2) == -4);
+	unit_test(&t, embed_depth(h) == depth);
+
+	/* the interpreter carries on where it left off */
+	unit_test(&t, embed_eval(h, "3 sq \n") == 0);
+	unit_test(&t, embed_pop(h, &v) == 0 && v == 9);
+	unit_test(&t, embed_pop(h, &v) == 0 && v == 99);
+
+	unit_test_statement(&t, embed_free(h));
+	return unit_test_finish(&t);
+}
+
+static inline int test_embed_snippets(void) {
+	unit_test_t t = unit_test_start();
+	embed_t *h = NULL;
+	embed_snippets_t s = { .count = 0 };
+	cell_t v = 0;
+	static const char *snippet = "price qty * total +!\n";
+	unit_test_verify(&t, (h = embed_new()) != NULL);
+	unit_test(&t, embed_eval(h, "variable total : price 3 ; : qty 4 ;\n") == 0);
+	for (size_t i = 0; i < 3; i++)
+		unit_test(&t, embed_eval_cached(h, &s, snippet) == 0);
+	unit_test(&t, s.misses == 1 && s.hits == 2 && s.count == 1 && s.area);
+	unit_test(&t, embed_eval(h, "total @\n") == 0);
+	unit_test(&t, embed_pop(h, &v) == 0 && v == 36);
+
+	/* redefining a word throws the compiled snippets away */
+	unit_test(&t, embed_eval(h, ": qty 5 ;\n") == 0);
+	unit_test(&t, embed_eval_cached(h, &s, snippet) == 0);
+	unit_test(&t, s.misses == 2 && s.flushes == 1 && s.count == 1);
+	unit_test(&t, embed_eval(h, "total @\n") == 0);
+	unit_test(&t, embed_pop(h, &v) == 0 && v == 51);
+
+	const size_t depth = embed_depth(h);
+	unit_test(&t, embed_eval_cached(h, &s, "1 0 /\n") == -10);
+	unit_test(&t, embed_eval_cached(h, &s, "1 0 /\n") == -10);
+	unit_test(&t, embed_depth(h) == depth);
+	unit_test(&t, embed_eval_cached(h, &s, "1 if 7 then\n") == 0);
+	unit_test(&t, embed_eval_cached(h, &s, "1 if 7 then\n") == 0);
+	unit_test(&t, embed_pop(h, &v) == 0 && v == 7);
+	unit_test(&t, embed_pop(h, &v) == 0 && v == 7);
+	unit_test(&t, s.count == 3 && s.hits == 4);
+
+	/* numbers are read in the base the snippet is compiled in */
+	unit_test(&t, embed_eval_cached(h, &s, "10\n") == 0);
+	unit_test(&t, embed_eval(h, "hex\n") == 0);
+	unit_test(&t, embed_eval_cached(h, &s, "10\n") == 0);
+	unit_test(&t, embed_eval(h, "decimal\n") == 0);
+	unit_test(&t, embed_eval_cached(h, &s, "10\n") == 0);
+	unit_test(&t, embed_pop(h, &v) == 0 && v == 10);
+	unit_test(&t, embed_pop(h, &v) == 0 && v == 16);
+	unit_test(&t, embed_pop(h, &v) == 0 && v == 10);
+
+	/* a snippet that does not compile does not take up dictionary space */
+	cell_t here = 0;
+	const size_t count = s.count;
+	unit_test(&t, embed_eval(h, "here\n") == 0);
+	unit_test(&t, embed_pop(h, &here) == 0);
+	unit_test(&t, embed_eval_cached(h, &s, "1 no-such-word\n") < 0);
+	unit_test(&t, embed_eval(h, "here\n") == 0);
+	unit_test(&t, embed_pop(h, &v) == 0 && v == here);
+	unit_test(&t, s.count == count);
+	unit_test(&t, embed_eval_cached(h, &s, "6 7 *\n") == 0);
+	unit_test(&t, embed_pop(h, &v) == 0 && v == 42);
+	unit_test(&t, s.count == count + 1);
+
+	unit_test_statement(&t, embed_free(h));
+	return unit_test_finish(&t);
+}
+
 int embed_tests(void) {
 #ifdef NDEBUG
 	embed_warning("NDEBUG Defined - unit tests not compiled into program");
@@ -430,6 +1003,10 @@ int embed_tests(void) {
 	test_func funcs[] = {
 		test_embed_stack,     test_embed_reset,  test_embed_eval,
 		test_embed_callbacks, test_embed_yields, test_embed_file,
+		test_embed_cache,     test_embed_jit,    test_embed_run,
+		test_embed_bytes,     test_embed_crc,    test_embed_fpu,
+		test_embed_natives,   test_embed_call,   test_embed_snippets,
+		test_embed_stack_n,   test_embed_strings, test_embed_register,
 	};
 
 	int r = 0;
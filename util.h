@@ -82,7 +82,10 @@ FILE *embed_fopen_or_die(const char *file, const char *mode);
 void *embed_alloc(size_t sz);
 
 /**@brief Make a new Forth VM, and load with default image. The default image
- * contains a fully working eForth image.
+ * contains a fully working eForth image. The VM has an instruction cache and
+ * a floating point unit. It has no native overrides, to use them assign a
+ * zeroed 'embed_natives_t' filled in by 'embed_native_default' to the
+ * 'natives' field, 'embed_free' leaves it alone.
  * @return a pointer to a new Forth VM, loaded with the default image */
 embed_t  *embed_new(void);
 
@@ -143,7 +146,7 @@ int embed_forth_opt(embed_t *h, embed_vm_option_e opt, FILE *in, FILE *out, cons
  * @return an initialized 'embed_opt_t' structure suitable for hosted use */
 embed_opt_t embed_opt_default_hosted(void);
 
-/**@brief Load VM image from FILE*
+/**@brief Load VM image from FILE*, checking its header as 'embed_load' does
  * @param h,      uninitialized Virtual Machine image
  * @param input,  open file to read from to load a disk image
  * @return zero on success, negative on failure */